@@ -2,9 +2,243 @@
 #include "timestamp.h"
 #include "logger.h"
 #include <cstring>
+#include <chrono>
+#include <sys/time.h>
+#include <time.h>
 
 using namespace swss;
 
+namespace {
+
+/* LEB128: 7 bits per byte, most lengths take a single byte */
+void putVarint(std::string& buf, uint64_t v)
+{
+    while (v >= 0x80)
+    {
+        buf.push_back(static_cast<char>((v & 0x7f) | 0x80));
+        v >>= 7;
+    }
+    buf.push_back(static_cast<char>(v));
+}
+
+void putU64(std::string& buf, uint64_t v)
+{
+    buf.append(reinterpret_cast<const char*>(&v), sizeof(v));
+}
+
+void putStr(std::string& buf, const std::string& str)
+{
+    putVarint(buf, str.size());
+    buf.append(str);
+}
+
+uint64_t nowUsec()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return static_cast<uint64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+}
+
+/* Same format as swss::getTimestamp() */
+std::string formatTimestamp(uint64_t usec)
+{
+    char buffer[64];
+    time_t sec = static_cast<time_t>(usec / 1000000);
+    struct tm tm;
+    localtime_r(&sec, &tm);
+    size_t size = strftime(buffer, 32, "%Y-%m-%d.%T.", &tm);
+    snprintf(&buffer[size], 32, "%06lu", static_cast<unsigned long>(usec % 1000000));
+    return std::string(buffer);
+}
+
+class RecReader {
+public:
+    RecReader(const std::string& buf) : m_buf(buf) {}
+
+    bool ok() const { return m_ok; }
+    bool done() const { return m_pos == m_buf.size(); }
+
+    template <typename T>
+    T get()
+    {
+        T v = 0;
+        if (!check(sizeof(T)))
+        {
+            return v;
+        }
+        memcpy(&v, m_buf.data() + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return v;
+    }
+
+    uint64_t getVarint()
+    {
+        uint64_t v = 0;
+        for (unsigned shift = 0; shift < 64 && check(1); shift += 7)
+        {
+            uint8_t byte = static_cast<uint8_t>(m_buf[m_pos++]);
+            v |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+            {
+                return v;
+            }
+        }
+        m_ok = false;
+        return 0;
+    }
+
+    std::string getStr()
+    {
+        uint64_t len = getVarint();
+        if (!check(len))
+        {
+            return "";
+        }
+        std::string str = m_buf.substr(m_pos, len);
+        m_pos += len;
+        return str;
+    }
+
+    std::string rest()
+    {
+        std::string str = m_buf.substr(m_pos);
+        m_pos = m_buf.size();
+        return str;
+    }
+
+private:
+    const std::string& m_buf;
+    size_t m_pos = 0;
+    bool m_ok = true;
+
+    bool check(size_t len)
+    {
+        if (!m_ok || m_buf.size() - m_pos < len)
+        {
+            m_ok = false;
+        }
+        return m_ok;
+    }
+};
+
+/* Write a binary record as a text recording line */
+bool decodeRecord(const std::string& rec, std::ostream& os)
+{
+    RecReader reader(rec);
+    uint64_t usec = reader.get<uint64_t>();
+    uint8_t type = reader.get<uint8_t>();
+    if (!reader.ok())
+    {
+        return false;
+    }
+
+    if (type == REC_TYPE_TEXT)
+    {
+        os << formatTimestamp(usec) << "|" << reader.rest() << "\n";
+        return true;
+    }
+
+    if (type != REC_TYPE_TUPLE)
+    {
+        return false;
+    }
+
+    std::string table = reader.getStr();
+    std::string separator = reader.getStr();
+    std::string key = reader.getStr();
+    std::string op = reader.getStr();
+    uint64_t count = reader.getVarint();
+
+    std::string line = formatTimestamp(usec) + "|" + table + separator + key + "|" + op;
+    for (uint64_t i = 0; i < count && reader.ok(); i++)
+    {
+        line += "|" + reader.getStr();
+        line += ":" + reader.getStr();
+    }
+
+    if (!reader.ok() || !reader.done())
+    {
+        return false;
+    }
+
+    os << line << "\n";
+    return true;
+}
+
+}
+
+RecRing::RecRing(size_t capacity) :
+    m_head(0),
+    m_tail(0)
+{
+    size_t size = 64;
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+
+    m_buf.resize(size);
+    m_mask = size - 1;
+}
+
+void RecRing::copyIn(uint64_t pos, const void* data, size_t len)
+{
+    size_t off = pos & m_mask;
+    size_t first = std::min(len, m_buf.size() - off);
+    memcpy(&m_buf[off], data, first);
+    memcpy(&m_buf[0], static_cast<const char*>(data) + first, len - first);
+}
+
+void RecRing::copyOut(uint64_t pos, void* data, size_t len) const
+{
+    size_t off = pos & m_mask;
+    size_t first = std::min(len, m_buf.size() - off);
+    memcpy(data, &m_buf[off], first);
+    memcpy(static_cast<char*>(data) + first, &m_buf[0], len - first);
+}
+
+bool RecRing::push(const std::string& record)
+{
+    uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    uint64_t head = m_head.load(std::memory_order_acquire);
+    uint32_t len = static_cast<uint32_t>(record.size());
+
+    if (m_buf.size() - (tail - head) < sizeof(len) + len)
+    {
+        return false;
+    }
+
+    copyIn(tail, &len, sizeof(len));
+    copyIn(tail + sizeof(len), record.data(), len);
+    m_tail.store(tail + sizeof(len) + len, std::memory_order_release);
+
+    return true;
+}
+
+bool RecRing::pop(std::string& record)
+{
+    uint64_t head = m_head.load(std::memory_order_relaxed);
+    uint64_t tail = m_tail.load(std::memory_order_acquire);
+    uint32_t len;
+
+    if (head == tail)
+    {
+        return false;
+    }
+
+    copyOut(head, &len, sizeof(len));
+    record.resize(len);
+    copyOut(head + sizeof(len), &record[0], len);
+    m_head.store(head + sizeof(len) + len, std::memory_order_release);
+
+    return true;
+}
+
+bool RecRing::empty() const
+{
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+}
+
 const std::string Recorder::DEFAULT_DIR = ".";
 const std::string Recorder::REC_START = "|recording started";
 const std::string Recorder::SWSS_FNAME = "swss.rec";
@@ -60,7 +294,14 @@ void RecWriter::startRec(bool exit_if_failure)
     }
 
     fname = getLoc() + "/" + getFile();
-    record_ofs.open(fname, std::ofstream::out | std::ofstream::app);
+    auto mode = std::ofstream::out | std::ofstream::app;
+    if (m_binary)
+    {
+        fname += ".bin";
+        mode |= std::ofstream::binary;
+    }
+
+    record_ofs.open(fname, mode);
     if (!record_ofs.is_open())
     {
         SWSS_LOG_ERROR("%s Recorder: Failed to open recording file %s: error %s", getName().c_str(), fname.c_str(), strerror(errno));
@@ -73,13 +314,34 @@ void RecWriter::startRec(bool exit_if_failure)
             setRecord(false);
         }
     }
-    record_ofs << swss::getTimestamp() << Recorder::REC_START << std::endl;
+    if (m_binary)
+    {
+        std::string rec;
+        putU64(rec, nowUsec());
+        rec.push_back(REC_TYPE_TEXT);
+        rec.append(Recorder::REC_START.substr(1));
+        writeRecord(rec);
+        record_ofs.flush();
+    }
+    else
+    {
+        record_ofs << swss::getTimestamp() << Recorder::REC_START << std::endl;
+    }
     SWSS_LOG_NOTICE("%s Recorder: Recording started at %s", getName().c_str(), fname.c_str());
+
+    if (m_async && isRecord() && !m_writer)
+    {
+        m_ring.reset(new RecRing(RING_SIZE));
+        m_stopWriter = false;
+        m_writer.reset(new std::thread(&RecWriter::writerThread, this));
+    }
 }
 
 
 RecWriter::~RecWriter()
 {
+    stopRec();
+
     if (record_ofs.is_open())
     {
         record_ofs.close();      
@@ -87,12 +349,38 @@ RecWriter::~RecWriter()
 }
 
 
+void RecWriter::stopRec()
+{
+    if (!m_writer)
+    {
+        return;
+    }
+
+    m_stopWriter = true;
+    m_writer->join();
+    m_writer.reset();
+}
+
+
 void RecWriter::record(const std::string& val)
 {
     if (!isRecord())
     {
         return ;
     }
+
+    std::lock_guard<std::mutex> lock(m_producerMutex);
+
+    if (m_writer || m_binary)
+    {
+        m_encodeBuf.clear();
+        putU64(m_encodeBuf, nowUsec());
+        m_encodeBuf.push_back(REC_TYPE_TEXT);
+        m_encodeBuf.append(val);
+        submit(m_encodeBuf);
+        return;
+    }
+
     if (isRotate())
     {
         setRotate(false);
@@ -102,6 +390,170 @@ void RecWriter::record(const std::string& val)
 }
 
 
+void RecWriter::record(const std::string& table, const std::string& separator, const KeyOpFieldsValuesTuple& tuple)
+{
+    if (!isRecord())
+    {
+        return ;
+    }
+
+    std::lock_guard<std::mutex> lock(m_producerMutex);
+
+    if (m_writer || m_binary)
+    {
+        m_encodeBuf.clear();
+        putU64(m_encodeBuf, nowUsec());
+        m_encodeBuf.push_back(REC_TYPE_TUPLE);
+        putStr(m_encodeBuf, table);
+        putStr(m_encodeBuf, separator);
+        putStr(m_encodeBuf, kfvKey(tuple));
+        putStr(m_encodeBuf, kfvOp(tuple));
+        putVarint(m_encodeBuf, kfvFieldsValues(tuple).size());
+        for (const auto& fv : kfvFieldsValues(tuple))
+        {
+            putStr(m_encodeBuf, fvField(fv));
+            putStr(m_encodeBuf, fvValue(fv));
+        }
+        submit(m_encodeBuf);
+        return;
+    }
+
+    if (isRotate())
+    {
+        setRotate(false);
+        logfileReopen();
+    }
+    record_ofs << swss::getTimestamp() << "|" << table << separator << kfvKey(tuple) << "|" << kfvOp(tuple);
+    for (const auto& fv : kfvFieldsValues(tuple))
+    {
+        record_ofs << "|" << fvField(fv) << ":" << fvValue(fv);
+    }
+    record_ofs << std::endl;
+}
+
+
+/* Queue the record for the writer thread, or write it in sync mode */
+void RecWriter::submit(const std::string& rec)
+{
+    if (!m_writer)
+    {
+        if (isRotate())
+        {
+            setRotate(false);
+            logfileReopen();
+        }
+        writeRecord(rec);
+        record_ofs.flush();
+        return;
+    }
+
+    if (sizeof(uint32_t) + rec.size() > m_ring->capacity())
+    {
+        SWSS_LOG_ERROR("%s Recorder: Dropping record of %zu bytes", getName().c_str(), rec.size());
+        return;
+    }
+
+    /* Wait for the writer rather than losing records */
+    while (!m_ring->push(rec))
+    {
+        m_ringFull++;
+        std::this_thread::yield();
+    }
+}
+
+
+void RecWriter::writeRecord(const std::string& rec)
+{
+    if (m_binary)
+    {
+        std::string len;
+        putVarint(len, rec.size());
+        record_ofs.write(len.data(), len.size());
+        record_ofs.write(rec.data(), rec.size());
+    }
+    else
+    {
+        decodeRecord(rec, record_ofs);
+    }
+}
+
+
+void RecWriter::writerThread()
+{
+    std::string rec;
+
+    while (true)
+    {
+        /* Read before draining, so the records queued before stopRec() are written */
+        bool stopping = m_stopWriter;
+        size_t count = 0;
+
+        while (m_ring->pop(rec))
+        {
+            writeRecord(rec);
+            count++;
+        }
+
+        if (count != 0)
+        {
+            record_ofs.flush();
+        }
+
+        if (isRotate())
+        {
+            setRotate(false);
+            logfileReopen();
+        }
+
+        if (stopping)
+        {
+            break;
+        }
+
+        if (count == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+
+size_t RecWriter::binaryToText(std::istream& in, std::ostream& out, bool& ok)
+{
+    size_t count = 0;
+    std::string rec;
+
+    ok = true;
+    while (in.peek() != std::istream::traits_type::eof())
+    {
+        uint64_t len = 0;
+        unsigned shift = 0;
+        int byte;
+        do
+        {
+            byte = in.get();
+            if (byte == std::istream::traits_type::eof() || shift >= 64)
+            {
+                ok = false;
+                return count;
+            }
+            len |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+
+        rec.resize(len);
+        if (!in.read(&rec[0], len) || !decodeRecord(rec, out))
+        {
+            ok = false;
+            break;
+        }
+        count++;
+    }
+
+    return count;
+}
+
+
 void RecWriter::logfileReopen()
 {
     /*
@@ -110,7 +562,7 @@ void RecWriter::logfileReopen()
      * empty file here.
      */
     record_ofs.close();
-    record_ofs.open(fname, std::ofstream::out | std::ofstream::app);
+    record_ofs.open(fname, std::ofstream::out | std::ofstream::app | (m_binary ? std::ofstream::binary : std::ofstream::openmode()));
 
     if (!record_ofs.is_open())
     {
@@ -5,6 +5,11 @@
 #include <iostream>
 #include <sstream>
 #include <memory>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "table.h"
 
 namespace swss {
 
@@ -27,18 +32,90 @@ public:
 
 private:
     bool m_recording;
-    bool m_rotate;
+    /* Set from the SIGHUP handler, read by the async writer thread */
+    std::atomic<bool> m_rotate;
     std::string m_location;
     std::string m_filename;
     std::string m_name;
 };
 
+/*
+ * Single producer single consumer ring of records: push() and pop() only
+ * synchronize through the head and tail positions, so the writer thread
+ * never blocks a producer. It is not safe for concurrent push() calls;
+ * RecWriter serializes its producers with m_producerMutex.
+ * Each record is stored as a 32 bit length followed by its bytes.
+ */
+class RecRing {
+public:
+    /* capacity is rounded up to a power of two */
+    explicit RecRing(size_t capacity);
+
+    size_t capacity() const { return m_buf.size(); }
+
+    /* Returns false if there is no room for the record */
+    bool push(const std::string& record);
+    bool pop(std::string& record);
+    bool empty() const;
+
+private:
+    std::vector<char> m_buf;
+    size_t m_mask;
+
+    /* Read position, owned by the consumer */
+    std::atomic<uint64_t> m_head;
+    /* Keep the positions on separate cache lines */
+    char m_pad[64];
+    /* Write position, owned by the producer */
+    std::atomic<uint64_t> m_tail;
+
+    void copyIn(uint64_t pos, const void* data, size_t len);
+    void copyOut(uint64_t pos, void* data, size_t len) const;
+};
+
+/*
+ * Binary record, as stored in the ring and in binary recording files:
+ *   u64 timestamp (usec since epoch) | u8 type | payload
+ * REC_TYPE_TEXT payload is the text as is.
+ * REC_TYPE_TUPLE payload is table, separator, key, op, count and count
+ * field/value pairs. Strings are a length and their bytes; lengths and
+ * count are LEB128 varints. In binary files each record is prefixed with
+ * its varint length. Integers are in host byte order.
+ */
+enum RecType {
+    REC_TYPE_TEXT = 0,
+    REC_TYPE_TUPLE = 1
+};
+
 class RecWriter : public RecBase {
 public:
     RecWriter() = default;
     virtual ~RecWriter();
     void startRec(bool exit_if_failure);
     void record(const std::string& val);
+    /* Same line as record(table + separator + key + "|" + op + "|f:v"...) */
+    void record(const std::string& table, const std::string& separator, const KeyOpFieldsValuesTuple& tuple);
+
+    /*
+     * Async mode hands the records to a writer thread through a ring, so
+     * the caller does not wait on the file. Binary mode writes the compact
+     * binary records to <file>.bin. Both must be set before startRec().
+     */
+    void setAsync(bool async) { m_async = async; }
+    void setBinary(bool binary) { m_binary = binary; }
+    bool isAsync() const { return m_async; }
+    bool isBinary() const { return m_binary; }
+
+    /* Stop the writer thread after writing the queued records */
+    void stopRec();
+
+    /* Times a record waited for room in the ring */
+    uint64_t getRingFullCount() const { return m_ringFull; }
+
+    /* Convert a binary recording to the text format, returns records converted */
+    static size_t binaryToText(std::istream& in, std::ostream& out, bool& ok);
+
+    static const size_t RING_SIZE = 4 * 1024 * 1024;
 
 protected:
     void logfileReopen();
@@ -46,6 +123,24 @@ protected:
 private:
     std::ofstream record_ofs;
     std::string fname;
+
+    bool m_async = false;
+    bool m_binary = false;
+
+    std::unique_ptr<RecRing> m_ring;
+    std::unique_ptr<std::thread> m_writer;
+    std::atomic<bool> m_stopWriter{false};
+    /*
+     * Serializes the producers (the execution group threads, the response
+     * publisher DB thread) in every mode, over the ring push or the file
+     */
+    std::mutex m_producerMutex;
+    std::string m_encodeBuf;
+    std::atomic<uint64_t> m_ringFull{0};
+
+    void submit(const std::string& rec);
+    void writeRecord(const std::string& rec);
+    void writerThread();
 };
 
 class SwSSRec : public RecWriter {
@@ -30,6 +30,7 @@ extern PortsOrch*        gPortsOrch;
 extern CrmOrch *gCrmOrch;
 extern SwitchOrch *gSwitchOrch;
 extern string gMySwitchType;
+extern size_t gMaxBulkSize;
 
 #define MIN_VLAN_ID 1    // 0 is a reserved VLAN ID
 #define MAX_VLAN_ID 4095 // 4096 is a reserved VLAN ID
@@ -1107,16 +1108,13 @@ bool AclRule::create()
     return true;
 }
 
-bool AclRule::createRule()
+bool AclRule::getRuleAttributes(vector<sai_attribute_t> &rule_attrs)
 {
     SWSS_LOG_ENTER();
 
-    vector<sai_attribute_t> rule_attrs;
-    sai_object_id_t range_objects[2];
-    sai_object_list_t range_object_list = {0, range_objects};
-
     sai_attribute_t attr;
-    sai_status_t status;
+
+    m_rangeOids.clear();
 
     // store table oid this rule belongs to
     attr.id = SAI_ACL_ENTRY_ATTR_TABLE_ID;
@@ -1150,17 +1148,18 @@ bool AclRule::createRule()
             if (!range)
             {
                 // release already created range if any
-                AclRange::remove(range_objects, range_object_list.count);
+                AclRange::remove(m_rangeOids.data(), (int)m_rangeOids.size());
                 return false;
             }
 
             m_ranges.push_back(range);
-            range_objects[range_object_list.count++] = range->getOid();
+            m_rangeOids.push_back(range->getOid());
         }
 
         attr.id = SAI_ACL_ENTRY_ATTR_FIELD_ACL_RANGE_TYPE;
         attr.value.aclfield.enable = true;
-        attr.value.aclfield.data.objlist = range_object_list;
+        attr.value.aclfield.data.objlist.count = (uint32_t)m_rangeOids.size();
+        attr.value.aclfield.data.objlist.list = m_rangeOids.data();
         rule_attrs.push_back(attr);
     }
 
@@ -1178,6 +1177,21 @@ bool AclRule::createRule()
         rule_attrs.push_back(attr);
     }
 
+    return true;
+}
+
+bool AclRule::createRule()
+{
+    SWSS_LOG_ENTER();
+
+    vector<sai_attribute_t> rule_attrs;
+    sai_status_t status;
+
+    if (!getRuleAttributes(rule_attrs))
+    {
+        return false;
+    }
+
     status = sai_acl_api->create_acl_entry(&m_ruleOid, gSwitchId, (uint32_t)rule_attrs.size(), rule_attrs.data());
     if (status != SAI_STATUS_SUCCESS)
     {
@@ -1188,7 +1202,7 @@ bool AclRule::createRule()
         }
         SWSS_LOG_ERROR("Failed to create ACL rule %s, rv:%d",
                 m_id.c_str(), status);
-        AclRange::remove(range_objects, range_object_list.count);
+        AclRange::remove(m_rangeOids.data(), (int)m_rangeOids.size());
         decreaseNextHopRefCount();
     }
 
@@ -1613,6 +1627,86 @@ const vector<AclRangeConfig>& AclRule::getRangeConfig() const
     return m_rangeConfig;
 }
 
+bool AclRule::supportsBulkCreate() const
+{
+    return true;
+}
+
+void AclRule::queueCreateCounter(ObjectBulker<sai_acl_api_t> &bulker)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_createCounter || m_counterOid != SAI_NULL_OBJECT_ID)
+    {
+        return;
+    }
+
+    vector<sai_attribute_t> counter_attrs = getCounterAttributes();
+    bulker.create_entry(&m_counterOid, (uint32_t)counter_attrs.size(), counter_attrs.data());
+}
+
+bool AclRule::createCounterPost()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_createCounter)
+    {
+        return true;
+    }
+
+    if (m_counterOid == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("Failed to create counter for the rule %s in table %s", m_id.c_str(), m_pTable->getId().c_str());
+        return false;
+    }
+
+    gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_COUNTER, m_pTable->getOid());
+
+    SWSS_LOG_INFO("Created counter for the rule %s in table %s", m_id.c_str(), m_pTable->getId().c_str());
+
+    return true;
+}
+
+bool AclRule::queueCreateRule(ObjectBulker<sai_acl_api_t> &bulker)
+{
+    SWSS_LOG_ENTER();
+
+    vector<sai_attribute_t> rule_attrs;
+
+    if (!getRuleAttributes(rule_attrs))
+    {
+        removeCounter();
+        return false;
+    }
+
+    bulker.create_entry(&m_ruleOid, &m_createStatus, (uint32_t)rule_attrs.size(), rule_attrs.data());
+    return true;
+}
+
+bool AclRule::createRulePost()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_createStatus == SAI_STATUS_ITEM_ALREADY_EXISTS)
+    {
+        SWSS_LOG_NOTICE("ACL rule %s already exists", m_id.c_str());
+        return true;
+    }
+
+    if (m_ruleOid == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("Failed to create ACL rule %s, rv:%d", m_id.c_str(), m_createStatus);
+        removeRanges();
+        decreaseNextHopRefCount();
+        removeCounter();
+        return false;
+    }
+
+    gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
+
+    return true;
+}
+
 bool AclRule::getCreateCounter() const
 {
     return m_createCounter;
@@ -1726,18 +1820,11 @@ bool AclRule::disableCounter()
     return true;
 }
 
-bool AclRule::createCounter()
+vector<sai_attribute_t> AclRule::getCounterAttributes() const
 {
-    SWSS_LOG_ENTER();
-
     sai_attribute_t attr;
     vector<sai_attribute_t> counter_attrs;
 
-    if (m_counterOid != SAI_NULL_OBJECT_ID)
-    {
-        return true;
-    }
-
     attr.id = SAI_ACL_COUNTER_ATTR_TABLE_ID;
     attr.value.oid = m_pTable->getOid();
     counter_attrs.push_back(attr);
@@ -1749,6 +1836,20 @@ bool AclRule::createCounter()
         counter_attrs.push_back(attr);
     }
 
+    return counter_attrs;
+}
+
+bool AclRule::createCounter()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_counterOid != SAI_NULL_OBJECT_ID)
+    {
+        return true;
+    }
+
+    vector<sai_attribute_t> counter_attrs = getCounterAttributes();
+
     if (sai_acl_api->create_acl_counter(&m_counterOid, gSwitchId, (uint32_t)counter_attrs.size(), counter_attrs.data()) != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create counter for the rule %s in table %s", m_id.c_str(), m_pTable->getId().c_str());
@@ -2030,6 +2131,12 @@ bool AclRuleMirror::createRule()
     return activate();
 }
 
+bool AclRuleMirror::supportsBulkCreate() const
+{
+    // Created on mirror session activation
+    return false;
+}
+
 bool AclRuleMirror::removeRule()
 {
     return deactivate();
@@ -2122,6 +2229,11 @@ bool AclRuleMirror::deactivate()
     return true;
 }
 
+string AclRuleMirror::getSessionName() const
+{
+    return m_sessionName;
+}
+
 bool AclRuleMirror::update(const AclRule& rule)
 {
     auto mirrorRule = dynamic_cast<const AclRuleMirror*>(&rule);
@@ -2830,6 +2942,12 @@ bool AclRuleDTelWatchListEntry::createRule()
     return activate();
 }
 
+bool AclRuleDTelWatchListEntry::supportsBulkCreate() const
+{
+    // Created on INT session activation
+    return false;
+}
+
 bool AclRuleDTelWatchListEntry::removeRule()
 {
     return deactivate();
@@ -2973,29 +3091,13 @@ AclRange *AclRange::create(sai_acl_range_type_t type, int min, int max)
     auto range_it = m_ranges.find(rangeProperties);
     if (range_it == m_ranges.end())
     {
-        sai_attribute_t attr;
-        vector<sai_attribute_t> range_attrs;
-
-        // work around to avoid syncd termination on SAI error due to max count of ranges reached
-        // can be removed when syncd start passing errors to the SAI callers
-        char *platform = getenv("platform");
-        if (platform && strstr(platform, MLNX_PLATFORM_SUBSTRING))
+        if (!canCreate(0))
         {
-            if (m_ranges.size() >= MLNX_MAX_RANGES_COUNT)
-            {
-                SWSS_LOG_ERROR("Maximum numbers of ACL ranges reached");
-                return NULL;
-            }
+            SWSS_LOG_ERROR("Maximum numbers of ACL ranges reached");
+            return NULL;
         }
 
-        attr.id = SAI_ACL_RANGE_ATTR_TYPE;
-        attr.value.s32 = type;
-        range_attrs.push_back(attr);
-
-        attr.id = SAI_ACL_RANGE_ATTR_LIMIT;
-        attr.value.u32range.min = min;
-        attr.value.u32range.max = max;
-        range_attrs.push_back(attr);
+        vector<sai_attribute_t> range_attrs = getAttributes(type, min, max);
 
         status = sai_acl_api->create_acl_range(&range_oid, gSwitchId, (uint32_t)range_attrs.size(), range_attrs.data());
         if (status != SAI_STATUS_SUCCESS)
@@ -3020,6 +3122,53 @@ AclRange *AclRange::create(sai_acl_range_type_t type, int min, int max)
     return range_it->second;
 }
 
+bool AclRange::exists(sai_acl_range_type_t type, int min, int max)
+{
+    return m_ranges.find(make_tuple(type, min, max)) != m_ranges.end();
+}
+
+bool AclRange::canCreate(size_t pending)
+{
+    // work around to avoid syncd termination on SAI error due to max count of ranges reached
+    // can be removed when syncd start passing errors to the SAI callers
+    char *platform = getenv("platform");
+    if (platform && strstr(platform, MLNX_PLATFORM_SUBSTRING))
+    {
+        if (m_ranges.size() + pending >= MLNX_MAX_RANGES_COUNT)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+vector<sai_attribute_t> AclRange::getAttributes(sai_acl_range_type_t type, int min, int max)
+{
+    sai_attribute_t attr;
+    vector<sai_attribute_t> range_attrs;
+
+    attr.id = SAI_ACL_RANGE_ATTR_TYPE;
+    attr.value.s32 = type;
+    range_attrs.push_back(attr);
+
+    attr.id = SAI_ACL_RANGE_ATTR_LIMIT;
+    attr.value.u32range.min = min;
+    attr.value.u32range.max = max;
+    range_attrs.push_back(attr);
+
+    return range_attrs;
+}
+
+void AclRange::add(sai_acl_range_type_t type, int min, int max, sai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    // Referenced by the rules through create()
+    SWSS_LOG_INFO("Created ACL Range object. Type: %d, range %d-%d, oid: %" PRIx64, type, min, max, oid);
+    m_ranges[make_tuple(type, min, max)] = new AclRange(type, oid, min, max);
+}
+
 bool AclRange::remove(sai_acl_range_type_t type, int min, int max)
 {
     SWSS_LOG_ENTER();
@@ -3711,6 +3860,13 @@ void AclOrch::update(SubjectType type, void *cntx)
         return;
     }
 
+    if (type == SUBJECT_TYPE_MIRROR_SESSION_CHANGE)
+    {
+        // Wake the rules parked until the session is created
+        auto update = static_cast<MirrorSessionUpdate *>(cntx);
+        resolveConstraint(make_pair(RETRY_CST_MIRROR_SESSION, update->name));
+    }
+
     // ACL table deals with port change
     // ACL rule deals with mirror session change and int session change
     for (auto& table : m_AclTables)
@@ -4586,6 +4742,8 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    vector<AclRuleCreation> creations;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -4646,7 +4804,7 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             {
                 SWSS_LOG_ERROR("Error while creating ACL rule %s: %s", rule_id.c_str(), e.what());
                 it = consumer.m_toSync.erase(it);
-                return;
+                break;
             }
             bool bHasTCPFlag = false;
             bool bHasIPProtocol = false;
@@ -4730,7 +4888,13 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             // validate and create ACL rule
             if (bAllAttributesOk && newRule->validate())
             {
-                if (addAclRule(newRule, table_id))
+                if (newRule->supportsBulkCreate() && !m_AclTables[table_oid].rules.count(rule_id))
+                {
+                    // Created with the other new rules at the end of the task
+                    creations.push_back({ newRule, table_id, it, false });
+                    it++;
+                }
+                else if (addAclRule(newRule, table_id))
                 {
                     setAclRuleStatus(table_id, rule_id, AclObjectStatus::ACTIVE);
                     it = consumer.m_toSync.erase(it);
@@ -4738,7 +4902,17 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
                 else
                 {
                     setAclRuleStatus(table_id, rule_id, AclObjectStatus::PENDING_CREATION);
-                    it++;
+
+                    // Mirror rules wait for their session to be created
+                    auto mirrorRule = dynamic_pointer_cast<AclRuleMirror>(newRule);
+                    if (mirrorRule && !m_mirrorOrch->sessionExists(mirrorRule->getSessionName()))
+                    {
+                        it = consumer.parkTask(it, make_pair(RETRY_CST_MIRROR_SESSION, mirrorRule->getSessionName()));
+                    }
+                    else
+                    {
+                        it++;
+                    }
                 }
             }
             else
@@ -4769,6 +4943,107 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
         }
     }
+
+    createAclRules(consumer, creations);
+}
+
+void AclOrch::createAclRules(Consumer &consumer, vector<AclRuleCreation> &creations)
+{
+    SWSS_LOG_ENTER();
+
+    if (creations.empty())
+    {
+        return;
+    }
+
+    ObjectBulker<sai_acl_api_t> counterBulker(sai_acl_api, SAI_OBJECT_TYPE_ACL_COUNTER, gSwitchId, gMaxBulkSize);
+    ObjectBulker<sai_acl_api_t> rangeBulker(sai_acl_api, SAI_OBJECT_TYPE_ACL_RANGE, gSwitchId, gMaxBulkSize);
+    ObjectBulker<sai_acl_api_t> entryBulker(sai_acl_api, SAI_OBJECT_TYPE_ACL_ENTRY, gSwitchId, gMaxBulkSize);
+
+    // The counters and the ranges are referenced by the entries, they are created first
+    for (auto &creation: creations)
+    {
+        creation.rule->queueCreateCounter(counterBulker);
+    }
+    counterBulker.flush();
+
+    // Ranges are shared by the rules, each new range is created once
+    map<acl_range_properties_t, sai_object_id_t> newRanges;
+    for (auto &creation: creations)
+    {
+        creation.ok = creation.rule->createCounterPost();
+        if (!creation.ok)
+        {
+            continue;
+        }
+
+        for (const auto &rangeConfig: creation.rule->getRangeConfig())
+        {
+            acl_range_properties_t properties(rangeConfig.rangeType, rangeConfig.min, rangeConfig.max);
+            if (AclRange::exists(rangeConfig.rangeType, rangeConfig.min, rangeConfig.max) ||
+                newRanges.count(properties) || !AclRange::canCreate(newRanges.size()))
+            {
+                continue;
+            }
+
+            vector<sai_attribute_t> range_attrs = AclRange::getAttributes(rangeConfig.rangeType, rangeConfig.min, rangeConfig.max);
+            rangeBulker.create_entry(&newRanges[properties], (uint32_t)range_attrs.size(), range_attrs.data());
+        }
+    }
+    rangeBulker.flush();
+
+    for (const auto &newRange: newRanges)
+    {
+        sai_acl_range_type_t type;
+        int min, max;
+        tie(type, min, max) = newRange.first;
+
+        // A failed range is created again by the rules using it
+        if (newRange.second == SAI_NULL_OBJECT_ID)
+        {
+            SWSS_LOG_ERROR("Failed to create range object. Type: %d, range %d-%d", type, min, max);
+            continue;
+        }
+
+        AclRange::add(type, min, max, newRange.second);
+    }
+
+    for (auto &creation: creations)
+    {
+        if (creation.ok)
+        {
+            creation.ok = creation.rule->queueCreateRule(entryBulker);
+        }
+    }
+    entryBulker.flush();
+
+    for (auto &creation: creations)
+    {
+        auto &rule = creation.rule;
+        string rule_id = rule->getId();
+
+        if (creation.ok && rule->createRulePost())
+        {
+            sai_object_id_t table_oid = getTableById(creation.table_id);
+            m_AclTables[table_oid].rules[rule_id] = rule;
+            SWSS_LOG_NOTICE("Successfully created ACL rule %s in table %s",
+                    rule_id.c_str(), creation.table_id.c_str());
+
+            if (rule->hasCounter())
+            {
+                registerFlexCounter(*rule);
+            }
+
+            setAclRuleStatus(creation.table_id, rule_id, AclObjectStatus::ACTIVE);
+            consumer.m_toSync.erase(creation.task);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Failed to create ACL rule %s in table %s",
+                    rule_id.c_str(), creation.table_id.c_str());
+            setAclRuleStatus(creation.table_id, rule_id, AclObjectStatus::PENDING_CREATION);
+        }
+    }
 }
 
 void AclOrch::doAclTableTypeTask(Consumer &consumer)
@@ -16,6 +16,7 @@
 #include "dtelorch.h"
 #include "observer.h"
 #include "flex_counter_manager.h"
+#include "bulker.h"
 
 #include "acltable.h"
 
@@ -228,6 +229,13 @@ public:
     static AclRange *create(sai_acl_range_type_t type, int min, int max);
     static bool remove(sai_acl_range_type_t type, int min, int max);
     static bool remove(sai_object_id_t *oids, int oidsCnt);
+
+    // Creation of the ranges through a bulker, see AclOrch::createAclRules
+    static bool exists(sai_acl_range_type_t type, int min, int max);
+    static bool canCreate(size_t pending);
+    static vector<sai_attribute_t> getAttributes(sai_acl_range_type_t type, int min, int max);
+    static void add(sai_acl_range_type_t type, int min, int max, sai_object_id_t oid);
+
     sai_object_id_t getOid()
     {
         return m_oid;
@@ -279,12 +287,23 @@ public:
     bool getCreateCounter() const;
 
     const vector<AclRangeConfig>& getRangeConfig() const;
+
+    // Creation of a new rule through the bulkers of AclOrch::createAclRules:
+    // the counter, then the entry once the counter and the ranges exist
+    virtual bool supportsBulkCreate() const;
+    void queueCreateCounter(ObjectBulker<sai_acl_api_t> &bulker);
+    bool createCounterPost();
+    bool queueCreateRule(ObjectBulker<sai_acl_api_t> &bulker);
+    bool createRulePost();
+
     static shared_ptr<AclRule> makeShared(AclOrch *acl, MirrorOrch *mirror, DTelOrch *dtel, const string& rule, const string& table, const KeyOpFieldsValuesTuple&);
     virtual ~AclRule() {}
 
 protected:
     virtual bool createCounter();
     virtual bool createRule();
+    bool getRuleAttributes(vector<sai_attribute_t> &rule_attrs);
+    vector<sai_attribute_t> getCounterAttributes() const;
     virtual bool removeCounter();
     virtual bool removeRanges();
     virtual bool removeRule();
@@ -311,6 +330,8 @@ protected:
     const AclTable* m_pTable {nullptr};
     sai_object_id_t m_ruleOid;
     sai_object_id_t m_counterOid;
+    // Status of the entry creation queued by queueCreateRule
+    sai_status_t m_createStatus = SAI_STATUS_NOT_EXECUTED;
     uint32_t m_priority;
     map <sai_acl_entry_attr_t, SaiAttrWrapper> m_actions;
     map <sai_acl_entry_attr_t, SaiAttrWrapper> m_matches;
@@ -319,6 +340,7 @@ protected:
 
     vector<AclRangeConfig> m_rangeConfig;
     vector<AclRange*> m_ranges;
+    vector<sai_object_id_t> m_rangeOids;
 
 private:
     bool m_createCounter;
@@ -345,12 +367,15 @@ public:
     bool validate();
     bool createRule();
     bool removeRule();
+    bool supportsBulkCreate() const override;
     void onUpdate(SubjectType, void *) override;
 
     bool activate();
     bool deactivate();
 
     bool update(const AclRule& updatedRule) override;
+
+    string getSessionName() const;
 protected:
     bool m_state {false};
     string m_sessionName;
@@ -365,6 +390,7 @@ public:
     bool validate();
     bool createRule();
     bool removeRule();
+    bool supportsBulkCreate() const override;
     void onUpdate(SubjectType, void *) override;
 
     bool activate();
@@ -568,6 +594,16 @@ private:
 
     string generateAclRuleIdentifierInCountersDb(const AclRule& rule) const;
 
+    // New rule of doAclRuleTask, created in bulk at the end of the task
+    struct AclRuleCreation
+    {
+        shared_ptr<AclRule> rule;
+        string table_id;
+        SyncMap::iterator task;
+        bool ok;
+    };
+    void createAclRules(Consumer &consumer, vector<AclRuleCreation> &creations);
+
     void setAclTableStatus(string table_name, AclObjectStatus status);
     void setAclRuleStatus(string table_name, string rule_name, AclObjectStatus status);
 
@@ -1,5 +1,6 @@
 #include "tokenize.h"
 #include "bufferorch.h"
+#include "bulker.h"
 #include "directory.h"
 #include "logger.h"
 #include "sai_serialize.h"
@@ -19,6 +20,7 @@ extern sai_buffer_api_t *sai_buffer_api;
 extern PortsOrch *gPortsOrch;
 extern Directory<Orch*> gDirectory;
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 extern string gMySwitchType;
 extern string gMyHostName;
 extern string gMyAsicName;
@@ -897,6 +899,11 @@ task_process_status BufferOrch::processQueue(KeyOpFieldsValuesTuple &tuple)
     sai_attribute_t attr;
     attr.id = SAI_QUEUE_ATTR_BUFFER_PROFILE_ID;
     attr.value.oid = sai_buffer_profile;
+
+    /* Resolve every queue of the key before touching any of them, so that the
+     * buffer profile is applied to all of them with one bulk set */
+    map<string, Port> ports;
+    vector<BufferObjectContext> queues;
     for (string port_name : port_names)
     {
         Port port;
@@ -943,72 +950,100 @@ task_process_status BufferOrch::processQueue(KeyOpFieldsValuesTuple &tuple)
                 queue_id = port.m_queue_ids[ind];
             }
 
-            if (need_update_sai)
+            queues.emplace_back(port_name, ind, queue_id);
+        }
+        ports[port_name] = port;
+    }
+
+    if (need_update_sai)
+    {
+        ObjectBulker<sai_queue_api_t> queueBulker(sai_queue_api, gSwitchId, gMaxBulkSize);
+        for (auto &ctx : queues)
+        {
+            SWSS_LOG_DEBUG("Applying buffer profile:0x%" PRIx64 " to queue index:%zd, queue sai_id:0x%" PRIx64, sai_buffer_profile, ctx.index, ctx.object_id);
+            queueBulker.set_entry_attribute(&ctx.status, ctx.object_id, &attr);
+        }
+        queueBulker.flush();
+    }
+
+    task_process_status failed_status = task_process_status::task_success;
+    for (const auto &ctx : queues)
+    {
+        const string &port_name = ctx.port_name;
+        size_t ind = ctx.index;
+
+        if (need_update_sai)
+        {
+            if (ctx.status != SAI_STATUS_SUCCESS)
             {
-                SWSS_LOG_DEBUG("Applying buffer profile:0x%" PRIx64 " to queue index:%zd, queue sai_id:0x%" PRIx64, sai_buffer_profile, ind, queue_id);
-                sai_status_t sai_status = sai_queue_api->set_queue_attribute(queue_id, &attr);
-                if (sai_status != SAI_STATUS_SUCCESS)
-                {
-                    SWSS_LOG_ERROR("Failed to set queue's buffer profile attribute, status:%d", sai_status);
-                    task_process_status handle_status = handleSaiSetStatus(SAI_API_QUEUE, sai_status);
-                    if (handle_status != task_process_status::task_success)
-                    {
-                        return handle_status;
-                    }
-                }
-                // create/remove a port queue counter for the queue buffer.
-                // For VOQ chassis, flexcounterorch adds the Queue Counters for all egress and VOQ queues of all front panel and system ports
-                // to  the FLEX_COUNTER_DB irrespective of BUFFER_QUEUE configuration. So Port Queue counter needs to be updated only for non VOQ switch.
-                else if (gMySwitchType != "voq")
+                SWSS_LOG_ERROR("Failed to set queue's buffer profile attribute, status:%d", ctx.status);
+                task_process_status handle_status = handleSaiSetStatus(SAI_API_QUEUE, ctx.status);
+                if (handle_status != task_process_status::task_success)
                 {
-                    auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
-                    auto queues = tokens[1];
-                    if (op == SET_COMMAND &&
-                        (flexCounterOrch->getQueueCountersState() || flexCounterOrch->getQueueWatermarkCountersState()))
+                    /* The queues that were set are accounted below, the failed ones are set again on retry */
+                    if (op == SET_COMMAND)
                     {
-                        gPortsOrch->createPortBufferQueueCounters(port, queues);
+                        m_partiallyAppliedQueues.insert(key);
                     }
-                    else if (op == DEL_COMMAND &&
-                             (flexCounterOrch->getQueueCountersState() || flexCounterOrch->getQueueWatermarkCountersState()))
+                    if (failed_status == task_process_status::task_success)
                     {
-                        gPortsOrch->removePortBufferQueueCounters(port, queues);
+                        failed_status = handle_status;
                     }
+                    continue;
                 }
             }
-
-            /* when we apply buffer configuration we need to increase the ref counter of this port
-             * or decrease the ref counter for this port when we remove buffer cfg
-             * so for each priority cfg in each port we will increase/decrease the ref counter
-             * also we need to know when the set command is for creating a buffer cfg or modifying buffer cfg -
-             * we need to increase ref counter only on create flow.
-             * so we added a map that will help us to know what was the last command for this port and priority -
-             * if the last command was set command then it is a modify command and we dont need to increase the buffer counter
-             * all other cases (no last command exist or del command was the last command) it means that we need to increase the ref counter */
-            if (op == SET_COMMAND)
+            // create/remove a port queue counter for the queue buffer.
+            // For VOQ chassis, flexcounterorch adds the Queue Counters for all egress and VOQ queues of all front panel and system ports
+            // to  the FLEX_COUNTER_DB irrespective of BUFFER_QUEUE configuration. So Port Queue counter needs to be updated only for non VOQ switch.
+            else if (gMySwitchType != "voq")
             {
-                if (queue_port_flags[port_name][ind] != SET_COMMAND)
+                auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
+                /* Only the counters of the queue set here, a failed one gets them on retry */
+                auto queue_index = to_string(ind);
+                if (op == SET_COMMAND &&
+                    (flexCounterOrch->getQueueCountersState() || flexCounterOrch->getQueueWatermarkCountersState()))
                 {
-                    /* if the last operation was not "set" then it's create and not modify - need to increase ref counter */
-                    gPortsOrch->increasePortRefCount(port_name);
+                    gPortsOrch->createPortBufferQueueCounters(ports[port_name], queue_index);
+                }
+                else if (op == DEL_COMMAND &&
+                         (flexCounterOrch->getQueueCountersState() || flexCounterOrch->getQueueWatermarkCountersState()))
+                {
+                    gPortsOrch->removePortBufferQueueCounters(ports[port_name], queue_index);
                 }
             }
-            else if (op == DEL_COMMAND)
+        }
+
+        /* when we apply buffer configuration we need to increase the ref counter of this port
+         * or decrease the ref counter for this port when we remove buffer cfg
+         * so for each priority cfg in each port we will increase/decrease the ref counter
+         * also we need to know when the set command is for creating a buffer cfg or modifying buffer cfg -
+         * we need to increase ref counter only on create flow.
+         * so we added a map that will help us to know what was the last command for this port and priority -
+         * if the last command was set command then it is a modify command and we dont need to increase the buffer counter
+         * all other cases (no last command exist or del command was the last command) it means that we need to increase the ref counter */
+        if (op == SET_COMMAND)
+        {
+            if (queue_port_flags[port_name][ind] != SET_COMMAND)
             {
-                if (queue_port_flags[port_name][ind] == SET_COMMAND)
-		{
-                    /* we need to decrease ref counter only if the last operation was "SET_COMMAND" */
-                    gPortsOrch->decreasePortRefCount(port_name);
-                }
+                /* if the last operation was not "set" then it's create and not modify - need to increase ref counter */
+                gPortsOrch->increasePortRefCount(port_name);
             }
-            else
+        }
+        else if (op == DEL_COMMAND)
+        {
+            if (queue_port_flags[port_name][ind] == SET_COMMAND)
             {
-                SWSS_LOG_ERROR("operation value is not SET or DEL (op = %s)", op.c_str());
-                return task_process_status::task_invalid_entry;
+                /* we need to decrease ref counter only if the last operation was "SET_COMMAND" */
+                gPortsOrch->decreasePortRefCount(port_name);
             }
-            /* save the last command (set or delete) */
-            queue_port_flags[port_name][ind] = op;
-
         }
+        /* save the last command (set or delete) */
+        queue_port_flags[port_name][ind] = op;
+    }
+
+    if (failed_status != task_process_status::task_success)
+    {
+        return failed_status;
     }
 
     if (m_ready_list.find(key) != m_ready_list.end())
@@ -1093,8 +1128,15 @@ task_process_status BufferOrch::processPriorityGroup(KeyOpFieldsValuesTuple &tup
         if (doesObjectExist(m_buffer_type_maps, APP_BUFFER_PG_TABLE_NAME, key, buffer_profile_field_name, old_buffer_profile_name)
             && (old_buffer_profile_name == buffer_profile_name))
         {
-            SWSS_LOG_INFO("Skip setting buffer priority group %s to %s since it is not changed", key.c_str(), buffer_profile_name.c_str());
-            return task_process_status::task_success;
+            if (m_partiallyAppliedPgs.find(key) == m_partiallyAppliedPgs.end())
+            {
+                SWSS_LOG_INFO("Skip setting buffer priority group %s to %s since it is not changed", key.c_str(), buffer_profile_name.c_str());
+                return task_process_status::task_success;
+            }
+            else
+            {
+                m_partiallyAppliedPgs.erase(key);
+            }
         }
 
         SWSS_LOG_NOTICE("Set buffer PG %s to %s", key.c_str(), buffer_profile_name.c_str());
@@ -1112,6 +1154,7 @@ task_process_status BufferOrch::processPriorityGroup(KeyOpFieldsValuesTuple &tup
         sai_buffer_profile = SAI_NULL_OBJECT_ID;
         SWSS_LOG_NOTICE("Remove buffer PG %s", key.c_str());
         removeObject(m_buffer_type_maps, APP_BUFFER_PG_TABLE_NAME, key);
+        m_partiallyAppliedPgs.erase(key);
     }
     else
     {
@@ -1122,6 +1165,11 @@ task_process_status BufferOrch::processPriorityGroup(KeyOpFieldsValuesTuple &tup
     sai_attribute_t attr;
     attr.id = SAI_INGRESS_PRIORITY_GROUP_ATTR_BUFFER_PROFILE;
     attr.value.oid = sai_buffer_profile;
+
+    /* Resolve every PG of the key before touching any of them, so that the
+     * buffer profile is applied to all of them with one bulk set */
+    map<string, Port> ports;
+    vector<BufferObjectContext> pgs;
     for (string port_name : port_names)
     {
         Port port;
@@ -1139,75 +1187,98 @@ task_process_status BufferOrch::processPriorityGroup(KeyOpFieldsValuesTuple &tup
                 SWSS_LOG_ERROR("Invalid pg index specified:%zd", ind);
                 return task_process_status::task_invalid_entry;
             }
-            else
+            pgs.emplace_back(port_name, ind, port.m_priority_group_ids[ind]);
+        }
+        ports[port_name] = port;
+    }
+
+    if (need_update_sai)
+    {
+        ObjectBulker<sai_buffer_api_t> pgBulker(sai_buffer_api, gSwitchId, gMaxBulkSize);
+        for (auto &ctx : pgs)
+        {
+            SWSS_LOG_DEBUG("Applying buffer profile:0x%" PRIx64 " to port:%s pg index:%zd, pg sai_id:0x%" PRIx64, sai_buffer_profile, ctx.port_name.c_str(), ctx.index, ctx.object_id);
+            pgBulker.set_entry_attribute(&ctx.status, ctx.object_id, &attr);
+        }
+        pgBulker.flush();
+    }
+
+    task_process_status failed_status = task_process_status::task_success;
+    for (const auto &ctx : pgs)
+    {
+        const string &port_name = ctx.port_name;
+        size_t ind = ctx.index;
+
+        if (need_update_sai)
+        {
+            if (ctx.status != SAI_STATUS_SUCCESS)
             {
-                if (need_update_sai)
+                SWSS_LOG_ERROR("Failed to set port:%s pg:%zd buffer profile attribute, status:%d", port_name.c_str(), ind, ctx.status);
+                task_process_status handle_status = handleSaiSetStatus(SAI_API_BUFFER, ctx.status);
+                if (handle_status != task_process_status::task_success)
                 {
-                    sai_object_id_t pg_id;
-                    pg_id = port.m_priority_group_ids[ind];
-                    SWSS_LOG_DEBUG("Applying buffer profile:0x%" PRIx64 " to port:%s pg index:%zd, pg sai_id:0x%" PRIx64, sai_buffer_profile, port_name.c_str(), ind, pg_id);
-                    sai_status_t sai_status = sai_buffer_api->set_ingress_priority_group_attribute(pg_id, &attr);
-                    if (sai_status != SAI_STATUS_SUCCESS)
+                    /* The PGs that were set are accounted below, the failed ones are set again on retry */
+                    if (op == SET_COMMAND)
                     {
-                        SWSS_LOG_ERROR("Failed to set port:%s pg:%zd buffer profile attribute, status:%d", port_name.c_str(), ind, sai_status);
-                        task_process_status handle_status = handleSaiSetStatus(SAI_API_BUFFER, sai_status);
-                        if (handle_status != task_process_status::task_success)
-                        {
-                            return handle_status;
-                        }
+                        m_partiallyAppliedPgs.insert(key);
                     }
-                    // create or remove a port PG counter for the PG buffer
-                    else
+                    if (failed_status == task_process_status::task_success)
                     {
-                        auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
-                        auto pgs = tokens[1];
-                        if (op == SET_COMMAND &&
-                            (flexCounterOrch->getPgCountersState() || flexCounterOrch->getPgWatermarkCountersState()))
-                        {
-                            gPortsOrch->createPortBufferPgCounters(port, pgs);
-                        }
-                        else if (op == DEL_COMMAND &&
-                                 (flexCounterOrch->getPgCountersState() || flexCounterOrch->getPgWatermarkCountersState()))
-                        {
-                            gPortsOrch->removePortBufferPgCounters(port, pgs);
-                        }
+                        failed_status = handle_status;
                     }
+                    continue;
                 }
             }
-
-            /* when we apply buffer configuration we need to increase the ref counter of this port
-             * or decrease the ref counter for this port when we remove buffer cfg
-             * so for each priority cfg in each port we will increase/decrease the ref counter
-             * also we need to know when the set command is for creating a buffer cfg or modifying buffer cfg -
-             * we need to increase ref counter only on create flow.
-             * so we added a map that will help us to know what was the last command for this port and priority -
-             * if the last command was set command then it is a modify command and we dont need to increase the buffer counter
-             * all other cases (no last command exist or del command was the last command) it means that we need to increase the ref counter */
-            if (op == SET_COMMAND)
+            // create or remove a port PG counter for the PG buffer
+            else
             {
-                if (pg_port_flags[port_name][ind] != SET_COMMAND)
+                auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
+                /* Only the counters of the PG set here, a failed one gets them on retry */
+                auto pg_index = to_string(ind);
+                if (op == SET_COMMAND &&
+                    (flexCounterOrch->getPgCountersState() || flexCounterOrch->getPgWatermarkCountersState()))
                 {
-                    /* if the last operation was not "set" then it's create and not modify - need to increase ref counter */
-                    gPortsOrch->increasePortRefCount(port_name);
+                    gPortsOrch->createPortBufferPgCounters(ports[port_name], pg_index);
                 }
-            }
-            else if (op == DEL_COMMAND)
-            {
-                if (pg_port_flags[port_name][ind] == SET_COMMAND)
+                else if (op == DEL_COMMAND &&
+                         (flexCounterOrch->getPgCountersState() || flexCounterOrch->getPgWatermarkCountersState()))
                 {
-                    /* we need to decrease ref counter only if the last operation was "SET_COMMAND" */
-                    gPortsOrch->decreasePortRefCount(port_name);
+                    gPortsOrch->removePortBufferPgCounters(ports[port_name], pg_index);
                 }
             }
-            else
+        }
+
+        /* when we apply buffer configuration we need to increase the ref counter of this port
+         * or decrease the ref counter for this port when we remove buffer cfg
+         * so for each priority cfg in each port we will increase/decrease the ref counter
+         * also we need to know when the set command is for creating a buffer cfg or modifying buffer cfg -
+         * we need to increase ref counter only on create flow.
+         * so we added a map that will help us to know what was the last command for this port and priority -
+         * if the last command was set command then it is a modify command and we dont need to increase the buffer counter
+         * all other cases (no last command exist or del command was the last command) it means that we need to increase the ref counter */
+        if (op == SET_COMMAND)
+        {
+            if (pg_port_flags[port_name][ind] != SET_COMMAND)
             {
-                SWSS_LOG_ERROR("operation value is not SET or DEL (op = %s)", op.c_str());
-                return task_process_status::task_invalid_entry;
+                /* if the last operation was not "set" then it's create and not modify - need to increase ref counter */
+                gPortsOrch->increasePortRefCount(port_name);
             }
-            /* save the last command (set or delete) */
-            pg_port_flags[port_name][ind] = op;
-
         }
+        else if (op == DEL_COMMAND)
+        {
+            if (pg_port_flags[port_name][ind] == SET_COMMAND)
+            {
+                /* we need to decrease ref counter only if the last operation was "SET_COMMAND" */
+                gPortsOrch->decreasePortRefCount(port_name);
+            }
+        }
+        /* save the last command (set or delete) */
+        pg_port_flags[port_name][ind] = op;
+    }
+
+    if (failed_status != task_process_status::task_success)
+    {
+        return failed_status;
     }
 
     if (m_ready_list.find(key) != m_ready_list.end())
@@ -30,6 +30,19 @@ const string buffer_value_both              = "both";
 const string buffer_profile_list_field_name = "profile_list";
 const string buffer_headroom_type_field_name= "headroom_type";
 
+struct BufferObjectContext
+{
+    string port_name;
+    size_t index;
+    sai_object_id_t object_id;          // Queue or ingress priority group
+    sai_status_t status = SAI_STATUS_NOT_EXECUTED;
+
+    BufferObjectContext(const string &port_name, size_t index, sai_object_id_t object_id) :
+        port_name(port_name), index(index), object_id(object_id)
+    {
+    }
+};
+
 class BufferOrch : public Orch
 {
 public:
@@ -70,6 +83,7 @@ private:
 
     bool m_isBufferPoolWatermarkCounterIdListGenerated = false;
     set<string> m_partiallyAppliedQueues;
+    set<string> m_partiallyAppliedPgs;
 };
 #endif /* SWSS_BUFFORCH_H */
 
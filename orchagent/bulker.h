@@ -1,10 +1,18 @@
 #pragma once
 
 #include <assert.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 #include <stdexcept>
+#include <tuple>
 #include <boost/functional/hash.hpp>
 #include <sairedis.h>
 #include "sai.h"
@@ -39,6 +47,38 @@ typedef sai_status_t (*sai_bulk_set_inbound_routing_entry_attribute_fn) (
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
 
+typedef sai_status_t (*sai_bulk_get_outbound_ca_to_pa_entry_attribute_fn) (
+        _In_ uint32_t object_count,
+        _In_ const sai_outbound_ca_to_pa_entry_t *entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+typedef sai_status_t (*sai_bulk_get_pa_validation_entry_attribute_fn) (
+        _In_ uint32_t object_count,
+        _In_ const sai_pa_validation_entry_t *entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+typedef sai_status_t (*sai_bulk_get_outbound_routing_entry_attribute_fn) (
+        _In_ uint32_t object_count,
+        _In_ const sai_outbound_routing_entry_t *entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
+typedef sai_status_t (*sai_bulk_get_inbound_routing_entry_attribute_fn) (
+        _In_ uint32_t object_count,
+        _In_ const sai_inbound_routing_entry_t *entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
 static inline bool operator==(const sai_ip_prefix_t& a, const sai_ip_prefix_t& b)
 {
     if (a.addr_family != b.addr_family) return false;
@@ -139,6 +179,26 @@ static inline bool operator==(const sai_outbound_routing_entry_t& a, const sai_o
         ;
 }
 
+static inline bool operator==(const sai_nat_entry_key_t& a, const sai_nat_entry_key_t& b)
+{
+    return a.src_ip == b.src_ip
+        && a.dst_ip == b.dst_ip
+        && a.proto == b.proto
+        && a.l4_src_port == b.l4_src_port
+        && a.l4_dst_port == b.l4_dst_port
+        ;
+}
+
+static inline bool operator==(const sai_nat_entry_t& a, const sai_nat_entry_t& b)
+{
+    return a.switch_id == b.switch_id
+        && a.vr_id == b.vr_id
+        && a.nat_type == b.nat_type
+        && a.data.key == b.data.key
+        && a.data.mask == b.data.mask
+        ;
+}
+
 static inline std::size_t hash_value(const sai_ip_prefix_t& a)
 {
     size_t seed = 0;
@@ -276,6 +336,24 @@ namespace std
             return seed;
         }
     };
+
+    template <>
+    struct hash<sai_nat_entry_t>
+    {
+        size_t operator()(const sai_nat_entry_t& a) const noexcept
+        {
+            size_t seed = 0;
+            boost::hash_combine(seed, a.switch_id);
+            boost::hash_combine(seed, a.vr_id);
+            boost::hash_combine(seed, a.nat_type);
+            boost::hash_combine(seed, a.data.key.src_ip);
+            boost::hash_combine(seed, a.data.key.dst_ip);
+            boost::hash_combine(seed, a.data.key.proto);
+            boost::hash_combine(seed, a.data.key.l4_src_port);
+            boost::hash_combine(seed, a.data.key.l4_dst_port);
+            return seed;
+        }
+    };
 }
 
 // SAI typedef which is not available in SAI 1.5
@@ -298,6 +376,13 @@ typedef sai_status_t (*sai_bulk_set_fdb_entry_attribute_fn)(
         _In_ const sai_attribute_t *attr_list,
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
+typedef sai_status_t (*sai_bulk_get_fdb_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_fdb_entry_t *fdb_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
 
 template<typename T>
 struct SaiBulkerTraits { };
@@ -309,10 +394,12 @@ struct SaiBulkerTraits<sai_route_api_t>
     using api_t = sai_route_api_t;
     using create_entry_fn = sai_create_route_entry_fn;
     using remove_entry_fn = sai_remove_route_entry_fn;
+    using get_entry_attribute_fn = sai_get_route_entry_attribute_fn;
     using set_entry_attribute_fn = sai_set_route_entry_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_create_route_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_route_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_route_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_route_entry_attribute_fn;
 };
 
 template<>
@@ -322,10 +409,12 @@ struct SaiBulkerTraits<sai_fdb_api_t>
     using api_t = sai_fdb_api_t;
     using create_entry_fn = sai_create_fdb_entry_fn;
     using remove_entry_fn = sai_remove_fdb_entry_fn;
+    using get_entry_attribute_fn = sai_get_fdb_entry_attribute_fn;
     using set_entry_attribute_fn = sai_set_fdb_entry_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_create_fdb_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_fdb_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_fdb_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_fdb_entry_attribute_fn;
 };
 
 template<>
@@ -335,6 +424,7 @@ struct SaiBulkerTraits<sai_next_hop_group_api_t>
     using api_t = sai_next_hop_group_api_t;
     using create_entry_fn = sai_create_next_hop_group_member_fn;
     using remove_entry_fn = sai_remove_next_hop_group_member_fn;
+    using get_entry_attribute_fn = sai_get_next_hop_group_member_attribute_fn;
     using set_entry_attribute_fn = sai_set_next_hop_group_member_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_object_create_fn;
     using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
@@ -342,6 +432,137 @@ struct SaiBulkerTraits<sai_next_hop_group_api_t>
     //using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_acl_api_t>
+{
+    // One api for several object types, see the ObjectBulker constructor
+    using entry_t = sai_object_id_t;
+    using api_t = sai_acl_api_t;
+    using create_entry_fn = sai_create_acl_entry_fn;
+    using remove_entry_fn = sai_remove_acl_entry_fn;
+    using get_entry_attribute_fn = sai_get_acl_entry_attribute_fn;
+    using set_entry_attribute_fn = sai_set_acl_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_bridge_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_bridge_api_t;
+    using create_entry_fn = sai_create_bridge_port_fn;
+    using remove_entry_fn = sai_remove_bridge_port_fn;
+    using get_entry_attribute_fn = sai_get_bridge_port_attribute_fn;
+    using set_entry_attribute_fn = sai_set_bridge_port_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_vlan_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_vlan_api_t;
+    using create_entry_fn = sai_create_vlan_member_fn;
+    using remove_entry_fn = sai_remove_vlan_member_fn;
+    using get_entry_attribute_fn = sai_get_vlan_member_attribute_fn;
+    using set_entry_attribute_fn = sai_set_vlan_member_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_next_hop_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_next_hop_api_t;
+    using create_entry_fn = sai_create_next_hop_fn;
+    using remove_entry_fn = sai_remove_next_hop_fn;
+    using get_entry_attribute_fn = sai_get_next_hop_attribute_fn;
+    using set_entry_attribute_fn = sai_set_next_hop_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_tunnel_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_tunnel_api_t;
+    using create_entry_fn = sai_create_tunnel_map_entry_fn;
+    using remove_entry_fn = sai_remove_tunnel_map_entry_fn;
+    using get_entry_attribute_fn = sai_get_tunnel_map_entry_attribute_fn;
+    using set_entry_attribute_fn = sai_set_tunnel_map_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_router_interface_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_router_interface_api_t;
+    using create_entry_fn = sai_create_router_interface_fn;
+    using remove_entry_fn = sai_remove_router_interface_fn;
+    using get_entry_attribute_fn = sai_get_router_interface_attribute_fn;
+    using set_entry_attribute_fn = sai_set_router_interface_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_port_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_port_api_t;
+    using create_entry_fn = sai_create_port_fn;
+    using remove_entry_fn = sai_remove_port_fn;
+    using get_entry_attribute_fn = sai_get_port_attribute_fn;
+    using set_entry_attribute_fn = sai_set_port_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_system_port_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_system_port_api_t;
+    using create_entry_fn = sai_create_system_port_fn;
+    using remove_entry_fn = sai_remove_system_port_fn;
+    using get_entry_attribute_fn = sai_get_system_port_attribute_fn;
+    using set_entry_attribute_fn = sai_set_system_port_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_queue_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_queue_api_t;
+    using create_entry_fn = sai_create_queue_fn;
+    using remove_entry_fn = sai_remove_queue_fn;
+    using get_entry_attribute_fn = sai_get_queue_attribute_fn;
+    using set_entry_attribute_fn = sai_set_queue_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_buffer_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_buffer_api_t;
+    using create_entry_fn = sai_create_ingress_priority_group_fn;
+    using remove_entry_fn = sai_remove_ingress_priority_group_fn;
+    using get_entry_attribute_fn = sai_get_ingress_priority_group_attribute_fn;
+    using set_entry_attribute_fn = sai_set_ingress_priority_group_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_mpls_api_t>
 {
@@ -349,10 +570,12 @@ struct SaiBulkerTraits<sai_mpls_api_t>
     using api_t = sai_mpls_api_t;
     using create_entry_fn = sai_create_inseg_entry_fn;
     using remove_entry_fn = sai_remove_inseg_entry_fn;
+    using get_entry_attribute_fn = sai_get_inseg_entry_attribute_fn;
     using set_entry_attribute_fn = sai_set_inseg_entry_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_create_inseg_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_inseg_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_inseg_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_inseg_entry_attribute_fn;
 };
 
 template<>
@@ -362,10 +585,27 @@ struct SaiBulkerTraits<sai_neighbor_api_t>
     using api_t = sai_neighbor_api_t;
     using create_entry_fn = sai_create_neighbor_entry_fn;
     using remove_entry_fn = sai_remove_neighbor_entry_fn;
+    using get_entry_attribute_fn = sai_get_neighbor_entry_attribute_fn;
     using set_entry_attribute_fn = sai_set_neighbor_entry_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_create_neighbor_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_neighbor_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_neighbor_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_neighbor_entry_attribute_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_nat_api_t>
+{
+    using entry_t = sai_nat_entry_t;
+    using api_t = sai_nat_api_t;
+    using create_entry_fn = sai_create_nat_entry_fn;
+    using remove_entry_fn = sai_remove_nat_entry_fn;
+    using get_entry_attribute_fn = sai_get_nat_entry_attribute_fn;
+    using set_entry_attribute_fn = sai_set_nat_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_create_nat_entry_fn;
+    using bulk_remove_entry_fn = sai_bulk_remove_nat_entry_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_set_nat_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_nat_entry_attribute_fn;
 };
 
 template<>
@@ -375,11 +615,26 @@ struct SaiBulkerTraits<sai_dash_vnet_api_t>
     using api_t = sai_dash_vnet_api_t;
     using create_entry_fn = sai_create_vnet_fn;
     using remove_entry_fn = sai_remove_vnet_fn;
+    using get_entry_attribute_fn = sai_get_vnet_attribute_fn;
     using set_entry_attribute_fn = sai_set_vnet_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_object_create_fn;
     using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_dash_acl_api_t>
+{
+    // One api for ACL groups and rules, see the ObjectBulker constructor
+    using entry_t = sai_object_id_t;
+    using api_t = sai_dash_acl_api_t;
+    using create_entry_fn = sai_create_dash_acl_rule_fn;
+    using remove_entry_fn = sai_remove_dash_acl_rule_fn;
+    using get_entry_attribute_fn = sai_get_dash_acl_rule_attribute_fn;
+    using set_entry_attribute_fn = sai_set_dash_acl_rule_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_dash_inbound_routing_api_t>
 {
@@ -387,10 +642,12 @@ struct SaiBulkerTraits<sai_dash_inbound_routing_api_t>
     using api_t = sai_dash_inbound_routing_api_t;
     using create_entry_fn = sai_create_inbound_routing_entry_fn;
     using remove_entry_fn = sai_remove_inbound_routing_entry_fn;
+    using get_entry_attribute_fn = sai_get_inbound_routing_entry_attribute_fn;
     using set_entry_attribute_fn = sai_set_inbound_routing_entry_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_create_inbound_routing_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_inbound_routing_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_inbound_routing_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_inbound_routing_entry_attribute_fn;
 };
 
 template<>
@@ -400,10 +657,12 @@ struct SaiBulkerTraits<sai_dash_outbound_ca_to_pa_api_t>
     using api_t = sai_dash_outbound_ca_to_pa_api_t;
     using create_entry_fn = sai_create_outbound_ca_to_pa_entry_fn;
     using remove_entry_fn = sai_remove_outbound_ca_to_pa_entry_fn;
+    using get_entry_attribute_fn = sai_get_outbound_ca_to_pa_entry_attribute_fn;
     using set_entry_attribute_fn = sai_set_outbound_ca_to_pa_entry_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_create_outbound_ca_to_pa_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_outbound_ca_to_pa_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_outbound_ca_to_pa_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_outbound_ca_to_pa_entry_attribute_fn;
 };
 
 template<>
@@ -413,10 +672,12 @@ struct SaiBulkerTraits<sai_dash_pa_validation_api_t>
     using api_t = sai_dash_pa_validation_api_t;
     using create_entry_fn = sai_create_pa_validation_entry_fn;
     using remove_entry_fn = sai_remove_pa_validation_entry_fn;
+    using get_entry_attribute_fn = sai_get_pa_validation_entry_attribute_fn;
     using set_entry_attribute_fn = sai_set_pa_validation_entry_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_create_pa_validation_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_pa_validation_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_pa_validation_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_pa_validation_entry_attribute_fn;
 };
 
 template<>
@@ -426,10 +687,286 @@ struct SaiBulkerTraits<sai_dash_outbound_routing_api_t>
     using api_t = sai_dash_outbound_routing_api_t;
     using create_entry_fn = sai_create_outbound_routing_entry_fn;
     using remove_entry_fn = sai_remove_outbound_routing_entry_fn;
+    using get_entry_attribute_fn = sai_get_outbound_routing_entry_attribute_fn;
     using set_entry_attribute_fn = sai_set_outbound_routing_entry_attribute_fn;
     using bulk_create_entry_fn = sai_bulk_create_outbound_routing_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_outbound_routing_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_outbound_routing_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_outbound_routing_entry_attribute_fn;
+};
+
+/*
+ * Attributes of a queued bulker entry, stored in the BulkerArena of the
+ * bulker. Only the sai_attribute_t are copied: list payloads still belong
+ * to the caller, as with the SAI API.
+ */
+class BulkerAttrList
+{
+public:
+    BulkerAttrList() = default;
+    BulkerAttrList(sai_attribute_t *attrs, uint32_t count) : m_attrs(attrs), m_count(count) {}
+
+    const sai_attribute_t *data() const { return m_attrs; }
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+    const sai_attribute_t &operator[](size_t i) const { return m_attrs[i]; }
+    const sai_attribute_t *begin() const { return m_attrs; }
+    const sai_attribute_t *end() const { return m_attrs + m_count; }
+
+private:
+    sai_attribute_t    *m_attrs = nullptr;
+    uint32_t            m_count = 0;
+};
+
+/*
+ * Bump allocator for the attributes queued in a bulker, released wholesale
+ * when the bulker is flushed or cleared.
+ *
+ * No memory is taken until the first create is queued. The chunks then
+ * start at MIN_CHUNK_BYTES and double up to MAX_CHUNK_BYTES, so a bulker
+ * queuing a few entries holds a few KB. Up to RETAINED_BYTES of chunks are
+ * kept for the next flush, so a steady flow of bulks does not allocate:
+ * that is the memory a busy bulker keeps while idle.
+ */
+class BulkerArena
+{
+public:
+    static constexpr size_t MIN_CHUNK_BYTES = 4 * 1024;
+    static constexpr size_t MAX_CHUNK_BYTES = 64 * 1024;
+    static constexpr size_t RETAINED_BYTES = 256 * 1024;
+
+    BulkerArena() = default;
+
+    BulkerArena(BulkerArena &&other) noexcept :
+        m_chunks(std::move(other.m_chunks)),
+        m_current(other.m_current),
+        m_used(other.m_used),
+        m_chunkAllocations(other.m_chunkAllocations)
+    {
+        other.m_chunks.clear();
+        other.m_current = 0;
+        other.m_used = 0;
+    }
+
+    BulkerArena(const BulkerArena &) = delete;
+    BulkerArena &operator=(const BulkerArena &) = delete;
+
+    BulkerAttrList copy(const sai_attribute_t *attr_list, uint32_t attr_count)
+    {
+        if (attr_count == 0)
+        {
+            return BulkerAttrList();
+        }
+
+        auto attrs = static_cast<sai_attribute_t *>(allocate(attr_count * sizeof(sai_attribute_t), alignof(sai_attribute_t)));
+        std::copy(attr_list, attr_list + attr_count, attrs);
+        return BulkerAttrList(attrs, attr_count);
+    }
+
+    void reset()
+    {
+        size_t retained = 0;
+        size_t kept = 0;
+        while (kept < m_chunks.size() && retained + m_chunks[kept].size <= RETAINED_BYTES)
+        {
+            retained += m_chunks[kept].size;
+            kept++;
+        }
+
+        m_chunks.resize(kept);
+        m_current = 0;
+        m_used = 0;
+    }
+
+    /* Number of chunks allocated from the heap so far */
+    size_t chunk_allocations() const
+    {
+        return m_chunkAllocations;
+    }
+
+    /* Bytes of the chunks currently held */
+    size_t capacity() const
+    {
+        size_t bytes = 0;
+        for (const auto &chunk : m_chunks)
+        {
+            bytes += chunk.size;
+        }
+        return bytes;
+    }
+
+private:
+    struct Chunk
+    {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    std::vector<Chunk>  m_chunks;
+    size_t              m_current = 0;  // Chunk being filled
+    size_t              m_used = 0;     // Bytes used in the current chunk
+    size_t              m_chunkAllocations = 0;
+
+    void *allocate(size_t bytes, size_t align)
+    {
+        while (m_current < m_chunks.size())
+        {
+            size_t offset = (m_used + align - 1) & ~(align - 1);
+            if (offset + bytes <= m_chunks[m_current].size)
+            {
+                m_used = offset + bytes;
+                return m_chunks[m_current].data.get() + offset;
+            }
+
+            m_current++;
+            m_used = 0;
+        }
+
+        // Each chunk doubles the previous one, up to MAX_CHUNK_BYTES
+        size_t size = MIN_CHUNK_BYTES;
+        for (size_t i = 0; i < m_chunks.size() && size < MAX_CHUNK_BYTES; i++)
+        {
+            size *= 2;
+        }
+        size = std::max(size, bytes);
+        m_chunks.push_back({ std::unique_ptr<char[]>(new char[size]), size });
+        m_chunkAllocations++;
+        m_current = m_chunks.size() - 1;
+        m_used = bytes;
+        return m_chunks[m_current].data.get();
+    }
+};
+
+/*
+ * Completion of an asynchronous bulker flush (flush_async).
+ *
+ * The SAI bulk calls are made from the BulkWorker thread, which only
+ * touches the flushed batch and the status and attribute buffers its
+ * entries point to. The orch must leave those buffers alone until the
+ * completion is ready.
+ *
+ * The callbacks run on the thread which calls wait() or poll(), i.e. the
+ * execution group thread of the orch. They may read the results and update
+ * any state of that orch, under the same rules as its doTask().
+ */
+class BulkCompletion
+{
+public:
+    void add_callback(std::function<void()> callback)
+    {
+        m_callbacks.push_back(std::move(callback));
+    }
+
+    bool ready() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_done;
+    }
+
+    /* Run the callbacks if the flush is done */
+    bool poll()
+    {
+        if (!ready())
+        {
+            return false;
+        }
+
+        run_callbacks();
+        return true;
+    }
+
+    void wait()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_done; });
+        }
+
+        run_callbacks();
+    }
+
+private:
+    friend class BulkWorker;
+
+    mutable std::mutex                      m_mutex;
+    std::condition_variable                 m_cv;
+    bool                                    m_done = false;
+    std::vector<std::function<void()>>      m_callbacks;
+
+    void complete()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_done = true;
+        }
+        m_cv.notify_all();
+    }
+
+    void run_callbacks()
+    {
+        std::vector<std::function<void()>> callbacks;
+        callbacks.swap(m_callbacks);
+        for (auto &callback : callbacks)
+        {
+            callback();
+        }
+    }
+};
+
+/*
+ * Thread running the asynchronous bulker flushes, one at a time in
+ * submission order, shared by all the orchs. sairedis serializes its API
+ * calls, so a bulk in flight only delays the SAI calls of other threads.
+ */
+class BulkWorker
+{
+public:
+    static BulkWorker &instance()
+    {
+        // Never destroyed, the thread lives as long as the process
+        static BulkWorker *worker = new BulkWorker();
+        return *worker;
+    }
+
+    std::shared_ptr<BulkCompletion> submit(std::function<void()> work)
+    {
+        auto completion = std::make_shared<BulkCompletion>();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.emplace_back(std::move(work), completion);
+        }
+        m_cv.notify_one();
+        return completion;
+    }
+
+private:
+    std::mutex                              m_mutex;
+    std::condition_variable                 m_cv;
+    std::deque<std::pair<
+            std::function<void()>,
+            std::shared_ptr<BulkCompletion>
+    >>                                      m_queue;
+    std::thread                             m_thread;
+
+    BulkWorker() : m_thread(&BulkWorker::run, this)
+    {
+    }
+
+    void run()
+    {
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return !m_queue.empty(); });
+            auto item = std::move(m_queue.front());
+            m_queue.pop_front();
+            lock.unlock();
+
+            item.first();
+            item.second->complete();
+        }
+    }
 };
 
 template <typename T>
@@ -470,8 +1007,7 @@ public:
             return *object_status;
         }
 
-        auto& attrs = it->second.first;
-        attrs.insert(attrs.end(), attr_list, attr_list + attr_count);
+        it->second.first = arena.copy(attr_list, attr_count);
         it->second.second = object_status;
         SWSS_LOG_INFO("EntityBulker.create_entry %zu, %zu, %d\n", creating_entries.size(), it->second.first.size(), inserted);
         *object_status = SAI_STATUS_NOT_EXECUTED;
@@ -547,6 +1083,28 @@ public:
         *object_status = SAI_STATUS_NOT_EXECUTED;
     }
 
+    /*
+     * Queue a read of the attributes of attr_list, which must stay valid
+     * until flush(). Gets are flushed last, after the other queued
+     * operations, in the order they were queued.
+     */
+    void get_entry_attribute(
+        _Out_ sai_status_t *object_status,
+        _In_ const Te *entry,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+    {
+        assert(object_status);
+        if (!object_status) throw std::invalid_argument("object_status is null");
+        assert(entry);
+        if (!entry) throw std::invalid_argument("entry is null");
+        assert(attr_list);
+        if (!attr_list) throw std::invalid_argument("attr_list is null");
+
+        getting_entries.emplace_back(*entry, attr_count, attr_list, object_status);
+        *object_status = SAI_STATUS_NOT_EXECUTED;
+    }
+
     void flush()
     {
         // Removing
@@ -580,6 +1138,11 @@ public:
             std::vector<sai_attribute_t const*> tss;
             std::vector<uint32_t> cs;
 
+            size_t batch = std::min(creating_entries.size(), max_bulk_size);
+            rs.reserve(batch);
+            tss.reserve(batch);
+            cs.reserve(batch);
+
             for (auto const& i: creating_entries)
             {
                 auto const& entry = i.first;
@@ -600,6 +1163,7 @@ public:
             flush_creating_entries(rs, tss, cs);
 
             creating_entries.clear();
+            arena.reset();
         }
 
         // Setting
@@ -634,13 +1198,62 @@ public:
 
             setting_entries.clear();
         }
-    }
 
-    void clear()
+        // Getting
+        if (!getting_entries.empty())
+        {
+            std::vector<Te> rs;
+            std::vector<uint32_t> cs;
+            std::vector<sai_attribute_t*> tss;
+            std::vector<sai_status_t*> status_vector;
+
+            for (auto const& i: getting_entries)
+            {
+                rs.push_back(std::get<0>(i));
+                cs.push_back(std::get<1>(i));
+                tss.push_back(std::get<2>(i));
+                status_vector.push_back(std::get<3>(i));
+
+                if (rs.size() >= max_bulk_size)
+                {
+                    flush_getting_entries(rs, cs, tss, status_vector);
+                }
+            }
+            flush_getting_entries(rs, cs, tss, status_vector);
+
+            getting_entries.clear();
+        }
+    }
+
+    /*
+     * Flush the queued attribute reads on the BulkWorker thread. Their
+     * statuses and attributes are written before the completion is ready
+     * and must not be used before. Entries queued meanwhile go to the next
+     * flush.
+     *
+     * Only reads are flushed asynchronously: the result of a create, remove
+     * or set decides the orch state the next tasks depend on, so those are
+     * flushed with flush(). Today the only user is the NAT hit bit polling.
+     */
+    std::shared_ptr<BulkCompletion> flush_async()
+    {
+        if (!removing_entries.empty() || !creating_entries.empty() || !setting_entries.empty())
+        {
+            throw std::logic_error("Only attribute reads can be flushed asynchronously");
+        }
+
+        auto batch = std::make_shared<EntityBulker>(std::move(*this));
+        clear();
+        return BulkWorker::instance().submit([batch]() { batch->flush(); });
+    }
+
+    void clear()
     {
         removing_entries.clear();
         creating_entries.clear();
         setting_entries.clear();
+        getting_entries.clear();
+        arena.reset();
     }
 
     size_t creating_entries_count() const
@@ -658,6 +1271,11 @@ public:
         return removing_entries.size();
     }
 
+    size_t getting_entries_count() const
+    {
+        return getting_entries.size();
+    }
+
     size_t creating_entries_count(const Te& entry) const
     {
         return creating_entries.count(entry);
@@ -672,11 +1290,13 @@ private:
     std::unordered_map<                                     // A map of
             Te,                                             // entry ->
             std::pair<
-                    std::vector<sai_attribute_t>,           // (attributes, OUT object_status)
+                    BulkerAttrList,                         // (attributes, OUT object_status)
                     sai_status_t *
             >
     >                                                       creating_entries;
 
+    BulkerArena                                             arena;      // Attributes of creating_entries
+
     std::unordered_map<                                     // A map of
             Te,                                             // entry ->
             std::vector<                                    //     vector of attribute and status
@@ -692,11 +1312,28 @@ private:
             sai_status_t *                                  // OUT object_status
     >                                                       removing_entries;
 
+    std::vector<std::tuple<                                 // A vector of
+            Te,                                             // (entry,
+            uint32_t,                                       //  attr_count,
+            sai_attribute_t *,                              //  INOUT attr_list,
+            sai_status_t *                                  //  OUT object_status)
+    >>                                                      getting_entries;
+
     size_t max_bulk_size;
 
-    typename Ts::bulk_create_entry_fn                       create_entries;
-    typename Ts::bulk_remove_entry_fn                       remove_entries;
-    typename Ts::bulk_set_entry_attribute_fn                set_entries_attribute;
+    typename Ts::bulk_create_entry_fn                       create_entries = nullptr;
+    typename Ts::bulk_remove_entry_fn                       remove_entries = nullptr;
+    typename Ts::bulk_set_entry_attribute_fn                set_entries_attribute = nullptr;
+    typename Ts::bulk_get_entry_attribute_fn                get_entries_attribute = nullptr;
+
+    // Used when the api has no bulk function for the operation
+    typename Ts::create_entry_fn                            create_entry_single = nullptr;
+    typename Ts::remove_entry_fn                            remove_entry_single = nullptr;
+    typename Ts::set_entry_attribute_fn                     set_entry_attribute_single = nullptr;
+    typename Ts::get_entry_attribute_fn                     get_entry_attribute_single = nullptr;
+
+    // Cleared when the bulk get is not implemented, gets are then issued one by one
+    bool                                                    bulk_get_supported = true;
 
     sai_status_t flush_removing_entries(
         _Inout_ std::vector<Te> &rs)
@@ -707,7 +1344,26 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*remove_entries)((uint32_t)count, rs.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+        if (remove_entries)
+        {
+            status = (*remove_entries)((uint32_t)count, rs.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        }
+
+        if (remove_entry_single && (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED))
+        {
+            // No bulk api for this entry type, the removals are issued back to back
+            status = SAI_STATUS_SUCCESS;
+            for (size_t i = 0; i < count; i++)
+            {
+                statuses[i] = (*remove_entry_single)(&rs[i]);
+                if (statuses[i] != SAI_STATUS_SUCCESS)
+                {
+                    status = statuses[i];
+                }
+            }
+        }
+
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("EntityBulker.flush removing_entries %zu\n", count);
@@ -744,8 +1400,27 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*create_entries)((uint32_t)count, rs.data(), cs.data(), tss.data()
-            , SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+        if (create_entries)
+        {
+            status = (*create_entries)((uint32_t)count, rs.data(), cs.data(), tss.data()
+                , SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        }
+
+        if (create_entry_single && (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED))
+        {
+            // No bulk api for this entry type, the creations are issued back to back
+            status = SAI_STATUS_SUCCESS;
+            for (size_t i = 0; i < count; i++)
+            {
+                statuses[i] = (*create_entry_single)(&rs[i], cs[i], tss[i]);
+                if (statuses[i] != SAI_STATUS_SUCCESS)
+                {
+                    status = statuses[i];
+                }
+            }
+        }
+
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("EntityBulker.flush creating_entries %zu\n", count);
@@ -784,8 +1459,27 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*set_entries_attribute)((uint32_t)count, rs.data(), ts.data()
-            , SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+        if (set_entries_attribute)
+        {
+            status = (*set_entries_attribute)((uint32_t)count, rs.data(), ts.data()
+                , SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        }
+
+        if (set_entry_attribute_single && (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED))
+        {
+            // No bulk api for this entry type, the sets are issued back to back
+            status = SAI_STATUS_SUCCESS;
+            for (size_t i = 0; i < count; i++)
+            {
+                statuses[i] = (*set_entry_attribute_single)(&rs[i], &ts[i]);
+                if (statuses[i] != SAI_STATUS_SUCCESS)
+                {
+                    status = statuses[i];
+                }
+            }
+        }
+
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("EntityBulker.flush setting_entries, count %zu\n", count);
@@ -812,6 +1506,66 @@ private:
 
         return status;
     }
+
+    sai_status_t flush_getting_entries(
+        _Inout_ std::vector<Te> &rs,
+        _Inout_ std::vector<uint32_t> &cs,
+        _Inout_ std::vector<sai_attribute_t*> &tss,
+        _Inout_ std::vector<sai_status_t*> &status_vector)
+    {
+        if (rs.empty())
+        {
+            return SAI_STATUS_SUCCESS;
+        }
+        size_t count = rs.size();
+        std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+        if (get_entries_attribute && bulk_get_supported)
+        {
+            status = (*get_entries_attribute)((uint32_t)count, rs.data(), cs.data(), tss.data()
+                , SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+            {
+                SWSS_LOG_NOTICE("EntityBulker.flush bulk get is not supported, getting entries one by one");
+                bulk_get_supported = false;
+            }
+        }
+
+        if (!get_entries_attribute || !bulk_get_supported)
+        {
+            status = SAI_STATUS_SUCCESS;
+            for (size_t ir = 0; ir < count; ir++)
+            {
+                statuses[ir] = (*get_entry_attribute_single)(&rs[ir], cs[ir], tss[ir]);
+                if (statuses[ir] != SAI_STATUS_SUCCESS)
+                {
+                    status = statuses[ir];
+                }
+            }
+        }
+
+        if (status == SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("EntityBulker.flush getting_entries, count %zu\n", count);
+        }
+        else
+        {
+            SWSS_LOG_INFO("EntityBulker.flush get entry attribute failed for some entries, number of entries to get: %zu, status: %s",
+                            count, sai_serialize_status(status).c_str());
+        }
+
+        for (size_t ir = 0; ir < count; ir++)
+        {
+            *status_vector[ir] = statuses[ir];
+        }
+
+        rs.clear();
+        cs.clear();
+        tss.clear();
+        status_vector.clear();
+
+        return status;
+    }
 };
 
 template <>
@@ -821,19 +1575,25 @@ inline EntityBulker<sai_route_api_t>::EntityBulker(sai_route_api_t *api, size_t
     create_entries = api->create_route_entries;
     remove_entries = api->remove_route_entries;
     set_entries_attribute = api->set_route_entries_attribute;
+    get_entries_attribute = api->get_route_entries_attribute;
+    get_entry_attribute_single = api->get_route_entry_attribute;
 }
 
 template <>
 inline EntityBulker<sai_fdb_api_t>::EntityBulker(sai_fdb_api_t *api, size_t max_bulk_size) :
     max_bulk_size(max_bulk_size)
 {
-    // TODO: implement after create_fdb_entries() is available in SAI
-    throw std::logic_error("Not implemented");
+    // TODO: use the bulk functions after create_fdb_entries() is available in SAI
     /*
     create_entries = api->create_fdb_entries;
     remove_entries = api->remove_fdb_entries;
     set_entries_attribute = api->set_fdb_entries_attribute;
+    get_entries_attribute = api->get_fdb_entries_attribute;
     */
+    create_entry_single = api->create_fdb_entry;
+    remove_entry_single = api->remove_fdb_entry;
+    set_entry_attribute_single = api->set_fdb_entry_attribute;
+    get_entry_attribute_single = api->get_fdb_entry_attribute;
 }
 
 template <>
@@ -843,6 +1603,8 @@ inline EntityBulker<sai_mpls_api_t>::EntityBulker(sai_mpls_api_t *api, size_t ma
     create_entries = api->create_inseg_entries;
     remove_entries = api->remove_inseg_entries;
     set_entries_attribute = api->set_inseg_entries_attribute;
+    get_entries_attribute = api->get_inseg_entries_attribute;
+    get_entry_attribute_single = api->get_inseg_entry_attribute;
 }
 
 template <>
@@ -852,6 +1614,21 @@ inline EntityBulker<sai_neighbor_api_t>::EntityBulker(sai_neighbor_api_t *api, s
     create_entries = api->create_neighbor_entries;
     remove_entries = api->remove_neighbor_entries;
     set_entries_attribute = api->set_neighbor_entries_attribute;
+    get_entries_attribute = api->get_neighbor_entries_attribute;
+    get_entry_attribute_single = api->get_neighbor_entry_attribute;
+}
+
+template <>
+inline EntityBulker<sai_nat_api_t>::EntityBulker(sai_nat_api_t *api, size_t max_bulk_size) :
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_nat_entries;
+    remove_entries = api->remove_nat_entries;
+    set_entries_attribute = api->set_nat_entries_attribute;
+    get_entries_attribute = api->get_nat_entries_attribute;
+    create_entry_single = api->create_nat_entry;
+    remove_entry_single = api->remove_nat_entry;
+    get_entry_attribute_single = api->get_nat_entry_attribute;
 }
 
 template <>
@@ -860,6 +1637,8 @@ inline EntityBulker<sai_dash_inbound_routing_api_t>::EntityBulker(sai_dash_inbou
     create_entries = api->create_inbound_routing_entries;
     remove_entries = api->remove_inbound_routing_entries;
     set_entries_attribute = nullptr;
+    get_entries_attribute = nullptr;
+    get_entry_attribute_single = api->get_inbound_routing_entry_attribute;
 }
 
 template <>
@@ -868,6 +1647,8 @@ inline EntityBulker<sai_dash_outbound_ca_to_pa_api_t>::EntityBulker(sai_dash_out
     create_entries = api->create_outbound_ca_to_pa_entries;
     remove_entries = api->remove_outbound_ca_to_pa_entries;
     set_entries_attribute = nullptr;
+    get_entries_attribute = nullptr;
+    get_entry_attribute_single = api->get_outbound_ca_to_pa_entry_attribute;
 }
 
 template <>
@@ -876,6 +1657,8 @@ inline EntityBulker<sai_dash_pa_validation_api_t>::EntityBulker(sai_dash_pa_vali
     create_entries = api->create_pa_validation_entries;
     remove_entries = api->remove_pa_validation_entries;
     set_entries_attribute = nullptr;
+    get_entries_attribute = nullptr;
+    get_entry_attribute_single = api->get_pa_validation_entry_attribute;
 }
 
 template <>
@@ -884,8 +1667,28 @@ inline EntityBulker<sai_dash_outbound_routing_api_t>::EntityBulker(sai_dash_outb
     create_entries = api->create_outbound_routing_entries;
     remove_entries = api->remove_outbound_routing_entries;
     set_entries_attribute = nullptr;
+    get_entries_attribute = nullptr;
+    get_entry_attribute_single = api->get_outbound_routing_entry_attribute;
 }
 
+/*
+ * The generic SAI bulk functions, used by ObjectBulker for the object types
+ * without a bulk function in their api table. Held in a table like the SAI
+ * apis, so that they can be hooked the same way.
+ */
+struct BulkerGenericApi
+{
+    decltype(&sai_bulk_object_create)   bulk_object_create = &sai_bulk_object_create;
+    decltype(&sai_bulk_object_remove)   bulk_object_remove = &sai_bulk_object_remove;
+    decltype(&sai_bulk_get_attribute)   bulk_get_attribute = &sai_bulk_get_attribute;
+
+    static BulkerGenericApi &instance()
+    {
+        static BulkerGenericApi api;
+        return api;
+    }
+};
+
 template <typename T>
 class ObjectBulker
 {
@@ -898,6 +1701,13 @@ public:
         throw std::logic_error("Not implemented");
     }
 
+    // For the apis covering several object types
+    ObjectBulker(typename Ts::api_t* api, sai_object_type_t object_type, sai_object_id_t switch_id, size_t max_bulk_size) :
+        max_bulk_size(max_bulk_size)
+    {
+        throw std::logic_error("Not implemented");
+    }
+
     sai_status_t create_entry(
         _Out_ sai_object_id_t *object_id,
         _In_ uint32_t attr_count,
@@ -908,7 +1718,7 @@ public:
         assert(attr_list);
         if (!attr_list) throw std::invalid_argument("attr_list is null");
 
-        creating_entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(object_id), std::forward_as_tuple(attr_list, attr_list + attr_count));
+        creating_entries.emplace_back(object_id, arena.copy(attr_list, attr_count));
 
         auto& last_attrs = std::get<1>(creating_entries.back());
         SWSS_LOG_INFO("ObjectBulker.create_entry %zu, %zu, %u\n", creating_entries.size(), last_attrs.size(), last_attrs[0].id);
@@ -917,6 +1727,21 @@ public:
         return SAI_STATUS_NOT_EXECUTED;
     }
 
+    // Same as above, the status of the creation is reported as well
+    sai_status_t create_entry(
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_status,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        assert(object_status);
+        if (!object_status) throw std::invalid_argument("object_status is null");
+
+        creating_statuses[object_id] = object_status;
+        *object_status = create_entry(object_id, attr_count, attr_list);
+        return *object_status;
+    }
+
     sai_status_t remove_entry(
         _Out_ sai_status_t *object_status,
         _In_ sai_object_id_t object_id)
@@ -937,29 +1762,49 @@ public:
         return *object_status;
     }
 
-    // TODO: wait until available in SAI
     /*
-    sai_status_t set_entry_attribute(
+     * Queue a read of the attributes of attr_list, which must stay valid
+     * until flush(). Gets are flushed last, after the other queued
+     * operations, in the order they were queued.
+     */
+    void get_entry_attribute(
+        _Out_ sai_status_t *object_status,
+        _In_ sai_object_id_t object_id,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+    {
+        assert(object_status);
+        if (!object_status) throw std::invalid_argument("object_status is null");
+        assert(object_id != SAI_NULL_OBJECT_ID);
+        if (object_id == SAI_NULL_OBJECT_ID) throw std::invalid_argument("object_id is null");
+        assert(attr_list);
+        if (!attr_list) throw std::invalid_argument("attr_list is null");
+
+        getting_entries.emplace_back(object_id, attr_count, attr_list, object_status);
+        *object_status = SAI_STATUS_NOT_EXECUTED;
+    }
+
+    /*
+     * Queue a set of attr on object_id. Pointers held by attr must stay valid
+     * until flush(). When the API has no bulk set, the sets are issued one by
+     * one on flush.
+     */
+    void set_entry_attribute(
+        _Out_ sai_status_t *object_status,
         _In_ sai_object_id_t object_id,
         _In_ const sai_attribute_t *attr)
     {
-        auto found_setting = setting_entries.find(object_id);
-        if (found_setting != setting_entries.end())
-        {
-            // For simplicity, just insert new attribute at the vector end, no merging
-            found_setting->second.emplace_back(*attr);
-        }
-        else
-        {
-            // Create a new key if not exists in the map
-            setting_entries.emplace(std::piecewise_construct,
-                std::forward_as_tuple(object_id),
-                std::forward_as_tuple(1, *attr));
-        }
+        assert(object_status);
+        if (!object_status) throw std::invalid_argument("object_status is null");
+        assert(object_id != SAI_NULL_OBJECT_ID);
+        if (object_id == SAI_NULL_OBJECT_ID) throw std::invalid_argument("object_id is null");
+        assert(attr);
+        if (!attr) throw std::invalid_argument("attr is null");
 
-        return SAI_STATUS_SUCCESS;
+        // For simplicity, just insert new attribute at the vector end, no merging
+        setting_entries[object_id].emplace_back(*attr, object_status);
+        *object_status = SAI_STATUS_NOT_EXECUTED;
     }
-    */
 
     void flush()
     {
@@ -993,6 +1838,11 @@ public:
             std::vector<sai_attribute_t const*> tss;
             std::vector<uint32_t> cs;
 
+            size_t batch = std::min(creating_entries.size(), max_bulk_size);
+            rs.reserve(batch);
+            tss.reserve(batch);
+            cs.reserve(batch);
+
             for (auto const& i: creating_entries)
             {
                 sai_object_id_t *pid = std::get<0>(i);
@@ -1012,43 +1862,74 @@ public:
             flush_creating_entries(rs, tss, cs);
 
             creating_entries.clear();
+            creating_statuses.clear();
+            arena.reset();
         }
 
         // Setting
-        // TODO: wait until available in SAI
-        /*
         if (!setting_entries.empty())
         {
             std::vector<sai_object_id_t> rs;
             std::vector<sai_attribute_t> ts;
+            std::vector<sai_status_t*> status_vector;
 
             for (auto const& i: setting_entries)
             {
                 auto const& entry = i.first;
                 auto const& attrs = i.second;
-                for (auto const& attr: attrs)
+                for (auto const& ia: attrs)
                 {
                     rs.push_back(entry);
-                    ts.push_back(attr);
+                    ts.push_back(ia.first);
+                    status_vector.push_back(ia.second);
 
                     if (rs.size() >= max_bulk_size)
                     {
-                        flush_setting_entries(rs, ts);
+                        flush_setting_entries(rs, ts, status_vector);
                     }
                 }
             }
-            flush_setting_entries(rs, ts);
+            flush_setting_entries(rs, ts, status_vector);
 
             setting_entries.clear();
         }
-        */
+
+        // Getting
+        if (!getting_entries.empty())
+        {
+            std::vector<sai_object_key_t> rs;
+            std::vector<uint32_t> cs;
+            std::vector<sai_attribute_t*> tss;
+            std::vector<sai_status_t*> status_vector;
+
+            for (auto const& i: getting_entries)
+            {
+                sai_object_key_t key;
+                key.key.object_id = std::get<0>(i);
+                rs.push_back(key);
+                cs.push_back(std::get<1>(i));
+                tss.push_back(std::get<2>(i));
+                status_vector.push_back(std::get<3>(i));
+
+                if (rs.size() >= max_bulk_size)
+                {
+                    flush_getting_entries(rs, cs, tss, status_vector);
+                }
+            }
+            flush_getting_entries(rs, cs, tss, status_vector);
+
+            getting_entries.clear();
+        }
     }
 
     void clear()
     {
         removing_entries.clear();
         creating_entries.clear();
+        creating_statuses.clear();
         setting_entries.clear();
+        getting_entries.clear();
+        arena.reset();
     }
 
     size_t creating_entries_count() const
@@ -1066,6 +1947,11 @@ public:
         return removing_entries.size();
     }
 
+    size_t getting_entries_count() const
+    {
+        return getting_entries.size();
+    }
+
 private:
     struct object_entry
     {
@@ -1085,25 +1971,49 @@ private:
 
     std::vector<std::pair<                                  // A vector of pair of
             sai_object_id_t *,                              // - object_id
-            std::vector<sai_attribute_t>                    // - attrs
+            BulkerAttrList                                  // - attrs
     >>                                                      creating_entries;
 
     std::unordered_map<                                     // A map of
-            sai_object_id_t,                                // object_id -> (OUT object_status, attributes)
-            std::pair<
-                    sai_status_t *,
-                    std::vector<sai_attribute_t>
-            >
+            sai_object_id_t *,                              // object_id -> OUT object_status,
+            sai_status_t *                                  // for the creations queued with a status
+    >                                                       creating_statuses;
+
+    BulkerArena                                             arena;      // Attributes of creating_entries
+
+    std::unordered_map<                                     // A map of
+            sai_object_id_t,                                // object_id -> [(attribute, OUT object_status)]
+            std::vector<std::pair<
+                    sai_attribute_t,
+                    sai_status_t *
+            >>
     >                                                       setting_entries;
 
                                                             // A map of
                                                             // object_id -> object_status
     std::unordered_map<sai_object_id_t, sai_status_t *>     removing_entries;
 
-    typename Ts::bulk_create_entry_fn                       create_entries;
-    typename Ts::bulk_remove_entry_fn                       remove_entries;
-    // TODO: wait until available in SAI
-    //typename Ts::bulk_set_entry_attribute_fn                set_entries_attribute;
+    std::vector<std::tuple<                                 // A vector of
+            sai_object_id_t,                                // (object_id,
+            uint32_t,                                       //  attr_count,
+            sai_attribute_t *,                              //  INOUT attr_list,
+            sai_status_t *                                  //  OUT object_status)
+    >>                                                      getting_entries;
+
+    sai_object_type_t                                       object_type = SAI_OBJECT_TYPE_NULL;
+
+    typename Ts::bulk_create_entry_fn                       create_entries = nullptr;
+    typename Ts::bulk_remove_entry_fn                       remove_entries = nullptr;
+    typename Ts::create_entry_fn                            create_entry_single = nullptr;
+    typename Ts::remove_entry_fn                            remove_entry_single = nullptr;
+    typename Ts::get_entry_attribute_fn                     get_entry_attribute_single = nullptr;
+    sai_bulk_object_set_attribute_fn                        set_entries_attribute = nullptr;
+    typename Ts::set_entry_attribute_fn                     set_entry_attribute_single = nullptr;
+
+    // Cleared when the bulk get is not implemented, gets are then issued one by one
+    bool                                                    bulk_get_supported = true;
+    // Cleared when the generic bulk create/remove is not implemented for object_type
+    bool                                                    bulk_object_supported = true;
 
     sai_status_t flush_removing_entries(
         _Inout_ std::vector<sai_object_id_t> &rs)
@@ -1114,7 +2024,37 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*remove_entries)((uint32_t)count, rs.data(), SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+        if (remove_entries)
+        {
+            status = (*remove_entries)((uint32_t)count, rs.data(), SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        }
+        else if (bulk_object_supported)
+        {
+            // No bulk api in the api table, use the generic one
+            status = BulkerGenericApi::instance().bulk_object_remove(object_type, (uint32_t)count, rs.data(), SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+            {
+                SWSS_LOG_NOTICE("ObjectBulker.flush bulk remove of %s is not supported, removing entries one by one",
+                                sai_serialize_object_type(object_type).c_str());
+                bulk_object_supported = false;
+            }
+        }
+
+        if (remove_entry_single && (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED))
+        {
+            // No bulk api for this object type, the removals are issued back to back
+            status = SAI_STATUS_SUCCESS;
+            for (size_t i = 0; i < count; i++)
+            {
+                statuses[i] = (*remove_entry_single)(rs[i]);
+                if (statuses[i] != SAI_STATUS_SUCCESS)
+                {
+                    status = statuses[i];
+                }
+            }
+        }
+
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush removing_entries %zu rc=%d statuses[0]=%d\n", removing_entries.size(), status, statuses[0]);
@@ -1149,8 +2089,39 @@ private:
         size_t count = rs.size();
         std::vector<sai_object_id_t> object_ids(count);
         std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*create_entries)(switch_id, (uint32_t)count, cs.data(), tss.data()
-            , SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_ids.data(), statuses.data());
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+        if (create_entries)
+        {
+            status = (*create_entries)(switch_id, (uint32_t)count, cs.data(), tss.data()
+                , SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_ids.data(), statuses.data());
+        }
+        else if (bulk_object_supported)
+        {
+            // No bulk api in the api table, use the generic one
+            status = BulkerGenericApi::instance().bulk_object_create(switch_id, object_type, (uint32_t)count, cs.data(), tss.data()
+                , SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_ids.data(), statuses.data());
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+            {
+                SWSS_LOG_NOTICE("ObjectBulker.flush bulk create of %s is not supported, creating entries one by one",
+                                sai_serialize_object_type(object_type).c_str());
+                bulk_object_supported = false;
+            }
+        }
+
+        if (create_entry_single && (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED))
+        {
+            // No bulk api for this object type, the creations are issued back to back
+            status = SAI_STATUS_SUCCESS;
+            for (size_t i = 0; i < count; i++)
+            {
+                statuses[i] = (*create_entry_single)(&object_ids[i], switch_id, cs[i], tss[i]);
+                if (statuses[i] != SAI_STATUS_SUCCESS)
+                {
+                    status = statuses[i];
+                }
+            }
+        }
+
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush creating_entries %zu\n", count);
@@ -1165,6 +2136,12 @@ private:
         {
             sai_object_id_t *pid = rs[i];
             *pid = (statuses[i] == SAI_STATUS_SUCCESS) ? object_ids[i] : SAI_NULL_OBJECT_ID;
+
+            auto found_status = creating_statuses.find(pid);
+            if (found_status != creating_statuses.end())
+            {
+                *found_status->second = statuses[i];
+            }
         }
 
         rs.clear();
@@ -1174,20 +2151,97 @@ private:
         return status;
     }
 
-    // TODO: wait until available in SAI
-    /*
+    sai_status_t flush_getting_entries(
+        _Inout_ std::vector<sai_object_key_t> &rs,
+        _Inout_ std::vector<uint32_t> &cs,
+        _Inout_ std::vector<sai_attribute_t*> &tss,
+        _Inout_ std::vector<sai_status_t*> &status_vector)
+    {
+        if (rs.empty())
+        {
+            return SAI_STATUS_SUCCESS;
+        }
+        size_t count = rs.size();
+        std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+        if (bulk_get_supported)
+        {
+            status = BulkerGenericApi::instance().bulk_get_attribute(switch_id, object_type, (uint32_t)count, rs.data(), cs.data(), tss.data(), statuses.data());
+            if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+            {
+                SWSS_LOG_NOTICE("ObjectBulker.flush bulk get is not supported, getting entries one by one");
+                bulk_get_supported = false;
+            }
+        }
+
+        if (!bulk_get_supported)
+        {
+            status = SAI_STATUS_SUCCESS;
+            for (size_t i = 0; i < count; i++)
+            {
+                statuses[i] = (*get_entry_attribute_single)(rs[i].key.object_id, cs[i], tss[i]);
+                if (statuses[i] != SAI_STATUS_SUCCESS)
+                {
+                    status = statuses[i];
+                }
+            }
+        }
+
+        if (status == SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("ObjectBulker.flush getting_entries %zu\n", count);
+        }
+        else
+        {
+            SWSS_LOG_INFO("ObjectBulker.flush get entry attribute failed for some entries, number of entries to get: %zu, status: %s",
+                            count, sai_serialize_status(status).c_str());
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            *status_vector[i] = statuses[i];
+        }
+
+        rs.clear();
+        cs.clear();
+        tss.clear();
+        status_vector.clear();
+
+        return status;
+    }
+
     sai_status_t flush_setting_entries(
         _Inout_ std::vector<sai_object_id_t> &rs,
-        _Inout_ std::vector<sai_attribute_t> &ts)
+        _Inout_ std::vector<sai_attribute_t> &ts,
+        _Inout_ std::vector<sai_status_t*> &status_vector)
     {
         if (rs.empty())
         {
             return SAI_STATUS_SUCCESS;
         }
         size_t count = rs.size();
-        std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*set_entries_attribute)((uint32_t)count, rs.data(), ts.data()
-            , SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+        if (set_entries_attribute)
+        {
+            status = (*set_entries_attribute)((uint32_t)count, rs.data(), ts.data()
+                , SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        }
+
+        if (set_entry_attribute_single && (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED))
+        {
+            // No bulk api for this object type, the sets are issued back to back
+            status = SAI_STATUS_SUCCESS;
+            for (size_t i = 0; i < count; i++)
+            {
+                statuses[i] = (*set_entry_attribute_single)(rs[i], &ts[i]);
+                if (statuses[i] != SAI_STATUS_SUCCESS)
+                {
+                    status = statuses[i];
+                }
+            }
+        }
+
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush setting_entries %zu\n", count);
@@ -1198,12 +2252,17 @@ private:
                             count, sai_serialize_status(status).c_str());
         }
 
+        for (size_t i = 0; i < count; i++)
+        {
+            *status_vector[i] = statuses[i];
+        }
+
         rs.clear();
         ts.clear();
+        status_vector.clear();
 
         return status;
     }
-     */
 };
 
 template <>
@@ -1211,17 +2270,193 @@ inline ObjectBulker<sai_next_hop_group_api_t>::ObjectBulker(SaiBulkerTraits<sai_
     switch_id(switch_id),
     max_bulk_size(max_bulk_size)
 {
+    object_type = SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER;
     create_entries = api->create_next_hop_group_members;
     remove_entries = api->remove_next_hop_group_members;
+    get_entry_attribute_single = api->get_next_hop_group_member_attribute;
     // TODO: wait until available in SAI
     //set_entries_attribute = ;
 }
 
+template <>
+inline ObjectBulker<sai_bridge_api_t>::ObjectBulker(SaiBulkerTraits<sai_bridge_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    // No bulk api in the bridge api table, the generic bulk create/remove is used
+    object_type = SAI_OBJECT_TYPE_BRIDGE_PORT;
+    create_entry_single = api->create_bridge_port;
+    remove_entry_single = api->remove_bridge_port;
+    get_entry_attribute_single = api->get_bridge_port_attribute;
+}
+
+template <>
+inline ObjectBulker<sai_vlan_api_t>::ObjectBulker(SaiBulkerTraits<sai_vlan_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    object_type = SAI_OBJECT_TYPE_VLAN_MEMBER;
+    create_entries = api->create_vlan_members;
+    remove_entries = api->remove_vlan_members;
+    create_entry_single = api->create_vlan_member;
+    remove_entry_single = api->remove_vlan_member;
+    get_entry_attribute_single = api->get_vlan_member_attribute;
+}
+
+template <>
+inline ObjectBulker<sai_next_hop_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_hop_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    // No bulk api in the next hop api table, the generic bulk create/remove is used
+    object_type = SAI_OBJECT_TYPE_NEXT_HOP;
+    create_entry_single = api->create_next_hop;
+    remove_entry_single = api->remove_next_hop;
+    get_entry_attribute_single = api->get_next_hop_attribute;
+}
+
+template <>
+inline ObjectBulker<sai_tunnel_api_t>::ObjectBulker(SaiBulkerTraits<sai_tunnel_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    // No bulk api in the tunnel api table, the generic bulk create/remove is used
+    object_type = SAI_OBJECT_TYPE_TUNNEL_MAP_ENTRY;
+    create_entry_single = api->create_tunnel_map_entry;
+    remove_entry_single = api->remove_tunnel_map_entry;
+    get_entry_attribute_single = api->get_tunnel_map_entry_attribute;
+}
+
+template <>
+inline ObjectBulker<sai_router_interface_api_t>::ObjectBulker(SaiBulkerTraits<sai_router_interface_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    // No bulk api in the router interface api table, the generic bulk create/remove is used
+    object_type = SAI_OBJECT_TYPE_ROUTER_INTERFACE;
+    create_entry_single = api->create_router_interface;
+    remove_entry_single = api->remove_router_interface;
+    get_entry_attribute_single = api->get_router_interface_attribute;
+}
+
+template <>
+inline ObjectBulker<sai_port_api_t>::ObjectBulker(SaiBulkerTraits<sai_port_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    object_type = SAI_OBJECT_TYPE_PORT;
+    create_entries = api->create_ports;
+    remove_entries = api->remove_ports;
+    create_entry_single = api->create_port;
+    remove_entry_single = api->remove_port;
+    get_entry_attribute_single = api->get_port_attribute;
+}
+
+template <>
+inline ObjectBulker<sai_system_port_api_t>::ObjectBulker(SaiBulkerTraits<sai_system_port_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    // SAI has no bulk create/remove api for system ports
+    object_type = SAI_OBJECT_TYPE_SYSTEM_PORT;
+    create_entry_single = api->create_system_port;
+    remove_entry_single = api->remove_system_port;
+    get_entry_attribute_single = api->get_system_port_attribute;
+}
+
+template <>
+inline ObjectBulker<sai_queue_api_t>::ObjectBulker(SaiBulkerTraits<sai_queue_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    // SAI has no bulk create/remove api for queues
+    object_type = SAI_OBJECT_TYPE_QUEUE;
+    create_entry_single = api->create_queue;
+    remove_entry_single = api->remove_queue;
+    get_entry_attribute_single = api->get_queue_attribute;
+    // Null when the SAI implementation has no bulk set, the sets are then serial
+    set_entries_attribute = api->set_queues_attribute;
+    set_entry_attribute_single = api->set_queue_attribute;
+}
+
+template <>
+inline ObjectBulker<sai_buffer_api_t>::ObjectBulker(SaiBulkerTraits<sai_buffer_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    // SAI has no bulk create/remove api for ingress priority groups
+    object_type = SAI_OBJECT_TYPE_INGRESS_PRIORITY_GROUP;
+    create_entry_single = api->create_ingress_priority_group;
+    remove_entry_single = api->remove_ingress_priority_group;
+    get_entry_attribute_single = api->get_ingress_priority_group_attribute;
+    // Null when the SAI implementation has no bulk set, as for queues
+    set_entries_attribute = api->set_ingress_priority_groups_attribute;
+    set_entry_attribute_single = api->set_ingress_priority_group_attribute;
+}
+
 template <>
 inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_vnet_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
     switch_id(switch_id),
     max_bulk_size(max_bulk_size)
 {
+    object_type = (sai_object_type_t)SAI_OBJECT_TYPE_VNET;
     create_entries = api->create_vnets;
     remove_entries = api->remove_vnets;
+    get_entry_attribute_single = api->get_vnet_attribute;
+}
+
+template <>
+inline ObjectBulker<sai_dash_acl_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_acl_api_t>::api_t *api, sai_object_type_t object_type, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size),
+    object_type(object_type)
+{
+    switch ((int)object_type)
+    {
+        case SAI_OBJECT_TYPE_DASH_ACL_RULE:
+            create_entries = api->create_dash_acl_rules;
+            remove_entries = api->remove_dash_acl_rules;
+            create_entry_single = api->create_dash_acl_rule;
+            remove_entry_single = api->remove_dash_acl_rule;
+            get_entry_attribute_single = api->get_dash_acl_rule_attribute;
+            break;
+        case SAI_OBJECT_TYPE_DASH_ACL_GROUP:
+            create_entries = api->create_dash_acl_groups;
+            remove_entries = api->remove_dash_acl_groups;
+            create_entry_single = api->create_dash_acl_group;
+            remove_entry_single = api->remove_dash_acl_group;
+            get_entry_attribute_single = api->get_dash_acl_group_attribute;
+            break;
+        default:
+            throw std::invalid_argument("Unsupported DASH ACL object type");
+    }
+}
+
+template <>
+inline ObjectBulker<sai_acl_api_t>::ObjectBulker(SaiBulkerTraits<sai_acl_api_t>::api_t *api, sai_object_type_t object_type, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size),
+    object_type(object_type)
+{
+    // No bulk api in the ACL api table, the generic bulk create/remove is used
+    switch (object_type)
+    {
+        case SAI_OBJECT_TYPE_ACL_ENTRY:
+            create_entry_single = api->create_acl_entry;
+            remove_entry_single = api->remove_acl_entry;
+            get_entry_attribute_single = api->get_acl_entry_attribute;
+            break;
+        case SAI_OBJECT_TYPE_ACL_COUNTER:
+            create_entry_single = api->create_acl_counter;
+            remove_entry_single = api->remove_acl_counter;
+            get_entry_attribute_single = api->get_acl_counter_attribute;
+            break;
+        case SAI_OBJECT_TYPE_ACL_RANGE:
+            create_entry_single = api->create_acl_range;
+            remove_entry_single = api->remove_acl_range;
+            get_entry_attribute_single = api->get_acl_range_attribute;
+            break;
+        default:
+            throw std::invalid_argument("Unsupported ACL object type");
+    }
 }
@@ -119,6 +119,9 @@ void CbfNhgOrch::doTask(Consumer& consumer)
                         }
 
                         m_syncdNextHopGroups.emplace(index, NhgEntry<CbfNhg>(move(cbf_nhg)));
+
+                        /* Wake the routes parked until the group is created */
+                        gRouteOrch->resolveConstraint(make_pair(RETRY_CST_NHG, index));
                     }
                 }
             }
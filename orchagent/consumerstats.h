@@ -0,0 +1,108 @@
+#ifndef SWSS_CONSUMERSTATS_H
+#define SWSS_CONSUMERSTATS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "table.h"
+
+/* Collect per consumer statistics, set by orchagent -p */
+extern bool gConsumerStatsEnabled;
+
+/* Running total of the tasks popped by all the consumers, of every execution group */
+extern std::atomic<uint64_t> gPoppedTasks;
+
+/*
+ * Histogram of processing times in microseconds with power of two buckets:
+ * bucket 0 holds 0us, bucket n holds [2^(n-1), 2^n) us.
+ * Percentiles are reported as the upper bound of their bucket, capped by
+ * the maximum seen, so they are at most 2x off.
+ */
+class LatencyHistogram
+{
+public:
+    void add(uint64_t usec)
+    {
+        size_t bucket = 0;
+        if (usec != 0)
+        {
+            bucket = std::min<size_t>(64 - __builtin_clzll(usec), BUCKETS - 1);
+        }
+
+        m_buckets[bucket]++;
+        m_count++;
+        m_max = std::max(m_max, usec);
+    }
+
+    uint64_t count() const
+    {
+        return m_count;
+    }
+
+    uint64_t max() const
+    {
+        return m_max;
+    }
+
+    /* p in percent, 0 < p <= 100 */
+    uint64_t percentile(unsigned p) const
+    {
+        if (m_count == 0)
+        {
+            return 0;
+        }
+
+        uint64_t rank = (m_count * p + 99) / 100;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKETS; i++)
+        {
+            seen += m_buckets[i];
+            if (seen >= rank)
+            {
+                uint64_t upper = (i == 0) ? 0 : (1ULL << i) - 1;
+                return std::min(upper, m_max);
+            }
+        }
+
+        return m_max;
+    }
+
+private:
+    enum
+    {
+        BUCKETS = 40
+    };
+
+    uint64_t m_buckets[BUCKETS] = {};
+    uint64_t m_count = 0;
+    uint64_t m_max = 0;
+};
+
+struct ConsumerStats
+{
+    uint64_t popped = 0;        // Tasks popped from the table
+    uint64_t completed = 0;     // Tasks removed from m_toSync by doTask
+    uint64_t maxDepth = 0;      // Largest m_toSync seen by a drain
+    LatencyHistogram drainTime; // doTask run time per drain
+
+    /* Field values as published in STATE_DB, with the retry counters */
+    std::vector<swss::FieldValueTuple> toFieldValues(uint64_t retried, uint64_t parked) const
+    {
+        return {
+            { "popped", std::to_string(popped) },
+            { "completed", std::to_string(completed) },
+            { "retried", std::to_string(retried) },
+            { "parked", std::to_string(parked) },
+            { "max_depth", std::to_string(maxDepth) },
+            { "drains", std::to_string(drainTime.count()) },
+            { "p50_usec", std::to_string(drainTime.percentile(50)) },
+            { "p99_usec", std::to_string(drainTime.percentile(99)) },
+            { "max_usec", std::to_string(drainTime.max()) },
+        };
+    }
+};
+
+#endif /* SWSS_CONSUMERSTATS_H */
@@ -28,6 +28,8 @@ CounterCheckOrch::CounterCheckOrch(DBConnector *db, vector<string> &tableNames):
 {
     SWSS_LOG_ENTER();
 
+    setExecutionGroup(ORCH_GROUP_COUNTERS, { ORCH_GROUP_MAIN });
+
     auto interv = timespec { .tv_sec = COUNTER_CHECK_POLL_TIMEOUT_SEC, .tv_nsec = 0 };
     auto timer = new SelectableTimer(interv);
     auto executor = new ExecutableTimer(timer, this, "MC_COUNTERS_POLL");
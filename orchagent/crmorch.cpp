@@ -375,6 +375,8 @@ CrmOrch::CrmOrch(DBConnector *db, string tableName):
 {
     SWSS_LOG_ENTER();
 
+    setExecutionGroup(ORCH_GROUP_COUNTERS, { ORCH_GROUP_MAIN });
+
     m_pollingInterval = chrono::seconds(CRM_POLLING_INTERVAL_DEFAULT);
 
     for (const auto &res : crmResTypeNameMap)
@@ -413,6 +415,8 @@ void CrmOrch::doTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     string table_name = consumer.getTableName();
 
     if (table_name != CFG_CRM_TABLE_NAME)
@@ -515,6 +519,8 @@ void CrmOrch::incCrmResUsedCounter(CrmResourceType resource)
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter++;
@@ -530,6 +536,8 @@ void CrmOrch::decCrmResUsedCounter(CrmResourceType resource)
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter--;
@@ -545,6 +553,8 @@ void CrmOrch::incCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter++;
@@ -560,6 +570,8 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter--;
@@ -599,6 +611,8 @@ void CrmOrch::incCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter++;
@@ -615,6 +629,8 @@ void CrmOrch::decCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter--;
@@ -630,6 +646,8 @@ void CrmOrch::incCrmExtTableUsedCounter(CrmResourceType resource, std::string ta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)].usedCounter++;
@@ -645,6 +663,8 @@ void CrmOrch::decCrmExtTableUsedCounter(CrmResourceType resource, std::string ta
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)].usedCounter--;
@@ -660,6 +680,8 @@ void CrmOrch::incCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
@@ -693,6 +715,8 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     try
     {
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
@@ -724,6 +748,8 @@ void CrmOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    lock_guard<recursive_mutex> lock(m_resourcesMutex);
+
     getResAvailableCounters();
     updateCrmCountersTable();
     checkCrmThresholds();
@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include <map>
+#include <mutex>
 #include "orch.h"
 #include "port.h"
 #include "events.h"
@@ -121,6 +122,12 @@ private:
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
+    /*
+     * The used counters are updated by the orchs of every execution group,
+     * so m_resourcesMap is guarded by its own lock rather than by a group.
+     */
+    std::recursive_mutex m_resourcesMutex;
+
     void doTask(Consumer &consumer);
     void handleSetCommand(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
     void doTask(swss::SelectableTimer &timer);
@@ -10,10 +10,12 @@
 #include "saihelper.h"
 #include "pbutils.h"
 #include "taskworker.h"
+#include "bulker.h"
 
 extern sai_dash_acl_api_t* sai_dash_acl_api;
 extern sai_dash_eni_api_t* sai_dash_eni_api;
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 extern CrmOrch *gCrmOrch;
 
 using namespace std;
@@ -128,21 +130,19 @@ sai_attr_id_t getSaiStage(DashAclDirection d, sai_ip_addr_family_t f, DashAclSta
 }
 
 DashAclRuleInfo::DashAclRuleInfo(const DashAclRule &rule) :
-    m_src_tags(rule.m_src_tags),
-    m_dst_tags(rule.m_dst_tags)
+    m_rule(rule)
 {
     SWSS_LOG_ENTER();
 }
 
 bool DashAclRuleInfo::isTagUsed(const std::string &tag_id) const
 {
-    return (m_src_tags.find(tag_id) != end(m_src_tags)) || (m_dst_tags.find(tag_id) != end(m_dst_tags));
+    return (m_rule.m_src_tags.find(tag_id) != end(m_rule.m_src_tags)) || (m_rule.m_dst_tags.find(tag_id) != end(m_rule.m_dst_tags));
 }
 
-DashAclGroupMgr::DashAclGroupMgr(DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch) :
+DashAclGroupMgr::DashAclGroupMgr(DashOrch *dashorch, DashAclOrch *aclorch) :
     m_dash_orch(dashorch),
-    m_dash_acl_orch(aclorch),
-    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME))
+    m_dash_acl_orch(aclorch)
 {
     SWSS_LOG_ENTER();
 }
@@ -281,26 +281,20 @@ task_process_status DashAclGroupMgr::onUpdate(const string& group_id, const stri
         return refreshAclGroupFull(group_id);
     }
 
-    // If the group is not bound to ENI update the rule immediately.
+    // If the group is not bound to ENI update the affected rules immediately.
     SWSS_LOG_INFO("Update ACL group %s", group_id.c_str());
+    vector<DashAclRuleInfo*> rules;
     for (auto& rule_it: group.m_dash_acl_rule_table)
     {
-        auto& rule_id = rule_it.first;
-        auto& rule_info = rule_it.second;
-        if (rule_info.isTagUsed(tag_id))
+        if (rule_it.second.isTagUsed(tag_id))
         {
-            DashAclRule rule;
-            bool found = fetchRule(group_id, rule_id, rule);
-            if (!found)
-            {
-                SWSS_LOG_ERROR("Failed to fetch group %s rule %s", group_id.c_str(), rule_id.c_str());
-                return task_failed;
-            }
-            removeRule(group, rule_info);
-            rule_info = createRule(group, rule);
+            rules.push_back(&rule_it.second);
         }
     }
 
+    removeRules(group, rules);
+    createRules(group, rules);
+
     return task_success;
 }
 
@@ -314,21 +308,16 @@ task_process_status DashAclGroupMgr::refreshAclGroupFull(const string &group_id)
     init(new_group);
     create(new_group);
 
+    // Rules can't be moved between groups, so the shadow group gets a copy of every rule
+    vector<DashAclRuleInfo*> rules;
+    rules.reserve(new_group.m_dash_acl_rule_table.size());
     for (auto& rule_it: new_group.m_dash_acl_rule_table)
     {
-        auto& rule_id = rule_it.first;
-        auto& rule_info = rule_it.second;
-        DashAclRule rule;
-        bool found = fetchRule(group_id, rule_id, rule);
-        if (!found)
-        {
-            SWSS_LOG_ERROR("Failed to fetch group %s rule %s", group_id.c_str(), rule_id.c_str());
-            return task_failed;
-        }
-
-        rule_info = createRule(new_group, rule);
+        rules.push_back(&rule_it.second);
     }
 
+    createRules(new_group, rules);
+
     for (const auto& table: new_group.m_in_tables)
     {
         const auto& eni_id = table.first;
@@ -368,23 +357,26 @@ void DashAclGroupMgr::removeAclGroupFull(DashAclGroup& group)
 {
     SWSS_LOG_ENTER();
 
+    vector<DashAclRuleInfo*> rules;
+    rules.reserve(group.m_dash_acl_rule_table.size());
     for (auto& rule: group.m_dash_acl_rule_table)
     {
-        removeRule(group, rule.second);
+        rules.push_back(&rule.second);
     }
 
+    removeRules(group, rules);
     remove(group);
 }
 
-DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& rule)
+void DashAclGroupMgr::getRuleAttrs(const DashAclGroup& group, DashAclRuleBulkContext& ctx)
 {
     SWSS_LOG_ENTER();
 
-    vector<sai_attribute_t> attrs;
-    vector<sai_ip_prefix_t> src_prefixes = {};
-    vector<sai_ip_prefix_t> dst_prefixes = {};
-
-    DashAclRuleInfo rule_info = rule;
+    const auto& rule = ctx.rule_info->m_rule;
+    auto& attrs = ctx.attrs;
+    auto& protocols = ctx.protocols;
+    auto& src_prefixes = ctx.src_prefixes;
+    auto& dst_prefixes = ctx.dst_prefixes;
 
     auto any_ip = [] (const auto& g)
     {
@@ -414,7 +406,6 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_PROTOCOL;
 
-    vector<uint8_t> protocols;
     if (rule.m_protocols.size()) {
         protocols = rule.m_protocols;
     } else {
@@ -472,32 +463,67 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.back().value.ipprefixlist.count = static_cast<uint32_t>(dst_prefixes.size());
     attrs.back().value.ipprefixlist.list = dst_prefixes.data();
 
+    ctx.src_ports = rule.m_src_ports;
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_SRC_PORT;
-    attrs.back().value.u16rangelist.count = static_cast<uint32_t>(rule.m_src_ports.size());
-    attrs.back().value.u16rangelist.list = rule.m_src_ports.data();
+    attrs.back().value.u16rangelist.count = static_cast<uint32_t>(ctx.src_ports.size());
+    attrs.back().value.u16rangelist.list = ctx.src_ports.data();
 
+    ctx.dst_ports = rule.m_dst_ports;
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_DST_PORT;
-    attrs.back().value.u16rangelist.count = static_cast<uint32_t>(rule.m_dst_ports.size());
-    attrs.back().value.u16rangelist.list = rule.m_dst_ports.data();
+    attrs.back().value.u16rangelist.count = static_cast<uint32_t>(ctx.dst_ports.size());
+    attrs.back().value.u16rangelist.list = ctx.dst_ports.data();
 
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
     attrs.back().value.oid = group.m_dash_acl_group_id;
+}
 
-    auto status = sai_dash_acl_api->create_dash_acl_rule(&rule_info.m_dash_acl_rule_id, gSwitchId, static_cast<uint32_t>(attrs.size()), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
+void DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRuleInfo& rule)
+{
+    SWSS_LOG_ENTER();
+
+    createRules(group, { &rule });
+}
+
+void DashAclGroupMgr::createRules(DashAclGroup& group, const vector<DashAclRuleInfo*>& rules)
+{
+    SWSS_LOG_ENTER();
+
+    if (rules.empty())
     {
-        SWSS_LOG_ERROR("Failed to create ACL rule: %d, %s", status, sai_serialize_status(status).c_str());
-        handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, status);
+        return;
     }
 
+    // The contexts own the attribute payloads until the bulker is flushed
+    deque<DashAclRuleBulkContext> contexts;
+    ObjectBulker<sai_dash_acl_api_t> bulker(sai_dash_acl_api, (sai_object_type_t)SAI_OBJECT_TYPE_DASH_ACL_RULE, gSwitchId, gMaxBulkSize);
+
+    for (auto rule_info: rules)
+    {
+        contexts.emplace_back(rule_info);
+        auto& ctx = contexts.back();
+        getRuleAttrs(group, ctx);
+        bulker.create_entry(&rule_info->m_dash_acl_rule_id, &ctx.status, static_cast<uint32_t>(ctx.attrs.size()), ctx.attrs.data());
+    }
+
+    bulker.flush();
+
     CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
             CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
-    gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
 
-    return rule_info;
+    for (const auto& ctx: contexts)
+    {
+        if (ctx.status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to create ACL rule: %d, %s", ctx.status, sai_serialize_status(ctx.status).c_str());
+            handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, ctx.status);
+            continue;
+        }
+
+        gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+    }
 }
 
 task_process_status DashAclGroupMgr::createRule(const string& group_id, const string& rule_id, DashAclRule& rule)
@@ -533,7 +559,8 @@ task_process_status DashAclGroupMgr::createRule(const string& group_id, const st
         }
     }
 
-    auto rule_info = createRule(group, rule);
+    DashAclRuleInfo rule_info = rule;
+    createRule(group, rule_info);
 
     group.m_dash_acl_rule_table.emplace(rule_id, rule_info);
     attachTags(group_id, rule.m_src_tags);
@@ -562,24 +589,46 @@ void DashAclGroupMgr::removeRule(DashAclGroup& group, DashAclRuleInfo& rule)
 {
     SWSS_LOG_ENTER();
 
-    if (rule.m_dash_acl_rule_id == SAI_NULL_OBJECT_ID)
-    {
-        return;
-    }
+    removeRules(group, { &rule });
+}
 
-    // Remove the ACL group
-    auto status = sai_dash_acl_api->remove_dash_acl_rule(rule.m_dash_acl_rule_id);
-    if (status != SAI_STATUS_SUCCESS)
+void DashAclGroupMgr::removeRules(DashAclGroup& group, const vector<DashAclRuleInfo*>& rules)
+{
+    SWSS_LOG_ENTER();
+
+    vector<sai_status_t> statuses(rules.size(), SAI_STATUS_NOT_EXECUTED);
+    ObjectBulker<sai_dash_acl_api_t> bulker(sai_dash_acl_api, (sai_object_type_t)SAI_OBJECT_TYPE_DASH_ACL_RULE, gSwitchId, gMaxBulkSize);
+
+    for (size_t i = 0; i < rules.size(); i++)
     {
-        SWSS_LOG_ERROR("Failed to remove ACL rule: %d, %s", status, sai_serialize_status(status).c_str());
-        handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, status);
+        if (rules[i]->m_dash_acl_rule_id != SAI_NULL_OBJECT_ID)
+        {
+            bulker.remove_entry(&statuses[i], rules[i]->m_dash_acl_rule_id);
+        }
     }
 
+    bulker.flush();
+
     CrmResourceType crm_resource = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
         CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
-    gCrmOrch->decCrmDashAclUsedCounter(crm_resource, group.m_dash_acl_group_id);
 
-    rule.m_dash_acl_rule_id = SAI_NULL_OBJECT_ID;
+    for (size_t i = 0; i < rules.size(); i++)
+    {
+        if (rules[i]->m_dash_acl_rule_id == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule: %d, %s", statuses[i], sai_serialize_status(statuses[i]).c_str());
+            handleSaiRemoveStatus((sai_api_t)SAI_API_DASH_ACL, statuses[i]);
+        }
+
+        gCrmOrch->decCrmDashAclUsedCounter(crm_resource, group.m_dash_acl_group_id);
+
+        rules[i]->m_dash_acl_rule_id = SAI_NULL_OBJECT_ID;
+    }
 }
 
 task_process_status DashAclGroupMgr::removeRule(const string& group_id, const string& rule_id)
@@ -603,8 +652,8 @@ task_process_status DashAclGroupMgr::removeRule(const string& group_id, const st
 
     removeRule(group, rule);
 
-    detachTags(group_id, rule.m_src_tags);
-    detachTags(group_id, rule.m_dst_tags);
+    detachTags(group_id, rule.m_rule.m_src_tags);
+    detachTags(group_id, rule.m_rule.m_dst_tags);
 
     group.m_dash_acl_rule_table.erase(rule_id);
 
@@ -613,34 +662,6 @@ task_process_status DashAclGroupMgr::removeRule(const string& group_id, const st
     return task_success;
 }
 
-bool DashAclGroupMgr::fetchRule(const std::string &group_id, const std::string &rule_id, DashAclRule &rule)
-{
-    auto key = group_id + ":" + rule_id;
-    vector<FieldValueTuple> tuples;
-
-    bool exists = m_dash_acl_rules_table->get(key, tuples);
-    if (!exists)
-    {
-        SWSS_LOG_ERROR("Failed to fetch DASH ACL Rule %s", key.c_str());
-        return false;
-    }
-
-    AclRule pb_rule;
-    if (!parsePbMessage(tuples, pb_rule))
-    {
-        SWSS_LOG_ERROR("Failed to parse PB message for DASH ACL rule");
-        return false;
-    }
-
-    if (!from_pb(pb_rule, rule))
-    {
-        SWSS_LOG_ERROR("Failed to convert PB DASH ACL Rule");
-        return false;
-    }
-
-    return true;
-}
-
 void DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
 {
     SWSS_LOG_ENTER();
@@ -55,8 +55,8 @@ struct DashAclRuleInfo
 {
     sai_object_id_t m_dash_acl_rule_id = SAI_NULL_OBJECT_ID;
 
-    std::unordered_set<std::string> m_src_tags;
-    std::unordered_set<std::string> m_dst_tags;
+    // Kept to rebuild the rule when one of its tags changes
+    DashAclRule m_rule;
 
     DashAclRuleInfo() = default;
     DashAclRuleInfo(const DashAclRule &rule);
@@ -64,6 +64,24 @@ struct DashAclRuleInfo
     bool isTagUsed(const std::string &tag_id) const;
 };
 
+struct DashAclRuleBulkContext
+{
+    DashAclRuleInfo *rule_info;
+
+    std::vector<sai_attribute_t> attrs;
+    std::vector<std::uint8_t> protocols;
+    std::vector<sai_ip_prefix_t> src_prefixes;
+    std::vector<sai_ip_prefix_t> dst_prefixes;
+    std::vector<sai_u16_range_t> src_ports;
+    std::vector<sai_u16_range_t> dst_ports;
+    sai_status_t status = SAI_STATUS_NOT_EXECUTED;
+
+    DashAclRuleBulkContext(DashAclRuleInfo *rule_info) : rule_info(rule_info) {}
+
+    DashAclRuleBulkContext(const DashAclRuleBulkContext&) = delete;
+    DashAclRuleBulkContext(DashAclRuleBulkContext&&) = delete;
+};
+
 struct DashAclGroup
 {
     using EniTable = std::unordered_map<std::string, std::unordered_set<DashAclStage>>;
@@ -99,10 +117,9 @@ class DashAclGroupMgr
     DashOrch *m_dash_orch;
     DashAclOrch *m_dash_acl_orch;
     std::unordered_map<std::string, DashAclGroup> m_groups_table;
-    std::unique_ptr<swss::Table> m_dash_acl_rules_table;
 
 public:
-    DashAclGroupMgr(swss::DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch);
+    DashAclGroupMgr(DashOrch *dashorch, DashAclOrch *aclorch);
 
     task_process_status create(const std::string& group_id, DashAclGroup& group);
     task_process_status remove(const std::string& group_id);
@@ -124,9 +141,11 @@ private:
     void create(DashAclGroup& group);
     void remove(DashAclGroup& group);
 
-    DashAclRuleInfo createRule(DashAclGroup& group, DashAclRule& rule);
+    void getRuleAttrs(const DashAclGroup& group, DashAclRuleBulkContext& ctx);
+    void createRule(DashAclGroup& group, DashAclRuleInfo& rule);
+    void createRules(DashAclGroup& group, const std::vector<DashAclRuleInfo*>& rules);
     void removeRule(DashAclGroup& group, DashAclRuleInfo& rule);
-    bool fetchRule(const std::string &group_id, const std::string &rule_id, DashAclRule &rule);
+    void removeRules(DashAclGroup& group, const std::vector<DashAclRuleInfo*>& rules);
 
     void bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
     void unbind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
@@ -77,11 +77,13 @@ inline void lexical_convert(const string &buffer, DashAclStage &stage)
 DashAclOrch::DashAclOrch(DBConnector *db, const vector<string> &tables, DashOrch *dash_orch, ZmqServer *zmqServer) :
     ZmqOrch(db, tables, zmqServer),
     m_dash_orch(dash_orch),
-    m_group_mgr(db, dash_orch, this),
+    m_group_mgr(dash_orch, this),
     m_tag_mgr(this)
 
 {
     SWSS_LOG_ENTER();
+
+    setExecutionGroup(ORCH_GROUP_DASH, { ORCH_GROUP_COUNTERS });
 }
 
 DashAclGroupMgr& DashAclOrch::getDashAclGroupMgr()
@@ -38,6 +38,8 @@ extern CrmOrch *gCrmOrch;
 DashOrch::DashOrch(DBConnector *db, vector<string> &tableName, ZmqServer *zmqServer) : ZmqOrch(db, tableName, zmqServer)
 {
     SWSS_LOG_ENTER();
+
+    setExecutionGroup(ORCH_GROUP_DASH, { ORCH_GROUP_COUNTERS });
 }
 
 bool DashOrch::getRouteTypeActions(dash::route_type::RoutingType routing_type, dash::route_type::RouteType& route_type)
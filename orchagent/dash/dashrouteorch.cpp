@@ -49,6 +49,8 @@ DashRouteOrch::DashRouteOrch(DBConnector *db, vector<string> &tableName, DashOrc
     dash_orch_(dash_orch)
 {
     SWSS_LOG_ENTER();
+
+    setExecutionGroup(ORCH_GROUP_DASH, { ORCH_GROUP_COUNTERS });
 }
 
 bool DashRouteOrch::addOutboundRouting(const string& key, OutboundRoutingBulkContext& ctxt)
@@ -64,6 +64,12 @@ task_process_status DashTagMgr::update(const string& tag_id, const DashTag& new_
         return task_failed;
     }
 
+    if (tag.m_prefixes == new_tag.m_prefixes)
+    {
+        SWSS_LOG_INFO("Prefixes of tag %s are not changed, skip updating the ACL groups", tag_id.c_str());
+        return task_success;
+    }
+
     // Update tag prefixes
     tag.m_prefixes = new_tag.m_prefixes;
 
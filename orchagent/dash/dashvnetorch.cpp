@@ -44,6 +44,8 @@ DashVnetOrch::DashVnetOrch(DBConnector *db, vector<string> &tables, ZmqServer *z
     ZmqOrch(db, tables, zmqServer)
 {
     SWSS_LOG_ENTER();
+
+    setExecutionGroup(ORCH_GROUP_DASH, { ORCH_GROUP_COUNTERS });
 }
 
 bool DashVnetOrch::addVnet(const string& vnet_name, DashVnetBulkContext& ctxt)
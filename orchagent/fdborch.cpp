@@ -21,6 +21,7 @@ extern sai_object_id_t  gSwitchId;
 extern CrmOrch *        gCrmOrch;
 extern MlagOrch*        gMlagOrch;
 extern Directory<Orch*> gDirectory;
+extern size_t           gMaxBulkSize;
 
 const int FdbOrch::fdborch_pri = 20;
 
@@ -726,6 +727,11 @@ void FdbOrch::doTask(Consumer& consumer)
         origin = FDB_ORIGIN_MCLAG_ADVERTIZED;
     }
 
+    /* Adds, moves and removes are queued and programmed in bulk */
+    EntityBulker<sai_fdb_api_t> bulker(sai_fdb_api, gMaxBulkSize);
+    deque<FdbBulkContext> toBulk;
+    set<FdbEntry> bulkEntries;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -764,6 +770,13 @@ void FdbOrch::doTask(Consumer& consumer)
         entry.mac = MacAddress(keys[1]);
         entry.bv_id = vlan.m_vlan_info.vlan_oid;
 
+        /* A queued entry is completed before it is processed again */
+        if (bulkEntries.find(entry) != bulkEntries.end())
+        {
+            flushFdbBulk(consumer, bulker, toBulk);
+            bulkEntries.clear();
+        }
+
         if (op == SET_COMMAND)
         {
             string port = "";
@@ -851,58 +864,53 @@ void FdbOrch::doTask(Consumer& consumer)
             }
 
 
-            FdbData fdbData;
-            fdbData.bridge_port_id = SAI_NULL_OBJECT_ID;
-            fdbData.type = type;
-            fdbData.origin = origin;
-            fdbData.remote_ip = remote_ip;
-            fdbData.esi = esi;
-            fdbData.vni = vni;
-            fdbData.is_flush_pending = false;
-            if (addFdbEntry(entry, port, fdbData))
+            toBulk.emplace_back();
+            auto& ctx = toBulk.back();
+            ctx.entry = entry;
+            ctx.is_set = true;
+            ctx.origin = origin;
+            ctx.port_name = port;
+            ctx.vlan_id = vlan.m_vlan_info.vlan_id;
+            ctx.task = it++;
+
+            ctx.fdbData.bridge_port_id = SAI_NULL_OBJECT_ID;
+            ctx.fdbData.type = type;
+            ctx.fdbData.origin = origin;
+            ctx.fdbData.remote_ip = remote_ip;
+            ctx.fdbData.esi = esi;
+            ctx.fdbData.vni = vni;
+            ctx.fdbData.is_flush_pending = false;
+
+            bool done = addFdbEntry(bulker, ctx);
+            if (ctx.pending)
             {
-                if (origin == FDB_ORIGIN_MCLAG_ADVERTIZED)
-                {
-                    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
-                    if (type == "dynamic_local")
-                    {
-                        m_mclagFdbStateTable.del(key);
-                    }
-                }
-
-                if(origin == FDB_ORIGIN_VXLAN_ADVERTIZED)
-                {
-                    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
-
-                    if(!remote_ip.length())
-                    {
-                        it = consumer.m_toSync.erase(it);
-                        continue;
-                    }
-                    port = tunnel_orch->getTunnelPortName(remote_ip);
-                }
-                it = consumer.m_toSync.erase(it);
+                bulkEntries.insert(entry);
             }
             else
-                it++;
+            {
+                completeFdbTask(consumer, ctx, done);
+                toBulk.pop_back();
+            }
         }
         else if (op == DEL_COMMAND)
         {
-            if (removeFdbEntry(entry, origin))
+            toBulk.emplace_back();
+            auto& ctx = toBulk.back();
+            ctx.entry = entry;
+            ctx.origin = origin;
+            ctx.vlan_id = vlan.m_vlan_info.vlan_id;
+            ctx.task = it++;
+
+            bool done = removeFdbEntry(bulker, ctx);
+            if (ctx.pending)
             {
-                if (origin == FDB_ORIGIN_MCLAG_ADVERTIZED)
-                {
-                    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
-                    m_mclagFdbStateTable.del(key);
-                    SWSS_LOG_NOTICE("fdbEvent: do Task Delete MCLAG FDB from state mclag remote fdb table: "
-                            "Mac: %s Vlan: %d ",entry.mac.to_string().c_str(), vlan.m_vlan_info.vlan_id );
-                }
-
-                it = consumer.m_toSync.erase(it);
+                bulkEntries.insert(entry);
             }
             else
-                it++;
-
+            {
+                completeFdbTask(consumer, ctx, done);
+                toBulk.pop_back();
+            }
         }
         else
         {
@@ -910,6 +918,54 @@ void FdbOrch::doTask(Consumer& consumer)
             it = consumer.m_toSync.erase(it);
         }
     }
+
+    flushFdbBulk(consumer, bulker, toBulk);
+}
+
+void FdbOrch::flushFdbBulk(Consumer& consumer, EntityBulker<sai_fdb_api_t>& bulker, deque<FdbBulkContext>& toBulk)
+{
+    SWSS_LOG_ENTER();
+
+    if (toBulk.empty())
+    {
+        return;
+    }
+
+    bulker.flush();
+
+    for (auto& ctx : toBulk)
+    {
+        bool done = ctx.is_set ? addFdbEntryPost(ctx) : removeFdbEntryPost(ctx);
+        completeFdbTask(consumer, ctx, done);
+    }
+
+    toBulk.clear();
+}
+
+void FdbOrch::completeFdbTask(Consumer& consumer, const FdbBulkContext& ctx, bool done)
+{
+    if (!done)
+    {
+        /* Retried by the next doTask */
+        return;
+    }
+
+    if (ctx.origin == FDB_ORIGIN_MCLAG_ADVERTIZED)
+    {
+        string key = "Vlan" + to_string(ctx.vlan_id) + ":" + ctx.entry.mac.to_string();
+        if (!ctx.is_set)
+        {
+            m_mclagFdbStateTable.del(key);
+            SWSS_LOG_NOTICE("fdbEvent: do Task Delete MCLAG FDB from state mclag remote fdb table: "
+                    "Mac: %s Vlan: %d ", ctx.entry.mac.to_string().c_str(), ctx.vlan_id);
+        }
+        else if (ctx.fdbData.type == "dynamic_local")
+        {
+            m_mclagFdbStateTable.del(key);
+        }
+    }
+
+    consumer.m_toSync.erase(ctx.task);
 }
 
 void FdbOrch::doTask(NotificationConsumer& consumer)
@@ -1235,6 +1291,30 @@ void FdbOrch::updateVlanMember(const VlanMemberUpdate& update)
 bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         FdbData fdbData)
 {
+    /* Built per call like in doTask, so that it takes the current sai_fdb_api */
+    EntityBulker<sai_fdb_api_t> bulker(sai_fdb_api, gMaxBulkSize);
+    FdbBulkContext ctx;
+    ctx.entry = entry;
+    ctx.is_set = true;
+    ctx.origin = fdbData.origin;
+    ctx.port_name = port_name;
+    ctx.fdbData = fdbData;
+
+    bool done = addFdbEntry(bulker, ctx);
+    if (!ctx.pending)
+    {
+        return done;
+    }
+
+    bulker.flush();
+    return addFdbEntryPost(ctx);
+}
+
+bool FdbOrch::addFdbEntry(EntityBulker<sai_fdb_api_t>& bulker, FdbBulkContext& ctx)
+{
+    const FdbEntry& entry = ctx.entry;
+    const string& port_name = ctx.port_name;
+    FdbData& fdbData = ctx.fdbData;
     Port vlan;
     Port port;
     string end_point_ip = "";
@@ -1276,7 +1356,6 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         return true;
     }
 
-    sai_status_t status;
     sai_fdb_entry_t fdb_entry;
     fdb_entry.switch_id = gSwitchId;
     memcpy(fdb_entry.mac_address, entry.mac.getMac(), sizeof(sai_mac_t));
@@ -1460,11 +1539,63 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                 oldOrigin, fdbData.origin);
         for (auto itr : attrs)
         {
-            status = sai_fdb_api->set_fdb_entry_attribute(&fdb_entry, &itr);
+            ctx.set_attr_ids.push_back(itr.id);
+            ctx.set_statuses.emplace_back();
+            bulker.set_entry_attribute(&ctx.set_statuses.back(), &fdb_entry, &itr);
+        }
+    }
+    else
+    {
+        SWSS_LOG_INFO("MAC-Create %s FDB %s in %s on %s", fdbData.type.c_str(), entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str());
+
+        bulker.create_entry(&ctx.status, &fdb_entry, (uint32_t)attrs.size(), attrs.data());
+    }
+
+    ctx.pending = true;
+    ctx.macUpdate = macUpdate;
+    ctx.vlan_alias = vlan.m_alias;
+    ctx.vlan_id = vlan.m_vlan_info.vlan_id;
+    ctx.port_alias = port.m_alias;
+    ctx.old_port_alias = oldPort.m_alias;
+    ctx.oldType = oldType;
+    ctx.oldOrigin = oldOrigin;
+
+    return true;
+}
+
+bool FdbOrch::addFdbEntryPost(FdbBulkContext& ctx)
+{
+    const FdbEntry& entry = ctx.entry;
+    const string& port_name = ctx.port_name;
+    const FdbData& fdbData = ctx.fdbData;
+    const string& oldType = ctx.oldType;
+    FdbOrigin oldOrigin = ctx.oldOrigin;
+    bool macUpdate = ctx.macUpdate;
+    Port vlan;
+    Port port;
+    Port oldPort;
+
+    SWSS_LOG_ENTER();
+
+    ctx.pending = false;
+
+    /* Ports are looked up again, entries of the same bulk may have updated their counts */
+    if (!m_portsOrch->getPort(ctx.vlan_alias, vlan) || !m_portsOrch->getPort(ctx.port_alias, port))
+    {
+        SWSS_LOG_ERROR("Failed to locate vlan %s or port %s of FDB %s",
+                ctx.vlan_alias.c_str(), ctx.port_alias.c_str(), entry.mac.to_string().c_str());
+        return false;
+    }
+
+    if (macUpdate)
+    {
+        for (size_t i = 0; i < ctx.set_statuses.size(); i++)
+        {
+            sai_status_t status = ctx.set_statuses[i];
             if (status != SAI_STATUS_SUCCESS)
             {
                 SWSS_LOG_ERROR("macUpdate-Failed for attr.id=0x%x for FDB %s in %s on %s, rv:%d",
-                            itr.id, entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str(), status);
+                            ctx.set_attr_ids[i], entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str(), status);
                 task_process_status handle_status = handleSaiSetStatus(SAI_API_FDB, status);
                 if (handle_status != task_success)
                 {
@@ -1472,25 +1603,25 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                 }
             }
         }
-        if (oldPort.m_bridge_port_id != port.m_bridge_port_id)
+        if (ctx.old_port_alias != ctx.port_alias)
         {
-            oldPort.m_fdb_count--;
-            m_portsOrch->setPort(oldPort.m_alias, oldPort);
+            if (m_portsOrch->getPort(ctx.old_port_alias, oldPort))
+            {
+                oldPort.m_fdb_count--;
+                m_portsOrch->setPort(oldPort.m_alias, oldPort);
+            }
             port.m_fdb_count++;
             m_portsOrch->setPort(port.m_alias, port);
         }
     }
     else
     {
-        SWSS_LOG_INFO("MAC-Create %s FDB %s in %s on %s", fdbData.type.c_str(), entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str());
-
-        status = sai_fdb_api->create_fdb_entry(&fdb_entry, (uint32_t)attrs.size(), attrs.data());
-        if (status != SAI_STATUS_SUCCESS)
+        if (ctx.status != SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_ERROR("Failed to create %s FDB %s in %s on %s, rv:%d",
                     fdbData.type.c_str(), entry.mac.to_string().c_str(),
-                    vlan.m_alias.c_str(), port_name.c_str(), status);
-            task_process_status handle_status = handleSaiCreateStatus(SAI_API_FDB, status); //FIXME: it should be based on status. Some could be retried, some not
+                    vlan.m_alias.c_str(), port_name.c_str(), ctx.status);
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_FDB, ctx.status); //FIXME: it should be based on status. Some could be retried, some not
             if (handle_status != task_success)
             {
                 return parseHandleSaiStatusFailure(handle_status);
@@ -1510,7 +1641,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         //If the MAC is dynamic_local change the origin accordingly
         //MAC is added/updated as dynamic to allow aging.
         SWSS_LOG_INFO("MAC-Update Modify to dynamic FDB %s in %s on from-%s:to-%s from-%s:to-%s origin-%d-to-%d",
-                entry.mac.to_string().c_str(), vlan.m_alias.c_str(), oldPort.m_alias.c_str(),
+                entry.mac.to_string().c_str(), vlan.m_alias.c_str(), ctx.old_port_alias.c_str(),
                 port_name.c_str(), oldType.c_str(), fdbData.type.c_str(), 
                 oldOrigin, fdbData.origin);
 
@@ -1586,6 +1717,25 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
 
 bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
 {
+    EntityBulker<sai_fdb_api_t> bulker(sai_fdb_api, gMaxBulkSize);
+    FdbBulkContext ctx;
+    ctx.entry = entry;
+    ctx.origin = origin;
+
+    bool done = removeFdbEntry(bulker, ctx);
+    if (!ctx.pending)
+    {
+        return done;
+    }
+
+    bulker.flush();
+    return removeFdbEntryPost(ctx);
+}
+
+bool FdbOrch::removeFdbEntry(EntityBulker<sai_fdb_api_t>& bulker, FdbBulkContext& ctx)
+{
+    const FdbEntry& entry = ctx.entry;
+    FdbOrigin origin = ctx.origin;
     Port vlan;
     Port port;
 
@@ -1646,26 +1796,54 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
         }
     }
 
-    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
-
-    sai_status_t status;
     sai_fdb_entry_t fdb_entry;
     fdb_entry.switch_id = gSwitchId;
     memcpy(fdb_entry.mac_address, entry.mac.getMac(), sizeof(sai_mac_t));
     fdb_entry.bv_id = entry.bv_id;
 
-    status = sai_fdb_api->remove_fdb_entry(&fdb_entry);
-    if (status != SAI_STATUS_SUCCESS)
+    bulker.remove_entry(&ctx.status, &fdb_entry);
+
+    ctx.pending = true;
+    ctx.fdbData = fdbData;
+    ctx.vlan_alias = vlan.m_alias;
+    ctx.vlan_id = vlan.m_vlan_info.vlan_id;
+    ctx.port_alias = port.m_alias;
+
+    return true;
+}
+
+bool FdbOrch::removeFdbEntryPost(FdbBulkContext& ctx)
+{
+    const FdbEntry& entry = ctx.entry;
+    const FdbData& fdbData = ctx.fdbData;
+    Port vlan;
+    Port port;
+
+    SWSS_LOG_ENTER();
+
+    ctx.pending = false;
+
+    if (ctx.status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("FdbOrch RemoveFDBEntry: Failed to remove FDB entry. mac=%s, bv_id=0x%" PRIx64,
                        entry.mac.to_string().c_str(), entry.bv_id);
-        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_FDB, status); //FIXME: it should be based on status. Some could be retried. some not
+        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_FDB, ctx.status); //FIXME: it should be based on status. Some could be retried. some not
         if (handle_status != task_success)
         {
             return parseHandleSaiStatusFailure(handle_status);
         }
     }
 
+    /* Ports are looked up again, entries of the same bulk may have updated their counts */
+    if (!m_portsOrch->getPort(ctx.vlan_alias, vlan) || !m_portsOrch->getPort(ctx.port_alias, port))
+    {
+        SWSS_LOG_ERROR("Failed to locate vlan %s or port %s of FDB %s",
+                ctx.vlan_alias.c_str(), ctx.port_alias.c_str(), entry.mac.to_string().c_str());
+        return false;
+    }
+
+    string key = "Vlan" + to_string(ctx.vlan_id) + ":" + entry.mac.to_string();
+
     SWSS_LOG_INFO("Removed mac=%s bv_id=0x%" PRIx64 " port:%s",
             entry.mac.to_string().c_str(), entry.bv_id, port.m_alias.c_str());
 
@@ -4,6 +4,7 @@
 #include "orch.h"
 #include "observer.h"
 #include "portsorch.h"
+#include "bulker.h"
 
 enum FdbOrigin
 {
@@ -80,6 +81,34 @@ struct SavedFdbEntry
 
 typedef unordered_map<string, vector<SavedFdbEntry>> fdb_entries_by_port_t;
 
+/*
+ * FDB add or remove queued in the FDB bulker. The request is checked and
+ * queued by addFdbEntry/removeFdbEntry, the SAI statuses are handled and the
+ * FDB state is updated by addFdbEntryPost/removeFdbEntryPost after the flush.
+ */
+struct FdbBulkContext
+{
+    FdbEntry entry;
+    bool is_set = false;
+    FdbOrigin origin = FDB_ORIGIN_PROVISIONED;
+    string port_name;
+    FdbData fdbData;                        // Requested data on add, stored data on remove
+    unsigned short vlan_id = 0;
+    SyncMap::iterator task;                 // Consumer task, set by doTask
+
+    bool pending = false;                   // Queued in the bulker
+    bool macUpdate = false;
+    string vlan_alias;
+    string port_alias;
+    string old_port_alias;
+    string oldType;
+    FdbOrigin oldOrigin = FDB_ORIGIN_INVALID;
+
+    sai_status_t status = SAI_STATUS_NOT_EXECUTED;
+    vector<sai_attr_id_t> set_attr_ids;
+    deque<sai_status_t> set_statuses;       // Stable addresses for the bulker
+};
+
 class FdbOrch: public Orch, public Subject, public Observer
 {
 public:
@@ -122,6 +151,12 @@ private:
     void updatePortOperState(const PortOperStateUpdate&);
 
     bool addFdbEntry(const FdbEntry&, const string&, FdbData fdbData);
+    bool addFdbEntry(EntityBulker<sai_fdb_api_t>&, FdbBulkContext&);
+    bool addFdbEntryPost(FdbBulkContext&);
+    bool removeFdbEntry(EntityBulker<sai_fdb_api_t>&, FdbBulkContext&);
+    bool removeFdbEntryPost(FdbBulkContext&);
+    void flushFdbBulk(Consumer&, EntityBulker<sai_fdb_api_t>&, deque<FdbBulkContext>&);
+    void completeFdbTask(Consumer&, const FdbBulkContext&, bool);
     void deleteFdbEntryFromSavedFDB(const MacAddress &mac, const unsigned short &vlanId, FdbOrigin origin, const string portName="");
 
     bool storeFdbEntryState(const FdbUpdate& update);
@@ -0,0 +1,146 @@
+#ifndef SWSS_FLUSHPOLICY_H
+#define SWSS_FLUSHPOLICY_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "table.h"
+
+/*
+ * FlushPolicy decides when OrchDaemon flushes the sairedis pipeline.
+ *
+ * The number of SAI operations in the pipeline is not known to orchagent,
+ * so the tasks popped by the consumers since the last flush are used as an
+ * estimate. The pipeline is flushed when:
+ * - the pending tasks reach the threshold,
+ * - the oldest pending task is older than the max age,
+ * - the select loop goes idle,
+ * plus the existing periodic and warm restart flushes.
+ */
+class FlushPolicy
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    enum Reason
+    {
+        FLUSH_REASON_THRESHOLD,
+        FLUSH_REASON_DEADLINE,
+        FLUSH_REASON_IDLE,
+        FLUSH_REASON_PERIODIC,
+        FLUSH_REASON_WARM_RESTART,
+        FLUSH_REASON_COUNT
+    };
+
+    FlushPolicy(uint64_t threshold, std::chrono::milliseconds maxAge)
+        : m_threshold(std::max<uint64_t>(threshold, 1)), m_maxAge(maxAge)
+    {
+    }
+
+    /* Account the tasks submitted so far, 'submitted' is a running total */
+    void update(uint64_t submitted, Clock::time_point now)
+    {
+        if (submitted == m_submitted)
+        {
+            return;
+        }
+
+        if (m_pending == 0)
+        {
+            m_oldest = now;
+        }
+
+        m_pending += submitted - m_submitted;
+        m_submitted = submitted;
+    }
+
+    uint64_t pending() const
+    {
+        return m_pending;
+    }
+
+    /* Whether the pending tasks hit the threshold or the max age */
+    bool check(Clock::time_point now, Reason &reason) const
+    {
+        if (m_pending == 0)
+        {
+            return false;
+        }
+
+        if (m_pending >= m_threshold)
+        {
+            reason = FLUSH_REASON_THRESHOLD;
+            return true;
+        }
+
+        if (now - m_oldest >= m_maxAge)
+        {
+            reason = FLUSH_REASON_DEADLINE;
+            return true;
+        }
+
+        return false;
+    }
+
+    /* Select timeout in ms which wakes the loop up at the max age deadline */
+    int selectTimeout(Clock::time_point now, int idleTimeout) const
+    {
+        if (m_pending == 0)
+        {
+            return idleTimeout;
+        }
+
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(m_oldest + m_maxAge - now).count();
+        return static_cast<int>(std::max<int64_t>(0, std::min<int64_t>(left, idleTimeout)));
+    }
+
+    void flushed(Reason reason)
+    {
+        m_flushes[reason]++;
+
+        if (m_pending != 0)
+        {
+            m_batches++;
+            m_flushedTasks += m_pending;
+            m_maxBatch = std::max(m_maxBatch, m_pending);
+            m_pending = 0;
+        }
+    }
+
+    uint64_t getFlushes(Reason reason) const
+    {
+        return m_flushes[reason];
+    }
+
+    std::vector<swss::FieldValueTuple> toFieldValues() const
+    {
+        return {
+            { "threshold", std::to_string(m_flushes[FLUSH_REASON_THRESHOLD]) },
+            { "deadline", std::to_string(m_flushes[FLUSH_REASON_DEADLINE]) },
+            { "idle", std::to_string(m_flushes[FLUSH_REASON_IDLE]) },
+            { "periodic", std::to_string(m_flushes[FLUSH_REASON_PERIODIC]) },
+            { "warm_restart", std::to_string(m_flushes[FLUSH_REASON_WARM_RESTART]) },
+            { "batches", std::to_string(m_batches) },
+            { "avg_batch", std::to_string(m_batches ? m_flushedTasks / m_batches : 0) },
+            { "max_batch", std::to_string(m_maxBatch) },
+        };
+    }
+
+private:
+    uint64_t m_threshold;
+    std::chrono::milliseconds m_maxAge;
+
+    uint64_t m_submitted = 0;
+    uint64_t m_pending = 0;
+    Clock::time_point m_oldest;
+
+    uint64_t m_flushes[FLUSH_REASON_COUNT] = {};
+    uint64_t m_batches = 0;         // Flushes with pending tasks
+    uint64_t m_flushedTasks = 0;
+    uint64_t m_maxBatch = 0;
+};
+
+#endif /* SWSS_FLUSHPOLICY_H */
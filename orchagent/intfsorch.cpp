@@ -38,6 +38,7 @@ extern NeighOrch *gNeighOrch;
 extern string gMySwitchType;
 extern int32_t gVoqMySwitchId;
 extern bool gTraditionalFlexCounter;
+extern size_t gMaxBulkSize;
 
 const int intfsorch_pri = 35;
 
@@ -494,13 +495,7 @@ bool IntfsOrch::setIntf(const string& alias, sai_object_id_t vrf_id, const IpPre
     {
         if (!ip_prefix && addRouterIntfs(vrf_id, port, loopbackAction))
         {
-            gPortsOrch->increasePortRefCount(alias);
-            IntfsEntry intfs_entry;
-            intfs_entry.ref_count = 0;
-            intfs_entry.proxy_arp = false;
-            intfs_entry.vrf_id = vrf_id;
-            m_syncdIntfses[alias] = intfs_entry;
-            m_vrfOrch->increaseVrfRefCount(vrf_id);
+            addSyncdIntf(alias, vrf_id);
         }
         else
         {
@@ -634,9 +629,7 @@ bool IntfsOrch::removeIntf(const string& alias, sai_object_id_t vrf_id, const Ip
     {
         if (m_syncdIntfses[alias].ip_addresses.size() == 0 && removeRouterIntfs(port))
         {
-            gPortsOrch->decreasePortRefCount(alias);
-            m_syncdIntfses.erase(alias);
-            m_vrfOrch->decreaseVrfRefCount(vrf_id);
+            removeSyncdIntf(alias, vrf_id);
 
             if (port.m_type == Port::SUBPORT)
             {
@@ -657,6 +650,24 @@ bool IntfsOrch::removeIntf(const string& alias, sai_object_id_t vrf_id, const Ip
     return true;
 }
 
+void IntfsOrch::addSyncdIntf(const string &alias, sai_object_id_t vrf_id)
+{
+    gPortsOrch->increasePortRefCount(alias);
+    IntfsEntry intfs_entry;
+    intfs_entry.ref_count = 0;
+    intfs_entry.proxy_arp = false;
+    intfs_entry.vrf_id = vrf_id;
+    m_syncdIntfses[alias] = intfs_entry;
+    m_vrfOrch->increaseVrfRefCount(vrf_id);
+}
+
+void IntfsOrch::removeSyncdIntf(const string &alias, sai_object_id_t vrf_id)
+{
+    gPortsOrch->decreasePortRefCount(alias);
+    m_syncdIntfses.erase(alias);
+    m_vrfOrch->decreaseVrfRefCount(vrf_id);
+}
+
 void IntfsOrch::doTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
@@ -666,8 +677,91 @@ void IntfsOrch::doTask(Consumer &consumer)
         return;
     }
 
+    ObjectBulker<sai_router_interface_api_t> rifBulker(sai_router_intfs_api, gSwitchId, gMaxBulkSize);
+    deque<RifBulkContext> toBulk;
+
+    /* Router interfaces to create or remove are queued and flushed in bulk */
+    doIntfTask(consumer, &rifBulker, toBulk);
+    if (toBulk.empty())
+    {
+        return;
+    }
+
+    flushRouterIntfsBulk(consumer, rifBulker, toBulk);
+
+    /* Then the remaining tasks of those interfaces are done in order */
+    doIntfTask(consumer, nullptr, toBulk);
+}
+
+void IntfsOrch::flushRouterIntfsBulk(Consumer &consumer, ObjectBulker<sai_router_interface_api_t> &rifBulker, deque<RifBulkContext> &toBulk)
+{
+    SWSS_LOG_ENTER();
+
+    rifBulker.flush();
+
+    for (auto &ctx : toBulk)
+    {
+        Port port;
+        if (!gPortsOrch->getPort(ctx.alias, port))
+        {
+            SWSS_LOG_ERROR("Failed to get port %s", ctx.alias.c_str());
+            continue;
+        }
+
+        if (ctx.is_set)
+        {
+            if (ctx.rif_id == SAI_NULL_OBJECT_ID)
+            {
+                /* The creation is retried without bulk by the second pass, which handles the error */
+                SWSS_LOG_ERROR("Failed to create router interface %s in bulk", ctx.alias.c_str());
+                continue;
+            }
+
+            port.m_rif_id = ctx.rif_id;
+            addRouterIntfsPost(ctx.vrf_id, port);
+            addSyncdIntf(ctx.alias, ctx.vrf_id);
+            continue;
+        }
+
+        if (ctx.status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove router interface for port %s, rv:%d", ctx.alias.c_str(), ctx.status);
+            if (handleSaiRemoveStatus(SAI_API_ROUTER_INTERFACE, ctx.status) != task_success)
+            {
+                throw runtime_error("Failed to remove router interface.");
+            }
+        }
+
+        removeRouterIntfsPost(port);
+        removeSyncdIntf(ctx.alias, ctx.vrf_id);
+
+        if (port.m_type == Port::SUBPORT && !gPortsOrch->removeSubPort(ctx.alias))
+        {
+            m_removingIntfses.insert(ctx.alias);
+            continue;
+        }
+
+        m_removingIntfses.erase(ctx.alias);
+        consumer.m_toSync.erase(ctx.task);
+    }
+}
+
+void IntfsOrch::doIntfTask(Consumer &consumer, ObjectBulker<sai_router_interface_api_t> *rifBulker, deque<RifBulkContext> &toBulk)
+{
+    SWSS_LOG_ENTER();
+
     string table_name = consumer.getTableName();
 
+    /*
+     * Interfaces with a router interface in bulk. The first pass leaves their
+     * later tasks in place, the second pass does only their tasks.
+     */
+    set<string> bulkAliases;
+    for (const auto &ctx : toBulk)
+    {
+        bulkAliases.insert(ctx.alias);
+    }
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -675,6 +769,12 @@ void IntfsOrch::doTask(Consumer &consumer)
         vector<string> keys = tokenize(kfvKey(t), ':');
         string alias(keys[0]);
 
+        if ((rifBulker != nullptr) == (bulkAliases.find(alias) != bulkAliases.end()))
+        {
+            it++;
+            continue;
+        }
+
         bool isSubIntf = false;
         size_t found = alias.find(VLAN_SUB_INTERFACE_SEPARATOR);
         if (found != string::npos)
@@ -903,6 +1003,13 @@ void IntfsOrch::doTask(Consumer &consumer)
                         continue;
                     }
                 }
+                else if (!isSubIntf && table_name != CHASSIS_APP_SYSTEM_INTERFACE_TABLE_NAME &&
+                         alias.compare(0, strlen(VLAN_PREFIX), VLAN_PREFIX))
+                {
+                    /* Wait for PortsOrch to create the port or LAG, see update() */
+                    it = consumer.parkTask(it, make_pair(RETRY_CST_PORT, alias));
+                    continue;
+                }
                 else
                 {
                     /* TODO: Resolve the dependency relationship and add ref_count to port */
@@ -948,6 +1055,26 @@ void IntfsOrch::doTask(Consumer &consumer)
                     adminUp = port.m_admin_state_up;
                 }
 
+                if (rifBulker && !ip_prefix_in_key && table_name != CHASSIS_APP_SYSTEM_INTERFACE_TABLE_NAME &&
+                    !port.m_rif_id && m_syncdIntfses.find(alias) == m_syncdIntfses.end() &&
+                    m_removingIntfses.find(alias) == m_removingIntfses.end())
+                {
+                    vector<sai_attribute_t> attrs;
+                    getRouterIntfsAttributes(vrf_id, port, loopbackAction, attrs);
+
+                    toBulk.emplace_back();
+                    auto &ctx = toBulk.back();
+                    ctx.is_set = true;
+                    ctx.alias = alias;
+                    ctx.vrf_id = vrf_id;
+                    ctx.task = it;
+                    rifBulker->create_entry(&ctx.rif_id, (uint32_t)attrs.size(), attrs.data());
+
+                    bulkAliases.insert(alias);
+                    it++;
+                    continue;
+                }
+
                 if (!setIntf(alias, vrf_id, ip_prefix_in_key ? &ip_prefix : nullptr, adminUp, mtu, loopbackAction))
                 {
                     it++;
@@ -1113,6 +1240,25 @@ void IntfsOrch::doTask(Consumer &consumer)
             }
             else
             {
+                if (rifBulker && !ip_prefix_in_key && port.m_rif_id &&
+                    m_syncdIntfses[alias].ip_addresses.empty() && m_syncdIntfses[alias].ref_count == 0)
+                {
+                    removeRifFromFlexCounter(sai_serialize_object_id(port.m_rif_id), alias);
+
+                    toBulk.emplace_back();
+                    auto &ctx = toBulk.back();
+                    ctx.is_set = false;
+                    ctx.alias = alias;
+                    ctx.vrf_id = port.m_vr_id;
+                    ctx.rif_id = port.m_rif_id;
+                    ctx.task = it;
+                    rifBulker->remove_entry(&ctx.status, port.m_rif_id);
+
+                    bulkAliases.insert(alias);
+                    it++;
+                    continue;
+                }
+
                 if (removeIntf(alias, port.m_vr_id, ip_prefix_in_key ? &ip_prefix : nullptr))
                 {
                     m_removingIntfses.erase(alias);
@@ -1163,8 +1309,28 @@ bool IntfsOrch::addRouterIntfs(sai_object_id_t vrf_id, Port &port, string loopba
     }
 
     /* Create router interface if the router interface doesn't exist */
-    sai_attribute_t attr;
     vector<sai_attribute_t> attrs;
+    getRouterIntfsAttributes(vrf_id, port, loopbackActionStr, attrs);
+
+    sai_status_t status = sai_router_intfs_api->create_router_interface(&port.m_rif_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to create router interface %s, rv:%d",
+                port.m_alias.c_str(), status);
+        if (handleSaiCreateStatus(SAI_API_ROUTER_INTERFACE, status) != task_success)
+        {
+            throw runtime_error("Failed to create router interface.");
+        }
+    }
+
+    addRouterIntfsPost(vrf_id, port);
+
+    return true;
+}
+
+void IntfsOrch::getRouterIntfsAttributes(sai_object_id_t vrf_id, const Port &port, const string &loopbackActionStr, vector<sai_attribute_t> &attrs)
+{
+    sai_attribute_t attr;
 
     attr.id = SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID;
     attr.value.oid = vrf_id;
@@ -1278,18 +1444,10 @@ bool IntfsOrch::addRouterIntfs(sai_object_id_t vrf_id, Port &port, string loopba
         SWSS_LOG_INFO("Assigning NAT zone id %d to interface %s\n", attr.value.u32, port.m_alias.c_str());
         attrs.push_back(attr);
     }
+}
 
-    sai_status_t status = sai_router_intfs_api->create_router_interface(&port.m_rif_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to create router interface %s, rv:%d",
-                port.m_alias.c_str(), status);
-        if (handleSaiCreateStatus(SAI_API_ROUTER_INTERFACE, status) != task_success)
-        {
-            throw runtime_error("Failed to create router interface.");
-        }
-    }
-
+void IntfsOrch::addRouterIntfsPost(sai_object_id_t vrf_id, Port &port)
+{
     port.m_vr_id = vrf_id;
 
     gPortsOrch->setPort(port.m_alias, port);
@@ -1302,8 +1460,6 @@ bool IntfsOrch::addRouterIntfs(sai_object_id_t vrf_id, Port &port, string loopba
         // Sync the interface of local port/LAG to the SYSTEM_INTERFACE table of CHASSIS_APP_DB
         voqSyncAddIntf(port.m_alias);
     }
-
-    return true;
 }
 
 bool IntfsOrch::removeRouterIntfs(Port &port)
@@ -1329,6 +1485,13 @@ bool IntfsOrch::removeRouterIntfs(Port &port)
         }
     }
 
+    removeRouterIntfsPost(port);
+
+    return true;
+}
+
+void IntfsOrch::removeRouterIntfsPost(Port &port)
+{
     port.m_rif_id = 0;
     port.m_vr_id = 0;
     port.m_nat_zone_id = 0;
@@ -1342,8 +1505,6 @@ bool IntfsOrch::removeRouterIntfs(Port &port)
         // Sync the removal of interface of local port/LAG to the SYSTEM_INTERFACE table of CHASSIS_APP_DB
         voqSyncDelIntf(port.m_alias);
     }
-
-    return true;
 }
 
 void IntfsOrch::addIp2MeRoute(sai_object_id_t vrf_id, const IpPrefix &ip_prefix)
@@ -1500,19 +1661,28 @@ void IntfsOrch::removeDirectedBroadcast(const Port &port, const IpPrefix &ip_pre
 void IntfsOrch::addRifToFlexCounter(const string &id, const string &name, const string &type)
 {
     SWSS_LOG_ENTER();
-    /* update RIF maps in COUNTERS_DB */
-    vector<FieldValueTuple> rifNameVector;
-    vector<FieldValueTuple> rifTypeVector;
 
-    rifNameVector.emplace_back(name, id);
-    rifTypeVector.emplace_back(id, type);
+    addRifsToFlexCounter({ FieldValueTuple(name, id) }, { FieldValueTuple(id, type) });
+}
+
+/*
+ * Register several RIFs at once, rifNameVector holds the (name, id) and
+ * rifTypeVector the (id, type) pairs, in the same order.
+ */
+void IntfsOrch::addRifsToFlexCounter(const vector<FieldValueTuple> &rifNameVector, const vector<FieldValueTuple> &rifTypeVector)
+{
+    SWSS_LOG_ENTER();
+
+    if (rifNameVector.empty())
+    {
+        return;
+    }
 
+    /* update RIF maps in COUNTERS_DB, one write for all the RIFs */
     m_rifNameTable->set("", rifNameVector);
     m_rifTypeTable->set("", rifTypeVector);
 
     /* update RIF in FLEX_COUNTER_DB */
-    string key = getRifFlexCounterTableKey(id);
-
     std::ostringstream counters_stream;
     for (const auto& it: rifStatIds)
     {
@@ -1520,10 +1690,15 @@ void IntfsOrch::addRifToFlexCounter(const string &id, const string &name, const
     }
     auto &&counters_str = counters_stream.str();
 
-    /* check the state of intf, if registering the intf to FC will result in runtime error */
-    startFlexCounterPolling(gSwitchId, key, counters_str.c_str(), RIF_COUNTER_ID_LIST);
+    for (const auto &rif: rifNameVector)
+    {
+        string key = getRifFlexCounterTableKey(fvValue(rif));
+
+        /* check the state of intf, if registering the intf to FC will result in runtime error */
+        startFlexCounterPolling(gSwitchId, key, counters_str.c_str(), RIF_COUNTER_ID_LIST);
 
-    SWSS_LOG_DEBUG("Registered interface %s to Flex counter", name.c_str());
+        SWSS_LOG_DEBUG("Registered interface %s to Flex counter", fvField(rif).c_str());
+    }
 }
 
 void IntfsOrch::removeRifFromFlexCounter(const string &id, const string &name)
@@ -1574,7 +1749,10 @@ void IntfsOrch::doTask(SelectableTimer &timer)
 
     SWSS_LOG_DEBUG("Registering %" PRId64 " new intfs", m_rifsToAdd.size());
     string value;
-    for (auto it = m_rifsToAdd.begin(); it != m_rifsToAdd.end(); )
+    vector<FieldValueTuple> rifNameVector;
+    vector<FieldValueTuple> rifTypeVector;
+    std::vector<Port> rifsNotReady;
+    for (auto it = m_rifsToAdd.begin(); it != m_rifsToAdd.end(); ++it)
     {
         const auto id = sai_serialize_object_id(it->m_rif_id);
         SWSS_LOG_INFO("Registering %s, id %s", it->m_alias.c_str(), id.c_str());
@@ -1600,14 +1778,40 @@ void IntfsOrch::doTask(SelectableTimer &timer)
         if (!gTraditionalFlexCounter || m_vidToRidTable->hget("", id, value))
         {
             SWSS_LOG_INFO("Registering %s it is ready", it->m_alias.c_str());
-            addRifToFlexCounter(id, it->m_alias, type);
-            it = m_rifsToAdd.erase(it);
+            rifNameVector.emplace_back(it->m_alias, id);
+            rifTypeVector.emplace_back(id, type);
         }
         else
         {
-            ++it;
+            rifsNotReady.push_back(*it);
         }
     }
+
+    addRifsToFlexCounter(rifNameVector, rifTypeVector);
+    m_rifsToAdd.swap(rifsNotReady);
+}
+
+void IntfsOrch::update(SubjectType type, void *cntx)
+{
+    SWSS_LOG_ENTER();
+
+    if (type != SUBJECT_TYPE_PORT_CHANGE)
+    {
+        return;
+    }
+
+    PortUpdate *update = static_cast<PortUpdate *>(cntx);
+    if (!update->add)
+    {
+        return;
+    }
+
+    /* Wake the interfaces parked until this port or LAG is created */
+    size_t woken = resolveConstraint(make_pair(RETRY_CST_PORT, update->port.m_alias));
+    if (woken > 0)
+    {
+        SWSS_LOG_INFO("Port %s created, %zu interface task(s) to retry", update->port.m_alias.c_str(), woken);
+    }
 }
 
 bool IntfsOrch::isRemoteSystemPortIntf(string alias)
@@ -5,6 +5,7 @@
 #include "portsorch.h"
 #include "vrforch.h"
 #include "timer.h"
+#include "bulker.h"
 
 #include "ipaddresses.h"
 #include "ipprefix.h"
@@ -12,6 +13,7 @@
 
 #include <map>
 #include <set>
+#include <deque>
 
 extern sai_object_id_t gVirtualRouterId;
 extern MacAddress gMacAddress;
@@ -30,7 +32,17 @@ struct IntfsEntry
 
 typedef map<string, IntfsEntry> IntfsTable;
 
-class IntfsOrch : public Orch
+struct RifBulkContext
+{
+    bool                is_set;     // create or remove the router interface
+    string              alias;
+    sai_object_id_t     vrf_id;
+    sai_object_id_t     rif_id;     // set by the bulker on creation
+    sai_status_t        status;     // set by the bulker on removal
+    SyncMap::iterator   task;
+};
+
+class IntfsOrch : public Orch, public Observer
 {
 public:
     IntfsOrch(DBConnector *db, string tableName, VRFOrch *vrf_orch, DBConnector *chassisAppDb);
@@ -53,6 +65,7 @@ public:
 
     void generateInterfaceMap();
     void addRifToFlexCounter(const string&, const string&, const string&);
+    void addRifsToFlexCounter(const vector<FieldValueTuple>&, const vector<FieldValueTuple>&);
     void removeRifFromFlexCounter(const string&, const string&);
 
     bool setIntfLoopbackAction(const Port &port, string actionStr);
@@ -74,6 +87,8 @@ public:
     bool isLocalSystemPortIntf(string alias);
     void voqSyncIntfState(string &alias, bool);
 
+    void update(SubjectType type, void *cntx);
+
 private:
 
     SelectableTimer* m_updateMapsTimer = nullptr;
@@ -84,6 +99,8 @@ private:
     map<string, string> m_vnetInfses;
     void doTask(Consumer &consumer);
     void doTask(SelectableTimer &timer);
+    void doIntfTask(Consumer &consumer, ObjectBulker<sai_router_interface_api_t> *rifBulker, deque<RifBulkContext> &toBulk);
+    void flushRouterIntfsBulk(Consumer &consumer, ObjectBulker<sai_router_interface_api_t> &rifBulker, deque<RifBulkContext> &toBulk);
 
     shared_ptr<DBConnector> m_counter_db;
     shared_ptr<DBConnector> m_asic_db;
@@ -97,6 +114,11 @@ private:
 
     bool addRouterIntfs(sai_object_id_t vrf_id, Port &port, string loopbackAction);
     bool removeRouterIntfs(Port &port);
+    void getRouterIntfsAttributes(sai_object_id_t vrf_id, const Port &port, const string &loopbackActionStr, vector<sai_attribute_t> &attrs);
+    void addRouterIntfsPost(sai_object_id_t vrf_id, Port &port);
+    void removeRouterIntfsPost(Port &port);
+    void addSyncdIntf(const string &alias, sai_object_id_t vrf_id);
+    void removeSyncdIntf(const string &alias, sai_object_id_t vrf_id);
 
     void addDirectedBroadcast(const Port &port, const IpPrefix &ip_prefix);
     void removeDirectedBroadcast(const Port &port, const IpPrefix &ip_prefix);
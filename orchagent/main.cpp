@@ -48,15 +48,20 @@ MacAddress gMacAddress;
 MacAddress gVxlanMacAddress;
 
 extern size_t gMaxBulkSize;
+extern size_t gFlushThreshold;
+extern unsigned int gFlushMaxAgeMsecs;
 
 #define DEFAULT_BATCH_SIZE  128
 extern int gBatchSize;
+extern size_t gConsumerTaskBudget;
+extern uint64_t gConsumerUsecBudget;
 
 bool gSyncMode = false;
 sai_redis_communication_mode_t gRedisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
 string gAsicInstance;
 
 extern bool gIsNatSupported;
+extern bool gConsumerStatsEnabled;
 
 #define SAIREDIS_RECORD_ENABLE 0x1
 #define SWSS_RECORD_ENABLE (0x1 << 1)
@@ -72,7 +77,7 @@ bool gTraditionalFlexCounter = false;
 
 void usage()
 {
-    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode]" << endl;
+    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-p] [-l flush_threshold] [-a flush_max_age] [-w rec_mode] [-t task_budget] [-u time_budget]" << endl;
     cout << "    -h: display this message" << endl;
     cout << "    -r record_type: record orchagent logs with type (default 3)" << endl;
     cout << "                    Bit 0: sairedis.rec, Bit 1: swss.rec, Bit 2: responsepublisher.rec. For example:" << endl;
@@ -82,6 +87,10 @@ void usage()
     cout << "                    3: enable both above two records" << endl;
     cout << "                    7: enable sairedis.rec, swss.rec and responsepublisher.rec" << endl;
     cout << "    -d record_location: set record logs folder location (default .)" << endl;
+    cout << "    -w rec_mode: swss.rec and responsepublisher.rec writer mode (default sync)" << endl;
+    cout << "                 sync: write each record from the caller" << endl;
+    cout << "                 async: queue the records to a writer thread" << endl;
+    cout << "                 binary, async_binary: same, in binary format to <file>.bin" << endl;
     cout << "    -b batch_size: set consumer table pop operation batch size (default 128)" << endl;
     cout << "    -m MAC: set switch MAC address" << endl;
     cout << "    -i INST_ID: set the ASIC instance_id in multi-asic platform" << endl;
@@ -92,6 +101,11 @@ void usage()
     cout << "    -k max bulk size in bulk mode (default 1000)" << endl;
     cout << "    -q zmq_server_address: ZMQ server address (default disable ZMQ)" << endl;
     cout << "    -c counter mode (traditional|asic_db), default: asic_db" << endl;
+    cout << "    -p enable per consumer statistics in STATE_DB CONSUMER_STATS_TABLE" << endl;
+    cout << "    -l flush_threshold: flush the sairedis pipeline after this many tasks (default 1000)" << endl;
+    cout << "    -a flush_max_age: flush the sairedis pipeline when the oldest task is this old, in ms (default 5)" << endl;
+    cout << "    -t task_budget: max tasks processed per consumer per loop iteration (default 0, no limit)" << endl;
+    cout << "    -u time_budget: processing time per consumer per loop iteration, in us (default 0, no limit)" << endl;
 }
 
 void sighup_handler(int signo)
@@ -345,8 +359,10 @@ int main(int argc, char **argv)
     bool   enable_zmq = false;
     string responsepublisher_rec_filename = Recorder::RESPPUB_FNAME;
     int record_type = 3; // Only swss and sairedis recordings enabled by default.
+    bool record_async = false;
+    bool record_binary = false;
 
-    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:")) != -1)
+    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:pl:a:w:t:u:")) != -1)
     {
         switch (opt)
         {
@@ -387,6 +403,18 @@ int main(int argc, char **argv)
                 exit(EXIT_FAILURE);
             }
             break;
+        case 'w':
+            if (optarg == string("async") || optarg == string("async_binary"))
+            {
+                record_async = true;
+            }
+            else if (optarg != string("sync") && optarg != string("binary"))
+            {
+                usage();
+                exit(EXIT_FAILURE);
+            }
+            record_binary = (optarg == string("binary") || optarg == string("async_binary"));
+            break;
         case 'h':
             usage();
             exit(EXIT_SUCCESS);
@@ -403,6 +431,66 @@ int main(int argc, char **argv)
                 gTraditionalFlexCounter = true;
             }
             break;
+        case 'p':
+            gConsumerStatsEnabled = true;
+            SWSS_LOG_NOTICE("Enabling consumer statistics");
+            break;
+        case 'l':
+            {
+                auto threshold = atoi(optarg);
+                if (threshold > 0)
+                {
+                    gFlushThreshold = threshold;
+                    SWSS_LOG_NOTICE("Setting flush threshold as %zu", gFlushThreshold);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Invalid input for flush threshold: %d. Ignoring.", threshold);
+                }
+            }
+            break;
+        case 'a':
+            {
+                auto age = atoi(optarg);
+                if (age >= 0)
+                {
+                    gFlushMaxAgeMsecs = age;
+                    SWSS_LOG_NOTICE("Setting flush max age as %u ms", gFlushMaxAgeMsecs);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Invalid input for flush max age: %d. Ignoring.", age);
+                }
+            }
+            break;
+        case 't':
+            {
+                auto budget = atoi(optarg);
+                if (budget >= 0)
+                {
+                    gConsumerTaskBudget = budget;
+                    SWSS_LOG_NOTICE("Setting consumer task budget as %zu", gConsumerTaskBudget);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Invalid input for consumer task budget: %d. Ignoring.", budget);
+                }
+            }
+            break;
+        case 'u':
+            {
+                auto budget = atoi(optarg);
+                if (budget >= 0)
+                {
+                    gConsumerUsecBudget = budget;
+                    SWSS_LOG_NOTICE("Setting consumer time budget as %" PRIu64 " us", gConsumerUsecBudget);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Invalid input for consumer time budget: %d. Ignoring.", budget);
+                }
+            }
+            break;
         case 'f':
 
             if (optarg)
@@ -462,6 +550,8 @@ int main(int argc, char **argv)
     );
     Recorder::Instance().swss.setLocation(record_location);
     Recorder::Instance().swss.setFileName(swss_rec_filename);
+    Recorder::Instance().swss.setAsync(record_async);
+    Recorder::Instance().swss.setBinary(record_binary);
     Recorder::Instance().swss.startRec(true);
 
     Recorder::Instance().respub.setRecord(
@@ -470,6 +560,8 @@ int main(int argc, char **argv)
     );
     Recorder::Instance().respub.setLocation(record_location);
     Recorder::Instance().respub.setFileName(responsepublisher_rec_filename);
+    Recorder::Instance().respub.setAsync(record_async);
+    Recorder::Instance().respub.setBinary(record_binary);
     Recorder::Instance().respub.startRec(false);
 
     // Instantiate database connectors
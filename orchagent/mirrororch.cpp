@@ -89,7 +89,7 @@ MirrorOrch::MirrorOrch(TableConnector stateDbConnector, TableConnector confDbCon
     sai_attribute_t attr;
 
     m_portsOrch->attach(this);
-    m_neighOrch->attach(this);
+    m_neighOrch->attachBatched(this, SUBJECT_TYPE_NEIGH_CHANGE);
     m_fdbOrch->attach(this);
 
     // Retrieve the number of valid values for queue, starting at 0
@@ -503,6 +503,10 @@ task_process_status MirrorOrch::createEntry(const string& key, const vector<Fiel
     m_syncdMirrors.emplace(key, entry);
     setSessionState(key, entry);
 
+    /* Announce the new session, inactive until it gets activated */
+    MirrorSessionUpdate update = { key, false };
+    notify(SUBJECT_TYPE_MIRROR_SESSION_CHANGE, static_cast<void *>(&update));
+
     if (entry.type == MIRROR_SESSION_SPAN && !entry.dst_port.empty())
     {
         auto &session1 = m_syncdMirrors.find(key)->second;
@@ -1356,6 +1360,41 @@ void MirrorOrch::updateNextHop(const NextHopUpdate& update)
     }
 }
 
+// Neighbor changes are batched: a link flap changes many neighbors at once,
+// and each session only needs to be updated once for all of them.
+void MirrorOrch::updateBatch(SubjectType type, const vector<void *> &cntxs)
+{
+    SWSS_LOG_ENTER();
+
+    if (type != SUBJECT_TYPE_NEIGH_CHANGE)
+    {
+        Observer::updateBatch(type, cntxs);
+        return;
+    }
+
+    set<IpAddress> ips;
+    for (auto cntx : cntxs)
+    {
+        ips.insert(static_cast<NeighborUpdate *>(cntx)->entry.ip_address);
+    }
+
+    for (auto it = m_syncdMirrors.begin(); it != m_syncdMirrors.end(); it++)
+    {
+        const auto& name = it->first;
+        auto& session = it->second;
+
+        if (!ips.count(session.dstIp) && !ips.count(session.nexthopInfo.nexthop.ip_address))
+        {
+            continue;
+        }
+
+        SWSS_LOG_NOTICE("Updating mirror session %s with %zu neighbor change(s)",
+                name.c_str(), cntxs.size());
+
+        updateSession(name, session);
+    }
+}
+
 // The function is called when SUBJECT_TYPE_NEIGH_CHANGE is received.
 // This function will handle the case when the neighbor is created or removed.
 void MirrorOrch::updateNeighbor(const NeighborUpdate& update)
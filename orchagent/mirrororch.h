@@ -81,6 +81,7 @@ public:
 
     bool bake() override;
     void update(SubjectType, void *);
+    void updateBatch(SubjectType, const vector<void *> &) override;
     bool sessionExists(const string&);
     bool getSessionStatus(const string&, bool&);
     bool getSessionOid(const string&, sai_object_id_t&);
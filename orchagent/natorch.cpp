@@ -36,6 +36,7 @@ extern sai_object_id_t     gVirtualRouterId;
 extern sai_nat_api_t      *sai_nat_api;
 extern sai_hostif_api_t   *sai_hostif_api;
 extern bool               gIsNatSupported;
+extern size_t             gMaxBulkSize;
 #ifdef DEBUG_FRAMEWORK
 extern DebugDumpOrch      *gDebugDumpOrch;
 #endif
@@ -57,8 +58,11 @@ NatOrch::NatOrch(DBConnector *appDb, DBConnector *stateDb, vector<table_name_wit
          m_naptQueryTable(appDb, APP_NAPT_TABLE_NAME),
          m_twiceNatQueryTable(appDb, APP_NAT_TWICE_TABLE_NAME),
          m_twiceNaptQueryTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
-         nullIpv4Addr(0)
+         nullIpv4Addr(0),
+         m_natBulker(sai_nat_api, gMaxBulkSize)
 {
+    setExecutionGroup(ORCH_GROUP_NAT, { ORCH_GROUP_MAIN });
+
     /* Set NAT admin mode to disabled */
     admin_mode = "disabled";
 
@@ -851,7 +855,19 @@ bool NatOrch::addHwDnaptEntry(const NaptEntryKey &key)
     dnat_entry.data.key.proto = ip_protocol;
     dnat_entry.data.mask.proto = 0xff;
 
+    if (m_naptBulkMode)
+    {
+        queueNaptBulkEntry(true, key, entry, dnat_entry, attr_count, nat_entry_attr);
+        return true;
+    }
+
     status = sai_nat_api->create_nat_entry(&dnat_entry, attr_count, nat_entry_attr);
+
+    return addHwDnaptEntryPost(key, entry, status);
+}
+
+bool NatOrch::addHwDnaptEntryPost(const NaptEntryKey &key, const NaptEntryValue &entry, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
@@ -1108,7 +1124,19 @@ bool NatOrch::removeHwDnaptEntry(const NaptEntryKey &key)
     dnat_entry.data.key.proto = ip_protocol;
     dnat_entry.data.mask.proto = 0xff;
 
+    if (m_naptBulkMode)
+    {
+        queueNaptBulkEntry(false, key, entry, dnat_entry, 0, nullptr);
+        return true;
+    }
+
     status = sai_nat_api->remove_nat_entry(&dnat_entry);
+
+    return removeHwDnaptEntryPost(key, entry, status);
+}
+
+bool NatOrch::removeHwDnaptEntryPost(const NaptEntryKey &key, const NaptEntryValue &entry, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_INFO("Failed to remove %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
@@ -1208,7 +1236,19 @@ bool NatOrch::removeHwTwiceNaptEntry(const TwiceNaptEntryKey &key)
     dbl_nat_entry.data.key.proto = protoType;
     dbl_nat_entry.data.mask.proto = 0xff;
 
+    if (m_naptBulkMode)
+    {
+        queueTwiceNaptBulkEntry(false, key, value, dbl_nat_entry, 0, nullptr);
+        return true;
+    }
+
     status = sai_nat_api->remove_nat_entry(&dbl_nat_entry);
+
+    return removeHwTwiceNaptEntryPost(key, value, status);
+}
+
+bool NatOrch::removeHwTwiceNaptEntryPost(const TwiceNaptEntryKey &key, const TwiceNaptEntryValue &value, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_INFO("Failed to remove Twice NAPT entry with prototype %s, src-ip %s, src port %d, dst-ip %s, dst port %d",
@@ -1446,6 +1486,7 @@ bool NatOrch::addHwSnaptEntry(const NaptEntryKey &keyEntry)
     }
 
     NaptEntryValue entry = m_naptEntries[keyEntry];
+    entry.activeTime = time_now.tv_sec;
 
     nat_entry_attr[0].id = SAI_NAT_ENTRY_ATTR_SRC_IP;
     nat_entry_attr[0].value.u32 = entry.translated_ip.getV4Addr();
@@ -1470,7 +1511,19 @@ bool NatOrch::addHwSnaptEntry(const NaptEntryKey &keyEntry)
     snat_entry.data.key.proto = ip_protocol;
     snat_entry.data.mask.proto = 0xff;
 
+    if (m_naptBulkMode)
+    {
+        queueNaptBulkEntry(true, keyEntry, entry, snat_entry, attr_count, nat_entry_attr);
+        return true;
+    }
+
     status = sai_nat_api->create_nat_entry(&snat_entry, attr_count, nat_entry_attr);
+
+    return addHwSnaptEntryPost(keyEntry, entry, status);
+}
+
+bool NatOrch::addHwSnaptEntryPost(const NaptEntryKey &keyEntry, const NaptEntryValue &entry, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
@@ -1489,7 +1542,7 @@ bool NatOrch::addHwSnaptEntry(const NaptEntryKey &keyEntry)
                      entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
 
      m_naptEntries[keyEntry].addedToHw = true;
-     m_naptEntries[keyEntry].activeTime = time_now.tv_sec;
+     m_naptEntries[keyEntry].activeTime = entry.activeTime;
 
      updateNaptCounters(keyEntry.prototype.c_str(), keyEntry.ip_address, keyEntry.l4_port, 0, 0);
      gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
@@ -1530,6 +1583,7 @@ bool NatOrch::addHwTwiceNaptEntry(const TwiceNaptEntryKey &key)
     }
 
     TwiceNaptEntryValue value = m_twiceNaptEntries[key];
+    value.activeTime = time_now.tv_sec;
 
     nat_entry_attr[0].id = SAI_NAT_ENTRY_ATTR_SRC_IP;
     nat_entry_attr[0].value.u32 = value.translated_src_ip.getV4Addr();
@@ -1564,7 +1618,19 @@ bool NatOrch::addHwTwiceNaptEntry(const TwiceNaptEntryKey &key)
     dbl_nat_entry.data.key.proto = protoType;
     dbl_nat_entry.data.mask.proto = 0xff;
 
+    if (m_naptBulkMode)
+    {
+        queueTwiceNaptBulkEntry(true, key, value, dbl_nat_entry, attr_count, nat_entry_attr);
+        return true;
+    }
+
     status = sai_nat_api->create_nat_entry(&dbl_nat_entry, attr_count, nat_entry_attr);
+
+    return addHwTwiceNaptEntryPost(key, value, status);
+}
+
+bool NatOrch::addHwTwiceNaptEntryPost(const TwiceNaptEntryKey &key, const TwiceNaptEntryValue &value, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create %s Twice NAPT entry with src ip %s, src port %d, dst ip %s dst port %d, prototype %s and \
@@ -1589,7 +1655,7 @@ bool NatOrch::addHwTwiceNaptEntry(const TwiceNaptEntryKey &key)
 
      updateTwiceNaptCounters(key, 0, 0);
      m_twiceNaptEntries[key].addedToHw = true;
-     m_twiceNaptEntries[key].activeTime = time_now.tv_sec;
+     m_twiceNaptEntries[key].activeTime = value.activeTime;
 
      totalDnatEntries++;
      updateDnatCounters(totalDnatEntries);
@@ -1717,7 +1783,19 @@ bool NatOrch::removeHwSnaptEntry(const NaptEntryKey &keyEntry)
     snat_entry.data.key.proto = ip_protocol;
     snat_entry.data.mask.proto = 0xff;
 
+    if (m_naptBulkMode)
+    {
+        queueNaptBulkEntry(false, keyEntry, entry, snat_entry, 0, nullptr);
+        return true;
+    }
+
     status = sai_nat_api->remove_nat_entry(&snat_entry);
+
+    return removeHwSnaptEntryPost(keyEntry, entry, status);
+}
+
+bool NatOrch::removeHwSnaptEntryPost(const NaptEntryKey &keyEntry, const NaptEntryValue &entry, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_INFO("Failed to removed %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
@@ -2078,6 +2156,9 @@ bool NatOrch::addNaptEntry(const NaptEntryKey &keyEntry, const NaptEntryValue &e
                           keyEntry.prototype.c_str(), oldEntry.translated_ip.to_string().c_str(), oldEntry.translated_l4_port);
 
             removeNaptEntry(keyEntry);
+
+            /* The entry is added back below, complete its removal first */
+            flushNaptBulk();
         }
         else if (entry.entry_type != oldEntry.entry_type)
         {
@@ -2242,6 +2323,9 @@ bool NatOrch::addTwiceNaptEntry(const TwiceNaptEntryKey &key, const TwiceNaptEnt
                           key.dst_ip.to_string().c_str(), key.dst_l4_port, key.prototype.c_str());
 
             removeTwiceNaptEntry(key);
+
+            /* The entry is added back below, complete its removal first */
+            flushNaptBulk();
         }
         else if (value.entry_type != oldEntry.entry_type)
         {
@@ -2681,6 +2765,11 @@ void NatOrch::doNatTableTask(Consumer& consumer)
 
 void NatOrch::doNaptTableTask(Consumer& consumer)
 {
+    set<NaptEntryKey> queuedKeys;
+
+    /* The NAPT entries are programmed in bulk, flushed at the end of the run */
+    m_naptBulkMode = true;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -2711,6 +2800,14 @@ void NatOrch::doNaptTableTask(Consumer& consumer)
         keyEntry.l4_port = stoi(keys[2]);
         keyEntry.prototype = keys[0];
 
+        /* Complete the operation queued on this entry before updating it again */
+        if (queuedKeys.find(keyEntry) != queuedKeys.end())
+        {
+            flushNaptBulk();
+            queuedKeys.clear();
+        }
+        queuedKeys.insert(keyEntry);
+
         if (op == SET_COMMAND)
         {
             NaptEntryValue entry;
@@ -2751,6 +2848,95 @@ void NatOrch::doNaptTableTask(Consumer& consumer)
             it = consumer.m_toSync.erase(it);
         }
     }
+
+    flushNaptBulk();
+    m_naptBulkMode = false;
+}
+
+void NatOrch::queueNaptBulkEntry(bool is_add, const NaptEntryKey &key, const NaptEntryValue &entry,
+                                 const sai_nat_entry_t &nat_entry, uint32_t attr_count, const sai_attribute_t *attrs)
+{
+    m_naptBulkContexts.push_back({ is_add, key, entry, SAI_STATUS_NOT_EXECUTED });
+    NaptBulkContext &ctx = m_naptBulkContexts.back();
+
+    if (is_add)
+    {
+        m_natBulker.create_entry(&ctx.status, &nat_entry, attr_count, attrs);
+    }
+    else
+    {
+        m_natBulker.remove_entry(&ctx.status, &nat_entry);
+    }
+}
+
+void NatOrch::queueTwiceNaptBulkEntry(bool is_add, const TwiceNaptEntryKey &key, const TwiceNaptEntryValue &value,
+                                      const sai_nat_entry_t &nat_entry, uint32_t attr_count, const sai_attribute_t *attrs)
+{
+    m_twiceNaptBulkContexts.push_back({ is_add, key, value, SAI_STATUS_NOT_EXECUTED });
+    TwiceNaptBulkContext &ctx = m_twiceNaptBulkContexts.back();
+
+    if (is_add)
+    {
+        m_natBulker.create_entry(&ctx.status, &nat_entry, attr_count, attrs);
+    }
+    else
+    {
+        m_natBulker.remove_entry(&ctx.status, &nat_entry);
+    }
+}
+
+/* Program the queued NAPT and Twice NAPT entries and complete them in the order they were queued */
+void NatOrch::flushNaptBulk(void)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_naptBulkContexts.empty() && m_twiceNaptBulkContexts.empty())
+    {
+        return;
+    }
+
+    m_natBulker.flush();
+
+    for (const auto &ctx : m_naptBulkContexts)
+    {
+        if (ctx.entry.nat_type == "snat")
+        {
+            if (ctx.is_add)
+            {
+                addHwSnaptEntryPost(ctx.key, ctx.entry, ctx.status);
+            }
+            else
+            {
+                removeHwSnaptEntryPost(ctx.key, ctx.entry, ctx.status);
+            }
+        }
+        else
+        {
+            if (ctx.is_add)
+            {
+                addHwDnaptEntryPost(ctx.key, ctx.entry, ctx.status);
+            }
+            else
+            {
+                removeHwDnaptEntryPost(ctx.key, ctx.entry, ctx.status);
+            }
+        }
+    }
+
+    for (const auto &ctx : m_twiceNaptBulkContexts)
+    {
+        if (ctx.is_add)
+        {
+            addHwTwiceNaptEntryPost(ctx.key, ctx.value, ctx.status);
+        }
+        else
+        {
+            removeHwTwiceNaptEntryPost(ctx.key, ctx.value, ctx.status);
+        }
+    }
+
+    m_naptBulkContexts.clear();
+    m_twiceNaptBulkContexts.clear();
 }
 
 void NatOrch::doTwiceNatTableTask(Consumer& consumer)
@@ -2823,6 +3009,11 @@ void NatOrch::doTwiceNatTableTask(Consumer& consumer)
 
 void NatOrch::doTwiceNaptTableTask(Consumer& consumer)
 {
+    set<TwiceNaptEntryKey> queuedKeys;
+
+    /* The Twice NAPT entries are programmed in bulk, flushed at the end of the run */
+    m_naptBulkMode = true;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -2856,6 +3047,14 @@ void NatOrch::doTwiceNaptTableTask(Consumer& consumer)
         keyEntry.dst_l4_port = stoi(keys[4]);
         keyEntry.prototype   = keys[0];
 
+        /* Complete the operation queued on this entry before updating it again */
+        if (queuedKeys.find(keyEntry) != queuedKeys.end())
+        {
+            flushNaptBulk();
+            queuedKeys.clear();
+        }
+        queuedKeys.insert(keyEntry);
+
         if (op == SET_COMMAND)
         {
             TwiceNaptEntryValue entry;
@@ -2898,6 +3097,9 @@ void NatOrch::doTwiceNaptTableTask(Consumer& consumer)
             it = consumer.m_toSync.erase(it);
         }
     }
+
+    flushNaptBulk();
+    m_naptBulkMode = false;
 }
 
 void NatOrch::doNatGlobalTableTask(Consumer& consumer)
@@ -3099,9 +3301,16 @@ void NatOrch::doTask(SelectableTimer &timer)
     {
         if (((natTimerTickCntr++) % NAT_HITBIT_QUERY_MULTIPLE) == 0)
         {
+            /* Query the counters while the hit bits are read */
+            auto hitBits = readHitBits();
+            queryCounters();
+            hitBits->wait();
             queryHitBits();
         }
-        queryCounters();
+        else
+        {
+            queryCounters();
+        }
     }
     else if (timer.getFd() == m_natTimeoutTimer->getFd())
     {
@@ -3114,66 +3323,6 @@ void NatOrch::doTask(SelectableTimer &timer)
     }
 }
 
-void NatOrch::queryCounters(void)
-{
-    SWSS_LOG_ENTER();
-
-    uint32_t         queried_entries = 0;
-    struct timespec  time_now, time_end, time_spent;
-
-    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
-    {
-        return;
-    }
-
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
-    {
-        getNatCounters(natIter);
-
-        queried_entries++;
-        natIter++;
-    }
-
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
-    {
-        getNaptCounters(naptIter);
-
-        queried_entries++;
-        naptIter++;
-    }
-    TwiceNatEntry::iterator tnatIter = m_twiceNatEntries.begin();
-    while (tnatIter != m_twiceNatEntries.end())
-    {
-        getTwiceNatCounters(tnatIter);
-
-        queried_entries++;
-        tnatIter++;
-    }
-
-    TwiceNaptEntry::iterator tnaptIter = m_twiceNaptEntries.begin();
-    while (tnaptIter != m_twiceNaptEntries.end())
-    {
-        getTwiceNaptCounters(tnaptIter);
-
-        queried_entries++;
-        tnaptIter++;
-    }
-
-    if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
-    {
-        return;
-    }
-    time_spent = getTimeDiff(time_now, time_end);
-
-    if (queried_entries)
-    {
-        SWSS_LOG_DEBUG("Time spent in querying counters for %u NAT/NAPT entries = %lu secs, %lu msecs",
-                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
-    }
-}
-
 void NatOrch::addAllNatEntries(void)
 {
     SWSS_LOG_ENTER();
@@ -3203,6 +3352,9 @@ void NatOrch::addAllNatEntries(void)
         natIter++;
     }
 
+    /* NAPT and Twice NAPT entries are programmed in bulk, Twice NAT entries one by one */
+    m_naptBulkMode = true;
+
     NaptEntry::iterator naptIter = m_naptEntries.begin();
     while (naptIter != m_naptEntries.end())
     {
@@ -3265,6 +3417,9 @@ void NatOrch::addAllNatEntries(void)
         }
         twiceNaptIter++;
     }
+
+    flushNaptBulk();
+    m_naptBulkMode = false;
 }
 
 void NatOrch::clearCounters(void)
@@ -3300,6 +3455,375 @@ void NatOrch::clearCounters(void)
     }
 }
 
+/* SAI NAT entries whose hit bits and counters are polled */
+static sai_nat_entry_t getSnatHitBitEntry(const IpAddress &srcIp)
+{
+    sai_nat_entry_t snat_entry = {};
+
+    snat_entry.vr_id             = gVirtualRouterId;
+    snat_entry.switch_id         = gSwitchId;
+    snat_entry.nat_type          = SAI_NAT_TYPE_SOURCE_NAT;
+    snat_entry.data.key.src_ip   = srcIp.getV4Addr();
+    snat_entry.data.mask.src_ip  = 0xffffffff;
+
+    return snat_entry;
+}
+
+static sai_nat_entry_t getDnatHitBitEntry(const IpAddress &dstIp)
+{
+    sai_nat_entry_t dnat_entry = {};
+
+    dnat_entry.vr_id             = gVirtualRouterId;
+    dnat_entry.switch_id         = gSwitchId;
+    dnat_entry.nat_type          = SAI_NAT_TYPE_DESTINATION_NAT;
+    dnat_entry.data.key.dst_ip   = dstIp.getV4Addr();
+    dnat_entry.data.mask.dst_ip  = 0xffffffff;
+
+    return dnat_entry;
+}
+
+static sai_nat_entry_t getSnaptHitBitEntry(const IpAddress &srcIp, uint16_t srcPort, uint8_t protoType)
+{
+    sai_nat_entry_t snat_entry = getSnatHitBitEntry(srcIp);
+
+    snat_entry.data.key.l4_src_port  = srcPort;
+    snat_entry.data.mask.l4_src_port = 0xffff;
+    snat_entry.data.key.proto        = protoType;
+    snat_entry.data.mask.proto       = 0xff;
+
+    return snat_entry;
+}
+
+static sai_nat_entry_t getDnaptHitBitEntry(const IpAddress &dstIp, uint16_t dstPort, uint8_t protoType)
+{
+    sai_nat_entry_t dnat_entry = getDnatHitBitEntry(dstIp);
+
+    dnat_entry.data.key.l4_dst_port  = dstPort;
+    dnat_entry.data.mask.l4_dst_port = 0xffff;
+    dnat_entry.data.key.proto        = protoType;
+    dnat_entry.data.mask.proto       = 0xff;
+
+    return dnat_entry;
+}
+
+static sai_nat_entry_t getTwiceNatHitBitEntry(const TwiceNatEntryKey &key)
+{
+    sai_nat_entry_t dbl_nat_entry = {};
+
+    dbl_nat_entry.vr_id = gVirtualRouterId;
+    dbl_nat_entry.switch_id = gSwitchId;
+    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
+    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
+    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
+    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
+    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
+
+    return dbl_nat_entry;
+}
+
+static sai_nat_entry_t getTwiceNaptHitBitEntry(const TwiceNaptEntryKey &key)
+{
+    TwiceNatEntryKey natKey;
+    natKey.src_ip = key.src_ip;
+    natKey.dst_ip = key.dst_ip;
+
+    sai_nat_entry_t dbl_nat_entry = getTwiceNatHitBitEntry(natKey);
+
+    dbl_nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
+    dbl_nat_entry.data.mask.l4_src_port = 0xffff;
+    dbl_nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
+    dbl_nat_entry.data.mask.l4_dst_port = 0xffff;
+    dbl_nat_entry.data.key.proto = (uint8_t)((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+    dbl_nat_entry.data.mask.proto = 0xff;
+
+    return dbl_nat_entry;
+}
+
+void NatOrch::addHitBitQuery(const sai_nat_entry_t &nat_entry)
+{
+    auto rc = m_hitBitQueries.emplace(nat_entry, HitBitQuery());
+    if (!rc.second)
+    {
+        return;
+    }
+
+    HitBitQuery &query = rc.first->second;
+
+    query.attrs[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
+    query.attrs[0].value.booldata = 0;
+    query.attrs[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
+    query.attrs[1].value.booldata = 1;
+
+    m_natBulker.get_entry_attribute(&query.status, &nat_entry, 2, query.attrs);
+}
+
+sai_status_t NatOrch::getHitBit(const sai_nat_entry_t &nat_entry, bool &hit)
+{
+    auto it = m_hitBitQueries.find(nat_entry);
+    if (it == m_hitBitQueries.end())
+    {
+        return SAI_STATUS_NOT_EXECUTED;
+    }
+
+    hit = it->second.attrs[0].value.booldata;
+    return it->second.status;
+}
+
+void NatOrch::addCounterQuery(EntityBulker<sai_nat_api_t> &bulker, const sai_nat_entry_t &nat_entry)
+{
+    auto rc = m_counterQueries.emplace(nat_entry, CounterQuery());
+    if (!rc.second)
+    {
+        return;
+    }
+
+    CounterQuery &query = rc.first->second;
+
+    query.attrs[0].id = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
+    query.attrs[1].id = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
+
+    bulker.get_entry_attribute(&query.status, &nat_entry, 2, query.attrs);
+}
+
+/* Counters of the entry read by queryCounters(), read from the hardware
+ * when the entry was not part of the query */
+sai_status_t NatOrch::getCounters(const sai_nat_entry_t &nat_entry, uint32_t attr_count, sai_attribute_t *attrs)
+{
+    auto it = m_counterQueries.find(nat_entry);
+    if ((it == m_counterQueries.end()) or (attr_count > 2))
+    {
+        return sai_nat_api->get_nat_entry_attribute(&nat_entry, attr_count, attrs);
+    }
+
+    for (uint32_t i = 0; i < attr_count; i++)
+    {
+        attrs[i] = it->second.attrs[i];
+    }
+    return it->second.status;
+}
+
+/* Up to 'count' entries of the table following the cursor entry, wrapping
+ * around at the end of the table. The cursor is moved to the last one. */
+template <typename EntryTable>
+static vector<typename EntryTable::iterator> getCountersSlice(EntryTable &entries, typename EntryTable::key_type &cursor, size_t count)
+{
+    vector<typename EntryTable::iterator> slice;
+
+    count = min(count, entries.size());
+    auto iter = entries.upper_bound(cursor);
+    while (slice.size() < count)
+    {
+        if (iter == entries.end())
+        {
+            iter = entries.begin();
+        }
+        slice.push_back(iter++);
+    }
+
+    if (!slice.empty())
+    {
+        cursor = slice.back()->first;
+    }
+    return slice;
+}
+
+/* Read the counters of a slice of each table in bulk, the next query period
+ * resumes where this one stopped, so that large tables are read over a few
+ * periods instead of stalling a single one. */
+void NatOrch::queryCounters(void)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t         queried_entries = 0;
+    struct timespec  time_now, time_end, time_spent;
+
+    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
+    {
+        return;
+    }
+
+    auto natSlice       = getCountersSlice(m_natEntries, m_natCntrsCursor, m_cntrsQuerySlice);
+    auto naptSlice      = getCountersSlice(m_naptEntries, m_naptCntrsCursor, m_cntrsQuerySlice);
+    auto twiceNatSlice  = getCountersSlice(m_twiceNatEntries, m_twiceNatCntrsCursor, m_cntrsQuerySlice);
+    auto twiceNaptSlice = getCountersSlice(m_twiceNaptEntries, m_twiceNaptCntrsCursor, m_cntrsQuerySlice);
+
+    /* m_natBulker may be reading the hit bits meanwhile */
+    EntityBulker<sai_nat_api_t> bulker(sai_nat_api, gMaxBulkSize);
+
+    m_counterQueries.clear();
+
+    for (const auto &natIter : natSlice)
+    {
+        if (natIter->second.addedToHw == true)
+        {
+            addCounterQuery(bulker, (natIter->second.nat_type == "dnat") ? getDnatHitBitEntry(natIter->first) :
+                                                                           getSnatHitBitEntry(natIter->first));
+        }
+    }
+
+    for (const auto &naptIter : naptSlice)
+    {
+        const NaptEntryKey &key = naptIter->first;
+        uint8_t protoType = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+
+        if (naptIter->second.addedToHw == true)
+        {
+            addCounterQuery(bulker, (naptIter->second.nat_type == "dnat") ?
+                                    getDnaptHitBitEntry(key.ip_address, (uint16_t)(key.l4_port), protoType) :
+                                    getSnaptHitBitEntry(key.ip_address, (uint16_t)(key.l4_port), protoType));
+        }
+    }
+
+    for (const auto &tnatIter : twiceNatSlice)
+    {
+        if (tnatIter->second.addedToHw == true)
+        {
+            addCounterQuery(bulker, getTwiceNatHitBitEntry(tnatIter->first));
+        }
+    }
+
+    for (const auto &tnaptIter : twiceNaptSlice)
+    {
+        if (tnaptIter->second.addedToHw == true)
+        {
+            addCounterQuery(bulker, getTwiceNaptHitBitEntry(tnaptIter->first));
+        }
+    }
+
+    bulker.flush();
+
+    for (const auto &natIter : natSlice)
+    {
+        getNatCounters(natIter);
+        queried_entries++;
+    }
+
+    for (const auto &naptIter : naptSlice)
+    {
+        getNaptCounters(naptIter);
+        queried_entries++;
+    }
+
+    for (const auto &tnatIter : twiceNatSlice)
+    {
+        getTwiceNatCounters(tnatIter);
+        queried_entries++;
+    }
+
+    for (const auto &tnaptIter : twiceNaptSlice)
+    {
+        getTwiceNaptCounters(tnaptIter);
+        queried_entries++;
+    }
+
+    m_counterQueries.clear();
+
+    if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
+    {
+        return;
+    }
+    time_spent = getTimeDiff(time_now, time_end);
+
+    if (queried_entries)
+    {
+        SWSS_LOG_DEBUG("Time spent in querying counters for %u NAT/NAPT entries = %lu secs, %lu msecs",
+                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
+    }
+}
+
+/* Read the hit bits of the dynamic entries in bulk, in two round trips: the
+ * SNAT and Twice NAT entries first, then the reverse DNAT direction of the
+ * SNAT entries which were not hit. Hit bits are cleared on read, so the
+ * reverse direction is only read when the forward one was not hit.
+ * The first round trip runs in the background, its completion queues the
+ * second one which is flushed by queryHitBits(). */
+std::shared_ptr<BulkCompletion> NatOrch::readHitBits(void)
+{
+    SWSS_LOG_ENTER();
+
+    m_hitBitQueries.clear();
+
+    for (const auto &nat : m_natEntries)
+    {
+        if ((nat.second.nat_type != "dnat") and (nat.second.addedToHw == true) and
+            (nat.second.entry_type != "static"))
+        {
+            addHitBitQuery(getSnatHitBitEntry(nat.first));
+        }
+    }
+
+    for (const auto &napt : m_naptEntries)
+    {
+        if ((napt.second.nat_type != "dnat") and (napt.second.addedToHw == true) and
+            (napt.second.entry_type != "static"))
+        {
+            uint8_t protoType = ((napt.first.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+            addHitBitQuery(getSnaptHitBitEntry(napt.first.ip_address, (uint16_t)(napt.first.l4_port), protoType));
+        }
+    }
+
+    for (const auto &twiceNat : m_twiceNatEntries)
+    {
+        if ((twiceNat.second.addedToHw == true) and (twiceNat.second.entry_type != "static"))
+        {
+            addHitBitQuery(getTwiceNatHitBitEntry(twiceNat.first));
+        }
+    }
+
+    for (const auto &twiceNapt : m_twiceNaptEntries)
+    {
+        if ((twiceNapt.second.addedToHw == true) and (twiceNapt.second.entry_type != "static"))
+        {
+            addHitBitQuery(getTwiceNaptHitBitEntry(twiceNapt.first));
+        }
+    }
+
+    auto completion = m_natBulker.flush_async();
+    completion->add_callback([this]() { addReverseHitBitQueries(); });
+    return completion;
+}
+
+void NatOrch::addReverseHitBitQueries(void)
+{
+    SWSS_LOG_ENTER();
+
+    bool hit;
+
+    for (const auto &nat : m_natEntries)
+    {
+        if ((getHitBit(getSnatHitBitEntry(nat.first), hit) != SAI_STATUS_SUCCESS) or hit)
+        {
+            continue;
+        }
+
+        auto dnatIter = m_natEntries.find(nat.second.translated_ip);
+        if ((dnatIter != m_natEntries.end()) and (dnatIter->second.addedToHw == true))
+        {
+            addHitBitQuery(getDnatHitBitEntry(nat.second.translated_ip));
+        }
+    }
+
+    for (const auto &napt : m_naptEntries)
+    {
+        uint8_t protoType = ((napt.first.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+        if ((getHitBit(getSnaptHitBitEntry(napt.first.ip_address, (uint16_t)(napt.first.l4_port), protoType), hit) != SAI_STATUS_SUCCESS) or hit)
+        {
+            continue;
+        }
+
+        NaptEntryKey dnaptKey;
+        dnaptKey.ip_address = napt.second.translated_ip;
+        dnaptKey.l4_port    = napt.second.translated_l4_port;
+        dnaptKey.prototype  = napt.first.prototype;
+
+        auto dnaptIter = m_naptEntries.find(dnaptKey);
+        if ((dnaptIter != m_naptEntries.end()) and (dnaptIter->second.addedToHw == true))
+        {
+            addHitBitQuery(getDnaptHitBitEntry(napt.second.translated_ip, (uint16_t)(napt.second.translated_l4_port), protoType));
+        }
+    }
+}
+
 void NatOrch::queryHitBits(void)
 {
     SWSS_LOG_ENTER();
@@ -3307,6 +3831,9 @@ void NatOrch::queryHitBits(void)
     uint32_t         queried_entries = 0;
     struct timespec  time_now, time_end, time_spent;
 
+    /* Reverse direction of the entries read by readHitBits() */
+    m_natBulker.flush();
+
     if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
     {
         return;
@@ -3434,9 +3961,11 @@ void NatOrch::queryHitBits(void)
 
     if (queried_entries)
     {
-        SWSS_LOG_DEBUG("Time spent in querying hardware hit-bits for %u NAT/NAPT entries = %lu secs, %lu msecs",
-                       queried_entries, time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
+        SWSS_LOG_DEBUG("Time spent in querying hardware hit-bits for %u NAT/NAPT entries (%zu SAI entries) = %lu secs, %lu msecs",
+                       queried_entries, m_hitBitQueries.size(), time_spent.tv_sec, (time_spent.tv_nsec / 1000000UL));
     }
+
+    m_hitBitQueries.clear();
 }
 
 void NatOrch::updateAllConntrackEntries(void)
@@ -3541,7 +4070,7 @@ bool NatOrch::getNatCounters(const NatEntry::iterator &iter)
         nat_entry.data.mask.src_ip = 0xffffffff;
     }
 
-    status = sai_nat_api->get_nat_entry_attribute(&nat_entry, attr_count, nat_entry_attr);
+    status = getCounters(nat_entry, attr_count, nat_entry_attr);
     if (entry.nat_type == "snat")
     {
         if (status != SAI_STATUS_SUCCESS)
@@ -3605,7 +4134,7 @@ bool NatOrch::getTwiceNatCounters(const TwiceNatEntry::iterator &iter)
     dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
     dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
 
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
+    status = getCounters(dbl_nat_entry, attr_count, nat_entry_attr);
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to get Counters for Twice NAT entry [src-ip %s, dst-ip %s], bytes = %" PRIu64 ", pkts = %" PRIu64 "",
@@ -3748,7 +4277,7 @@ bool NatOrch::getNaptCounters(const NaptEntry::iterator &iter)
     nat_entry.data.key.proto        = protoType;
     nat_entry.data.mask.proto       = 0xff;
 
-    status = sai_nat_api->get_nat_entry_attribute(&nat_entry, attr_count, nat_entry_attr);
+    status = getCounters(nat_entry, attr_count, nat_entry_attr);
 
     if (entry.nat_type == "snat")
     { 
@@ -3823,7 +4352,7 @@ bool NatOrch::getTwiceNaptCounters(const TwiceNaptEntry::iterator &iter)
     dbl_nat_entry.data.key.proto = protoType;
     dbl_nat_entry.data.mask.proto = 0xff;
 
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
+    status = getCounters(dbl_nat_entry, attr_count, nat_entry_attr);
 
     if (status != SAI_STATUS_SUCCESS)
     {
@@ -4137,12 +4666,9 @@ bool NatOrch::checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now
 {
     const IpAddress   &ipAddr = iter->first;
     NatEntryValue     &entry  = iter->second;
-    uint32_t          attr_count;
     IpAddress         srcIp;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   snat_entry = {};
-    sai_nat_entry_t   dnat_entry;
     sai_status_t      status;
+    bool              hit = false;
 
     if (entry.nat_type == "dnat")
     {
@@ -4162,27 +4688,15 @@ bool NatOrch::checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now
         return 1;
     }
 
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    snat_entry.vr_id                 = gVirtualRouterId;
-    snat_entry.switch_id             = gSwitchId;
-    snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
+    /* Hit bits are read in bulk by readHitBits() */
     srcIp     = ipAddr;
-    snat_entry.data.key.src_ip   = srcIp.getV4Addr();
-    snat_entry.data.mask.src_ip  = 0xffffffff;
 
-    status = sai_nat_api->get_nat_entry_attribute(&snat_entry, attr_count, nat_entry_attr);
+    status = getHitBit(getSnatHitBitEntry(srcIp), hit);
     if (status == SAI_STATUS_SUCCESS)
     {
-        SWSS_LOG_DEBUG("SNAT HIT BIT for src-ip %s = %d", srcIp.to_string().c_str(),
-                      nat_entry_attr[0].value.booldata);
+        SWSS_LOG_DEBUG("SNAT HIT BIT for src-ip %s = %d", srcIp.to_string().c_str(), hit);
 
-        if (nat_entry_attr[0].value.booldata)
+        if (hit)
         {
             entry.ageOutTime = now + timeout;
             return 1;
@@ -4200,20 +4714,11 @@ bool NatOrch::checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now
             }
 
             /* If SNAT HitBit is not set, check for the HitBit in the reverse direction */
-            memset(&dnat_entry, 0, sizeof(dnat_entry));
-
-            dnat_entry.vr_id             = gVirtualRouterId;
-            dnat_entry.switch_id         = gSwitchId;
-            dnat_entry.nat_type          = SAI_NAT_TYPE_DESTINATION_NAT;
-            dnat_entry.data.key.dst_ip   = entry.translated_ip.getV4Addr();
-            dnat_entry.data.mask.dst_ip  = 0xffffffff;
-
-            status = sai_nat_api->get_nat_entry_attribute(&dnat_entry, attr_count, nat_entry_attr);
+            status = getHitBit(getDnatHitBitEntry(entry.translated_ip), hit);
             if (status == SAI_STATUS_SUCCESS)
             {
-                SWSS_LOG_DEBUG("DNAT HIT BIT for dst-ip %s = %d", entry.translated_ip.to_string().c_str(),
-                                nat_entry_attr[0].value.booldata);
-                if (nat_entry_attr[0].value.booldata)
+                SWSS_LOG_DEBUG("DNAT HIT BIT for dst-ip %s = %d", entry.translated_ip.to_string().c_str(), hit);
+                if (hit)
                 {
                     entry.ageOutTime = now + timeout;
                     return 1;
@@ -4229,13 +4734,10 @@ bool NatOrch::checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t n
     const NaptEntryKey &naptKey    = iter->first;
     NaptEntryValue     &entry      = iter->second;
     int                protoType   = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
     IpAddress          srcIp;
     uint16_t           srcPort;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    snat_entry = {};
-    sai_nat_entry_t    dnat_entry;
     sai_status_t       status;
+    bool               hit = false;
 
     if (entry.nat_type == "dnat")
     {
@@ -4256,33 +4758,16 @@ bool NatOrch::checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t n
         return 1;
     }
 
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    snat_entry.vr_id                 = gVirtualRouterId;
-    snat_entry.switch_id             = gSwitchId;
-    snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
-
+    /* Hit bits are read in bulk by readHitBits() */
     srcIp     = naptKey.ip_address;
     srcPort   = (uint16_t)(naptKey.l4_port);
-    snat_entry.data.key.src_ip       = srcIp.getV4Addr();
-    snat_entry.data.key.l4_src_port  = srcPort;
-
-    snat_entry.data.mask.src_ip      = 0xffffffff;
-    snat_entry.data.mask.l4_src_port = 0xffff;
-    snat_entry.data.key.proto        = (uint8_t)protoType;
-    snat_entry.data.mask.proto       = 0xff;
 
-    status = sai_nat_api->get_nat_entry_attribute(&snat_entry, attr_count, nat_entry_attr);
+    status = getHitBit(getSnaptHitBitEntry(srcIp, srcPort, (uint8_t)protoType), hit);
     if (status == SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_DEBUG("SNAPT HIT BIT for proto %s, src-ip %s, src-port %d = %d", naptKey.prototype.c_str(),
-                      srcIp.to_string().c_str(), srcPort, nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
+                      srcIp.to_string().c_str(), srcPort, hit);
+        if (hit)
         {
             entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
             return 1;
@@ -4306,26 +4791,12 @@ bool NatOrch::checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t n
 
 
             /* If SNAPT HitBit is not set, check for the HitBit in the reverse direction */
-            memset(&dnat_entry, 0, sizeof(dnat_entry));
-
-            dnat_entry.vr_id                 = gVirtualRouterId;
-            dnat_entry.switch_id             = gSwitchId;
-            dnat_entry.nat_type              = SAI_NAT_TYPE_DESTINATION_NAT;
-
-            dnat_entry.data.key.dst_ip       = entry.translated_ip.getV4Addr();
-            dnat_entry.data.key.l4_dst_port  = (uint16_t)(entry.translated_l4_port);
-
-            dnat_entry.data.mask.dst_ip      = 0xffffffff;
-            dnat_entry.data.mask.l4_dst_port = 0xffff;
-            dnat_entry.data.key.proto        = (uint8_t)protoType;
-            dnat_entry.data.mask.proto       = 0xff;
-
-            status = sai_nat_api->get_nat_entry_attribute(&dnat_entry, attr_count, nat_entry_attr);
+            status = getHitBit(getDnaptHitBitEntry(entry.translated_ip, (uint16_t)(entry.translated_l4_port), (uint8_t)protoType), hit);
             if (status == SAI_STATUS_SUCCESS)
             {
                 SWSS_LOG_DEBUG("DNAPT HIT BIT for proto %s, dst-ip %s, dst-port %d = %d", naptKey.prototype.c_str(),
-                              entry.translated_ip.to_string().c_str(), entry.translated_l4_port, nat_entry_attr[0].value.booldata);
-                if (nat_entry_attr[0].value.booldata)
+                              entry.translated_ip.to_string().c_str(), entry.translated_l4_port, hit);
+                if (hit)
                 {
                     entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
                     return 1;
@@ -4340,10 +4811,8 @@ bool NatOrch::checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter,
 {
     const TwiceNatEntryKey &key    = iter->first;
     TwiceNatEntryValue     &entry  = iter->second;
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
     sai_status_t       status;
+    bool               hit = false;
 
     if (entry.entry_type == "static")
     {
@@ -4358,27 +4827,13 @@ bool NatOrch::checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter,
         return 0;
     }
 
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
+    /* Hit bits are read in bulk by readHitBits() */
+    status = getHitBit(getTwiceNatHitBitEntry(key), hit);
     if (status == SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_DEBUG("Twice NAT HIT BIT for src-ip %s, dst-ip %s = %d",
-                       key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str(), nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
+                       key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str(), hit);
+        if (hit)
         {
             entry.ageOutTime = now + timeout;
             return 1;
@@ -4392,10 +4847,8 @@ bool NatOrch::checkIfTwiceNaptEntryIsActive(const TwiceNaptEntry::iterator &iter
     const TwiceNaptEntryKey &key   = iter->first;
     TwiceNaptEntryValue     &entry = iter->second;
     uint8_t            protoType   = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
     sai_status_t       status;
+    bool               hit = false;
 
     if (entry.addedToHw == false)
     {
@@ -4410,34 +4863,14 @@ bool NatOrch::checkIfTwiceNaptEntryIsActive(const TwiceNaptEntry::iterator &iter
         return 1;
     }
 
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
-    dbl_nat_entry.data.mask.l4_src_port = 0xffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
-    dbl_nat_entry.data.mask.l4_dst_port = 0xffff;
-    dbl_nat_entry.data.key.proto = protoType;
-    dbl_nat_entry.data.mask.proto = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
+    /* Hit bits are read in bulk by readHitBits() */
+    status = getHitBit(getTwiceNaptHitBitEntry(key), hit);
     if (status == SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_DEBUG("Twice NAPT HIT BIT for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d] = %d",
                         key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(), key.dst_l4_port,
-                        nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
+                        hit);
+        if (hit)
         {
             entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
             return 1;
@@ -29,6 +29,10 @@
 #include "routeorch.h"
 #include "nexthopgroupkey.h"
 #include "notificationproducer.h"
+#include "bulker.h"
+
+#include <deque>
+
 #ifdef DEBUG_FRAMEWORK
 #include "debugdumporch.h"
 #endif
@@ -37,6 +41,7 @@
 #define NAT_HITBIT_N_CNTRS_QUERY_PERIOD   5        // 5 secs
 #define NAT_CONNTRACK_TIMEOUT_PERIOD      86400    // 1 day
 #define NAT_HITBIT_QUERY_MULTIPLE         6        // Hit bits are queried every 30 secs
+#define NAT_CNTRS_QUERY_SLICE             4096     // Entries of each table whose counters are read per query period
 
 struct NatEntryValue
 {
@@ -219,6 +224,55 @@ private:
     IpAddress               nullIpv4Addr;
     DnatPoolEntry           m_dnatPoolEntries;
 
+    /* Hit bit reads of a readHitBits()/queryHitBits() run, by SAI NAT entry */
+    struct HitBitQuery
+    {
+        sai_attribute_t attrs[2];
+        sai_status_t    status;
+    };
+
+    /* Counter reads of a queryCounters() run, by SAI NAT entry */
+    struct CounterQuery
+    {
+        sai_attribute_t attrs[2];
+        sai_status_t    status;
+    };
+
+    /* NAPT entries programmed in bulk by doNaptTableTask(), completed by flushNaptBulk() */
+    struct NaptBulkContext
+    {
+        bool            is_add;
+        NaptEntryKey    key;
+        NaptEntryValue  entry;
+        sai_status_t    status;
+    };
+
+    /* Twice NAPT entries programmed in bulk by doTwiceNaptTableTask(), completed by flushNaptBulk() */
+    struct TwiceNaptBulkContext
+    {
+        bool                is_add;
+        TwiceNaptEntryKey   key;
+        TwiceNaptEntryValue value;
+        sai_status_t        status;
+    };
+
+    EntityBulker<sai_nat_api_t>                         m_natBulker;
+    std::unordered_map<sai_nat_entry_t, HitBitQuery>    m_hitBitQueries;
+    std::unordered_map<sai_nat_entry_t, CounterQuery>   m_counterQueries;
+
+    /* Last entry of each table whose counters were read, the next query period resumes after it */
+    IpAddress                                           m_natCntrsCursor {};
+    NaptEntryKey                                        m_naptCntrsCursor {};
+    TwiceNatEntryKey                                    m_twiceNatCntrsCursor {};
+    TwiceNaptEntryKey                                   m_twiceNaptCntrsCursor {};
+
+    /* Entries of each table whose counters are read per query period */
+    size_t                                              m_cntrsQuerySlice = NAT_CNTRS_QUERY_SLICE;
+
+    bool                                                m_naptBulkMode = false;
+    std::deque<NaptBulkContext>                         m_naptBulkContexts;
+    std::deque<TwiceNaptBulkContext>                    m_twiceNaptBulkContexts;
+
     std::shared_ptr<NotificationProducer> setTimeoutNotifier;
 
     /* DNAT/DNAPT entry is cached, to delete and re-add it whenever the direct NextHop (connected neighbor)
@@ -288,7 +342,24 @@ private:
     bool removeHwDnaptEntry(const NaptEntryKey &key);
     bool addHwDnatPoolEntry(const IpAddress &dstIp);
     bool removeHwDnatPoolEntry(const IpAddress &dstIp);
-
+    bool addHwSnaptEntryPost(const NaptEntryKey &key, const NaptEntryValue &entry, sai_status_t status);
+    bool removeHwSnaptEntryPost(const NaptEntryKey &key, const NaptEntryValue &entry, sai_status_t status);
+    bool addHwDnaptEntryPost(const NaptEntryKey &key, const NaptEntryValue &entry, sai_status_t status);
+    bool removeHwDnaptEntryPost(const NaptEntryKey &key, const NaptEntryValue &entry, sai_status_t status);
+    bool addHwTwiceNaptEntryPost(const TwiceNaptEntryKey &key, const TwiceNaptEntryValue &value, sai_status_t status);
+    bool removeHwTwiceNaptEntryPost(const TwiceNaptEntryKey &key, const TwiceNaptEntryValue &value, sai_status_t status);
+    void queueNaptBulkEntry(bool is_add, const NaptEntryKey &key, const NaptEntryValue &entry,
+                            const sai_nat_entry_t &nat_entry, uint32_t attr_count, const sai_attribute_t *attrs);
+    void queueTwiceNaptBulkEntry(bool is_add, const TwiceNaptEntryKey &key, const TwiceNaptEntryValue &value,
+                                 const sai_nat_entry_t &nat_entry, uint32_t attr_count, const sai_attribute_t *attrs);
+    void flushNaptBulk(void);
+
+    void addHitBitQuery(const sai_nat_entry_t &nat_entry);
+    sai_status_t getHitBit(const sai_nat_entry_t &nat_entry, bool &hit);
+    void addCounterQuery(EntityBulker<sai_nat_api_t> &bulker, const sai_nat_entry_t &nat_entry);
+    sai_status_t getCounters(const sai_nat_entry_t &nat_entry, uint32_t attr_count, sai_attribute_t *attrs);
+    std::shared_ptr<BulkCompletion> readHitBits(void);
+    void addReverseHitBitQueries(void);
     bool checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now);
     bool checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t now);
     bool checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter, time_t now);
@@ -196,11 +196,77 @@ bool NeighOrch::isNeighborResolved(const NextHopKey &nexthop)
     return hasNextHop(base_nexthop);
 }
 
+NextHopKey NeighOrch::getSyncdNextHopKey(const NextHopKey &nh)
+{
+    NextHopKey nexthop(nh);
+    if (m_intfsOrch->isRemoteSystemPortIntf(nh.alias))
+    {
+        //For remote system ports kernel nexthops are always on inband. Change the key
+        Port inbp;
+        gPortsOrch->getInbandPort(inbp);
+        assert(inbp.m_alias.length());
+
+        nexthop.alias = inbp.m_alias;
+    }
+
+    return nexthop;
+}
+
 bool NeighOrch::addNextHop(const NextHopKey &nh)
 {
     SWSS_LOG_ENTER();
 
-    Port p;
+    NextHopKey nexthop = getSyncdNextHopKey(nh);
+    vector<sai_attribute_t> next_hop_attrs;
+    vector<Label> label_stack;
+
+    if (!getNextHopAttributes(nh, nexthop, next_hop_attrs, label_stack))
+    {
+        return false;
+    }
+
+    sai_object_id_t next_hop_id;
+    sai_status_t status = sai_next_hop_api->create_next_hop(&next_hop_id, gSwitchId, (uint32_t)next_hop_attrs.size(), next_hop_attrs.data());
+
+    return addNextHopPost(nh, next_hop_id, status);
+}
+
+/* Queue the creation of the next hop of a neighbor, addNextHopPost() completes it after the flush */
+bool NeighOrch::addNextHop(const NextHopKey &nh, NeighborContext &ctx, ObjectBulker<sai_next_hop_api_t> &nextHopBulker)
+{
+    SWSS_LOG_ENTER();
+
+    NextHopKey nexthop = getSyncdNextHopKey(nh);
+    vector<sai_attribute_t> next_hop_attrs;
+    vector<Label> label_stack;
+
+    if (!getNextHopAttributes(nh, nexthop, next_hop_attrs, label_stack))
+    {
+        return false;
+    }
+
+    /*
+     * The bulker copies the attributes but not the label stack they point
+     * to, so an MPLS next hop is created right away, still completed by
+     * addNextHopPost() after the flush.
+     */
+    if (!label_stack.empty())
+    {
+        ctx.next_hop_status = sai_next_hop_api->create_next_hop(&ctx.next_hop_id, gSwitchId,
+                                                                (uint32_t)next_hop_attrs.size(), next_hop_attrs.data());
+    }
+    else
+    {
+        nextHopBulker.create_entry(&ctx.next_hop_id, &ctx.next_hop_status, (uint32_t)next_hop_attrs.size(), next_hop_attrs.data());
+    }
+    ctx.next_hop_bulk_op = true;
+
+    return true;
+}
+
+/* Port of the next hop, the parent port for a sub interface */
+bool NeighOrch::getNextHopPort(const NextHopKey &nh, Port &p)
+{
     if (!gPortsOrch->getPort(nh.alias, p))
     {
         SWSS_LOG_ERROR("Neighbor %s seen on port %s which doesn't exist",
@@ -217,23 +283,21 @@ bool NeighOrch::addNextHop(const NextHopKey &nh)
         }
     }
 
-    NextHopKey nexthop(nh);
-    if (m_intfsOrch->isRemoteSystemPortIntf(nh.alias))
-    {
-        //For remote system ports kernel nexthops are always on inband. Change the key
-        Port inbp;
-        gPortsOrch->getInbandPort(inbp);
-        assert(inbp.m_alias.length());
+    return true;
+}
 
-        nexthop.alias = inbp.m_alias;
+bool NeighOrch::getNextHopAttributes(const NextHopKey &nh, const NextHopKey &nexthop,
+                                     vector<sai_attribute_t> &next_hop_attrs, vector<Label> &label_stack)
+{
+    Port p;
+    if (!getNextHopPort(nh, p))
+    {
+        return false;
     }
 
     assert(!hasNextHop(nexthop));
     sai_object_id_t rif_id = m_intfsOrch->getRouterIntfsId(nh.alias);
 
-    vector<sai_attribute_t> next_hop_attrs;
-
-    vector<Label> label_stack;
     sai_attribute_t next_hop_attr;
     if (nexthop.isMplsNextHop())
     {
@@ -266,8 +330,13 @@ bool NeighOrch::addNextHop(const NextHopKey &nh)
     next_hop_attr.value.oid = rif_id;
     next_hop_attrs.push_back(next_hop_attr);
 
-    sai_object_id_t next_hop_id;
-    sai_status_t status = sai_next_hop_api->create_next_hop(&next_hop_id, gSwitchId, (uint32_t)next_hop_attrs.size(), next_hop_attrs.data());
+    return true;
+}
+
+bool NeighOrch::addNextHopPost(const NextHopKey &nh, sai_object_id_t next_hop_id, sai_status_t status)
+{
+    NextHopKey nexthop = getSyncdNextHopKey(nh);
+
     if (status != SAI_STATUS_SUCCESS)
     {
         if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
@@ -324,7 +393,8 @@ bool NeighOrch::addNextHop(const NextHopKey &nh)
     // flag should be set on it.
     // This scenario may happen under race condition where buffered neighbor event
     // is processed after incoming port is down.
-    if (p.m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
+    Port p;
+    if (getNextHopPort(nh, p) && p.m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
     {
         if (setNextHopFlag(nexthop, NHFLAGS_IFDOWN) == false)
         {
@@ -1101,7 +1171,7 @@ bool NeighOrch::addNeighbor(NeighborContext& ctx)
     m_syncdNeighbors[neighborEntry] = { macAddress, hw_config };
 
     NeighborUpdate update = { neighborEntry, macAddress, true };
-    notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
+    notify(SUBJECT_TYPE_NEIGH_CHANGE, update, neighborEntry.to_string());
 
     if(gMySwitchType == "voq")
     {
@@ -1156,8 +1226,16 @@ bool NeighOrch::removeNeighbor(NeighborContext& ctx, bool disable)
         neighbor_entry.switch_id = gSwitchId;
         copy(neighbor_entry.ip_address, ip_address);
 
-        sai_object_id_t next_hop_id = m_syncdNextHops[nexthop].next_hop_id;
-        status = sai_next_hop_api->remove_next_hop(next_hop_id);
+        if (ctx.next_hop_bulk_op)
+        {
+            /* Removed in bulk by disableNeighbors() */
+            status = ctx.next_hop_status;
+        }
+        else
+        {
+            sai_object_id_t next_hop_id = m_syncdNextHops[nexthop].next_hop_id;
+            status = sai_next_hop_api->remove_next_hop(next_hop_id);
+        }
         if (status != SAI_STATUS_SUCCESS)
         {
             /* When next hop is not found, we continue to remove neighbor entry. */
@@ -1248,7 +1326,7 @@ bool NeighOrch::removeNeighbor(NeighborContext& ctx, bool disable)
     m_syncdNeighbors.erase(neighborEntry);
 
     NeighborUpdate update = { neighborEntry, MacAddress(), false };
-    notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
+    notify(SUBJECT_TYPE_NEIGH_CHANGE, update, neighborEntry.to_string());
 
     if(gMySwitchType == "voq")
     {
@@ -1259,8 +1337,32 @@ bool NeighOrch::removeNeighbor(NeighborContext& ctx, bool disable)
     return true;
 }
 
+/* Queue the removal of the next hop of a neighbor to disable, removeNeighbor() completes it after the flush */
+void NeighOrch::removeNextHopBulk(NeighborContext& ctx, ObjectBulker<sai_next_hop_api_t>& nextHopBulker)
+{
+    SWSS_LOG_ENTER();
+
+    const NeighborEntry& neighborEntry = ctx.neighborEntry;
+    if (!ctx.bulk_op || !isHwConfigured(neighborEntry))
+    {
+        return;
+    }
+
+    /* Left to removeNeighbor(), which doesn't remove a referenced next hop */
+    NextHopKey nexthop = getSyncdNextHopKey(NextHopKey(neighborEntry.ip_address, neighborEntry.alias));
+    auto nhop = m_syncdNextHops.find(nexthop);
+    if (nhop == m_syncdNextHops.end() || nhop->second.ref_count > 0 ||
+        nhop->second.next_hop_id == SAI_NULL_OBJECT_ID)
+    {
+        return;
+    }
+
+    nextHopBulker.remove_entry(&ctx.next_hop_status, nhop->second.next_hop_id);
+    ctx.next_hop_bulk_op = true;
+}
+
 /* Process bulk ctx entry and enable the neigbor */
-bool NeighOrch::processBulkEnableNeighbor(NeighborContext& ctx)
+bool NeighOrch::processBulkEnableNeighbor(NeighborContext& ctx, ObjectBulker<sai_next_hop_api_t>& nextHopBulker)
 {
     SWSS_LOG_ENTER();
 
@@ -1331,42 +1433,94 @@ bool NeighOrch::processBulkEnableNeighbor(NeighborContext& ctx)
             gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
         }
 
-        if (!addNextHop(NextHopKey(ip_address, alias)))
+        /* The next hops are created in bulk once all the neighbors are, processBulkEnableNextHop() completes the neighbor */
+        if (!addNextHop(NextHopKey(ip_address, alias), ctx, nextHopBulker))
         {
-            status = sai_neighbor_api->remove_neighbor_entry(&neighbor_entry);
-            if (status != SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_ERROR("Failed to remove neighbor %s on %s, rv:%d",
-                               macAddress.to_string().c_str(), alias.c_str(), status);
-                task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEIGHBOR, status);
-                if (handle_status != task_success)
-                {
-                    return parseHandleSaiStatusFailure(handle_status);
-                }
-            }
-            m_intfsOrch->decreaseRouterIntfsRefCount(alias);
+            return rollbackBulkEnableNeighbor(ctx);
+        }
 
-            if (neighbor_entry.ip_address.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
-            {
-                gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
-            }
-            else
-            {
-                gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
-            }
+        return true;
+    }
 
-            return false;
-        }
+    m_syncdNeighbors[neighborEntry] = { macAddress, true };
+
+    NeighborUpdate update = { neighborEntry, macAddress, true };
+    notify(SUBJECT_TYPE_NEIGH_CHANGE, update, neighborEntry.to_string());
+
+    return true;
+}
+
+/* Process the bulk created next hop of an enabled neighbor */
+bool NeighOrch::processBulkEnableNextHop(NeighborContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    const MacAddress &macAddress = ctx.mac;
+    const NeighborEntry neighborEntry = ctx.neighborEntry;
+
+    /*
+     * The bulk create stops on the first error, the next hops queued after
+     * it are not executed. Roll them back like a next hop to retry rather
+     * than a failed one.
+     */
+    if (ctx.next_hop_status == SAI_STATUS_NOT_EXECUTED)
+    {
+        SWSS_LOG_NOTICE("Next hop %s on %s not created, an earlier next hop of the bulk failed",
+                        neighborEntry.ip_address.to_string().c_str(), neighborEntry.alias.c_str());
+        return rollbackBulkEnableNeighbor(ctx);
+    }
+
+    if (!addNextHopPost(NextHopKey(neighborEntry.ip_address, neighborEntry.alias), ctx.next_hop_id, ctx.next_hop_status))
+    {
+        return rollbackBulkEnableNeighbor(ctx);
     }
 
     m_syncdNeighbors[neighborEntry] = { macAddress, true };
 
     NeighborUpdate update = { neighborEntry, macAddress, true };
-    notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
+    notify(SUBJECT_TYPE_NEIGH_CHANGE, update, neighborEntry.to_string());
 
     return true;
 }
 
+/* Remove the neighbor created in bulk whose next hop could not be created */
+bool NeighOrch::rollbackBulkEnableNeighbor(const NeighborContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    const MacAddress &macAddress = ctx.mac;
+    string alias = ctx.neighborEntry.alias;
+
+    sai_neighbor_entry_t neighbor_entry;
+    neighbor_entry.rif_id = m_intfsOrch->getRouterIntfsId(alias);
+    neighbor_entry.switch_id = gSwitchId;
+    copy(neighbor_entry.ip_address, ctx.neighborEntry.ip_address);
+
+    sai_status_t status = sai_neighbor_api->remove_neighbor_entry(&neighbor_entry);
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to remove neighbor %s on %s, rv:%d",
+                       macAddress.to_string().c_str(), alias.c_str(), status);
+        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEIGHBOR, status);
+        if (handle_status != task_success)
+        {
+            return parseHandleSaiStatusFailure(handle_status);
+        }
+    }
+    m_intfsOrch->decreaseRouterIntfsRefCount(alias);
+
+    if (neighbor_entry.ip_address.addr_family == SAI_IP_ADDR_FAMILY_IPV4)
+    {
+        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_NEIGHBOR);
+    }
+    else
+    {
+        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
+    }
+
+    return false;
+}
+
 /* Process bulk ctx entry and disable the neigbor */
 bool NeighOrch::processBulkDisableNeighbor(NeighborContext& ctx)
 {
@@ -1525,6 +1679,8 @@ bool NeighOrch::enableNeighbors(std::list<NeighborContext>& bulk_ctx_list)
 
     gNeighBulker.flush();
 
+    ObjectBulker<sai_next_hop_api_t> nextHopBulker(sai_next_hop_api, gSwitchId, gMaxBulkSize);
+
     for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
     {
         if (ctx->object_statuses.empty())
@@ -1533,7 +1689,7 @@ bool NeighOrch::enableNeighbors(std::list<NeighborContext>& bulk_ctx_list)
         }
 
         const NeighborEntry& neighborEntry = ctx->neighborEntry;
-        if (!processBulkEnableNeighbor(*ctx))
+        if (!processBulkEnableNeighbor(*ctx, nextHopBulker))
         {
             SWSS_LOG_INFO("Enable neighbor failed for %s", neighborEntry.ip_address.to_string().c_str());
             /* finish processing bulk entries */
@@ -1541,6 +1697,24 @@ bool NeighOrch::enableNeighbors(std::list<NeighborContext>& bulk_ctx_list)
         }
     }
 
+    /* Next hops of the created neighbors */
+    nextHopBulker.flush();
+
+    for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
+    {
+        if (!ctx->next_hop_bulk_op)
+        {
+            continue;
+        }
+
+        const NeighborEntry& neighborEntry = ctx->neighborEntry;
+        if (!processBulkEnableNextHop(*ctx))
+        {
+            SWSS_LOG_INFO("Enable neighbor next hop failed for %s", neighborEntry.ip_address.to_string().c_str());
+            ret = false;
+        }
+    }
+
     gNeighBulker.clear();
     return ret;
 }
@@ -1550,6 +1724,16 @@ bool NeighOrch::disableNeighbors(std::list<NeighborContext>& bulk_ctx_list)
 {
     bool ret = true;
 
+    /* The next hops are removed in bulk ahead of their neighbors */
+    ObjectBulker<sai_next_hop_api_t> nextHopBulker(sai_next_hop_api, gSwitchId, gMaxBulkSize);
+
+    for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
+    {
+        removeNextHopBulk(*ctx, nextHopBulker);
+    }
+
+    nextHopBulker.flush();
+
     for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
     {
         const NeighborEntry& neighborEntry = ctx->neighborEntry;
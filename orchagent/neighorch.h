@@ -53,6 +53,9 @@ struct NeighborContext
     std::deque<sai_status_t>            object_statuses;            // bulk statuses
     MacAddress                          mac;                        // neighbor mac
     bool                                bulk_op = false;            // use bulker (only for mux use for now)
+    bool                                next_hop_bulk_op = false;   // next hop created/removed by the next hop bulker
+    sai_object_id_t                     next_hop_id = SAI_NULL_OBJECT_ID; // next hop created in bulk
+    sai_status_t                        next_hop_status = SAI_STATUS_NOT_EXECUTED; // next hop bulk status
 
     NeighborContext(NeighborEntry neighborEntry)
         : neighborEntry(neighborEntry)
@@ -125,8 +128,17 @@ private:
 
     bool addNeighbor(NeighborContext& ctx);
     bool removeNeighbor(NeighborContext& ctx, bool disable = false);
-    bool processBulkEnableNeighbor(NeighborContext& ctx);
+    bool processBulkEnableNeighbor(NeighborContext& ctx, ObjectBulker<sai_next_hop_api_t>& nextHopBulker);
+    bool processBulkEnableNextHop(NeighborContext& ctx);
     bool processBulkDisableNeighbor(NeighborContext& ctx);
+    void removeNextHopBulk(NeighborContext& ctx, ObjectBulker<sai_next_hop_api_t>& nextHopBulker);
+    bool rollbackBulkEnableNeighbor(const NeighborContext& ctx);
+
+    NextHopKey getSyncdNextHopKey(const NextHopKey&);
+    bool getNextHopPort(const NextHopKey&, Port&);
+    bool getNextHopAttributes(const NextHopKey&, const NextHopKey&, vector<sai_attribute_t>&, vector<Label>&);
+    bool addNextHop(const NextHopKey&, NeighborContext&, ObjectBulker<sai_next_hop_api_t>&);
+    bool addNextHopPost(const NextHopKey&, sai_object_id_t, sai_status_t);
 
     bool setNextHopFlag(const NextHopKey &, const uint32_t);
     bool clearNextHopFlag(const NextHopKey &, const uint32_t);
@@ -198,6 +198,9 @@ void NhgOrch::doTask(Consumer& consumer)
                         if (nhg->sync())
                         {
                             m_syncdNextHopGroups.emplace(index, NhgEntry<NextHopGroup>(std::move(nhg)));
+
+                            /* Wake the routes parked until the group is created */
+                            gRouteOrch->resolveConstraint(make_pair(RETRY_CST_NHG, index));
                         }
                         else
                         {
@@ -232,6 +235,7 @@ void NhgOrch::doTask(Consumer& consumer)
                             success = false;
                         }
                         m_syncdNextHopGroups.emplace(index, NhgEntry<NextHopGroup>(std::move(nhg)));
+                        gRouteOrch->resolveConstraint(make_pair(RETRY_CST_NHG, index));
                     }
                 }
             }
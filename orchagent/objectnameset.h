@@ -0,0 +1,282 @@
+#ifndef SWSS_OBJECTNAMESET_H
+#define SWSS_OBJECTNAMESET_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * ObjectNamePool interns the object names used in the reference graph of
+ * the orchs (referenced_object) into integer handles. Names are reference
+ * counted, the handle of an unused name is reused.
+ *
+ * The pool has no lock of its own: the orchs using it run in ORCH_GROUP_MAIN
+ * or in groups depending on it, so always with the main group lock held.
+ */
+class ObjectNamePool
+{
+public:
+    typedef uint32_t Handle;
+
+    static ObjectNamePool &instance()
+    {
+        // Never destroyed: static object maps may outlive it at exit
+        static ObjectNamePool *pool = new ObjectNamePool();
+        return *pool;
+    }
+
+    /* Handle of the name, taking a reference on it */
+    Handle acquire(const std::string &name)
+    {
+        auto it = m_handles.find(name);
+        if (it != m_handles.end())
+        {
+            m_entries[it->second].refs++;
+            return it->second;
+        }
+
+        Handle handle;
+        if (!m_free.empty())
+        {
+            handle = m_free.back();
+            m_free.pop_back();
+            m_entries[handle].name = name;
+        }
+        else
+        {
+            handle = static_cast<Handle>(m_entries.size());
+            m_entries.push_back({ name, 0 });
+        }
+
+        m_entries[handle].refs = 1;
+        m_handles.emplace(name, handle);
+        return handle;
+    }
+
+    void acquire(Handle handle)
+    {
+        m_entries[handle].refs++;
+    }
+
+    void release(Handle handle)
+    {
+        auto &entry = m_entries[handle];
+        if (--entry.refs != 0)
+        {
+            return;
+        }
+
+        m_handles.erase(entry.name);
+        entry.name.clear();
+        m_free.push_back(handle);
+    }
+
+    /* Handle of a name in use, without taking a reference */
+    bool find(const std::string &name, Handle &handle) const
+    {
+        auto it = m_handles.find(name);
+        if (it == m_handles.end())
+        {
+            return false;
+        }
+
+        handle = it->second;
+        return true;
+    }
+
+    const std::string &name(Handle handle) const
+    {
+        return m_entries[handle].name;
+    }
+
+    size_t size() const
+    {
+        return m_handles.size();
+    }
+
+private:
+    struct Entry
+    {
+        std::string name;
+        uint32_t refs;
+    };
+
+    std::vector<Entry> m_entries;
+    std::unordered_map<std::string, Handle> m_handles;
+    std::vector<Handle> m_free;
+
+    ObjectNamePool() = default;
+};
+
+/*
+ * Set of object names stored as a sorted vector of interned handles, with
+ * the std::set<std::string> interface used by the orchs. Lookups hash the
+ * name once then binary search integers, and the set costs a single
+ * allocation however long the names are.
+ */
+class ObjectNameSet
+{
+public:
+    typedef ObjectNamePool::Handle Handle;
+
+    class const_iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef std::string value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const std::string *pointer;
+        typedef const std::string &reference;
+
+        const_iterator() = default;
+
+        reference operator*() const { return ObjectNamePool::instance().name(*m_it); }
+        pointer operator->() const { return &ObjectNamePool::instance().name(*m_it); }
+
+        const_iterator &operator++() { ++m_it; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++m_it; return tmp; }
+        const_iterator &operator--() { --m_it; return *this; }
+        const_iterator operator--(int) { const_iterator tmp = *this; --m_it; return tmp; }
+
+        bool operator==(const const_iterator &other) const { return m_it == other.m_it; }
+        bool operator!=(const const_iterator &other) const { return m_it != other.m_it; }
+
+        Handle handle() const { return *m_it; }
+
+    private:
+        friend class ObjectNameSet;
+
+        explicit const_iterator(std::vector<Handle>::const_iterator it) : m_it(it) {}
+
+        std::vector<Handle>::const_iterator m_it;
+    };
+
+    typedef const_iterator iterator;
+
+    ObjectNameSet() = default;
+
+    ObjectNameSet(const ObjectNameSet &other) : m_handles(other.m_handles)
+    {
+        for (auto handle : m_handles)
+        {
+            ObjectNamePool::instance().acquire(handle);
+        }
+    }
+
+    ObjectNameSet(ObjectNameSet &&other) noexcept : m_handles(std::move(other.m_handles))
+    {
+        other.m_handles.clear();
+    }
+
+    ObjectNameSet &operator=(const ObjectNameSet &other)
+    {
+        if (this != &other)
+        {
+            ObjectNameSet copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    ObjectNameSet &operator=(ObjectNameSet &&other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            m_handles.swap(other.m_handles);
+        }
+        return *this;
+    }
+
+    ~ObjectNameSet()
+    {
+        clear();
+    }
+
+    const_iterator begin() const { return const_iterator(m_handles.begin()); }
+    const_iterator end() const { return const_iterator(m_handles.end()); }
+
+    size_t size() const { return m_handles.size(); }
+    bool empty() const { return m_handles.empty(); }
+
+    void swap(ObjectNameSet &other)
+    {
+        m_handles.swap(other.m_handles);
+    }
+
+    void clear()
+    {
+        for (auto handle : m_handles)
+        {
+            ObjectNamePool::instance().release(handle);
+        }
+        m_handles.clear();
+    }
+
+    const_iterator find(const std::string &name) const
+    {
+        Handle handle;
+        if (!ObjectNamePool::instance().find(name, handle))
+        {
+            return end();
+        }
+
+        auto it = std::lower_bound(m_handles.begin(), m_handles.end(), handle);
+        if (it == m_handles.end() || *it != handle)
+        {
+            return end();
+        }
+
+        return const_iterator(it);
+    }
+
+    size_t count(const std::string &name) const
+    {
+        return find(name) != end() ? 1 : 0;
+    }
+
+    std::pair<const_iterator, bool> insert(const std::string &name)
+    {
+        auto &pool = ObjectNamePool::instance();
+        Handle handle;
+
+        if (pool.find(name, handle))
+        {
+            auto it = std::lower_bound(m_handles.begin(), m_handles.end(), handle);
+            if (it != m_handles.end() && *it == handle)
+            {
+                return std::make_pair(const_iterator(it), false);
+            }
+        }
+
+        handle = pool.acquire(name);
+        auto it = m_handles.insert(std::lower_bound(m_handles.begin(), m_handles.end(), handle), handle);
+        return std::make_pair(const_iterator(it), true);
+    }
+
+    size_t erase(const std::string &name)
+    {
+        auto it = find(name);
+        if (it == end())
+        {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    const_iterator erase(const_iterator pos)
+    {
+        ObjectNamePool::instance().release(*pos.m_it);
+        return const_iterator(m_handles.erase(pos.m_it));
+    }
+
+private:
+    std::vector<Handle> m_handles;
+};
+
+#endif /* SWSS_OBJECTNAMESET_H */
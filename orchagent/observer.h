@@ -2,6 +2,12 @@
 #define SWSS_OBSERVER_H
 
 #include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 using namespace std;
 using namespace swss;
@@ -31,6 +37,20 @@ class Observer
 {
 public:
     virtual void update(SubjectType, void *) = 0;
+
+    /*
+     * Batched updates, see Subject::attachBatched(). cntxs holds the latest
+     * update of each object changed since the last delivery, in the order
+     * the objects first changed.
+     */
+    virtual void updateBatch(SubjectType type, const vector<void *> &cntxs)
+    {
+        for (auto cntx: cntxs)
+        {
+            update(type, cntx);
+        }
+    }
+
     virtual ~Observer() {}
 };
 
@@ -42,12 +62,42 @@ public:
         m_observers.push_back(observer);
     }
 
+    /*
+     * Get the updates of a type through updateBatch(), once per loop
+     * iteration, instead of one update() call per change. Only the updates
+     * notified with an object key are batched, the others stay immediate.
+     */
+    virtual void attachBatched(Observer *observer, SubjectType type)
+    {
+        if (m_batchedTypes.find(observer) == m_batchedTypes.end())
+        {
+            attach(observer);
+        }
+        m_batchedTypes[observer].insert(type);
+    }
+
     virtual void detach(Observer *observer)
     {
         m_observers.remove(observer);
+        m_batchedTypes.erase(observer);
     }
 
-    virtual ~Subject() {}
+    /* Deliver the pending batched updates of all the subjects */
+    static void notifyBatches()
+    {
+        auto &pending = pendingSubjects();
+        while (!pending.empty())
+        {
+            Subject *subject = *pending.begin();
+            pending.erase(pending.begin());
+            subject->deliverBatches();
+        }
+    }
+
+    virtual ~Subject()
+    {
+        pendingSubjects().erase(this);
+    }
 
 protected:
     list<Observer *> m_observers;
@@ -59,6 +109,98 @@ protected:
             iter->update(type, cntx);
         }
     }
+
+    /*
+     * Notify the change of one object, named by key. The observers which
+     * batch this type get a copy of the latest update of the object when
+     * the batches are delivered, the others are updated right away.
+     */
+    template <typename T>
+    void notify(SubjectType type, T &update, const string &key)
+    {
+        bool batched = false;
+
+        for (auto iter: m_observers)
+        {
+            if (isBatched(iter, type))
+            {
+                batched = true;
+                continue;
+            }
+
+            iter->update(type, static_cast<void *>(&update));
+        }
+
+        if (batched)
+        {
+            queueUpdate(type, key, make_shared<T>(update));
+        }
+    }
+
+private:
+    struct Batch
+    {
+        // Latest update of each object, in the order the objects first changed
+        vector<shared_ptr<void>> updates;
+        unordered_map<string, size_t> index;
+    };
+
+    map<Observer *, set<SubjectType>> m_batchedTypes;
+    map<SubjectType, Batch> m_batches;
+
+    /* Per thread: each execution group delivers the batches it queued */
+    static set<Subject *> &pendingSubjects()
+    {
+        static thread_local set<Subject *> subjects;
+        return subjects;
+    }
+
+    bool isBatched(Observer *observer, SubjectType type) const
+    {
+        auto it = m_batchedTypes.find(observer);
+        return it != m_batchedTypes.end() && it->second.count(type);
+    }
+
+    void queueUpdate(SubjectType type, const string &key, shared_ptr<void> update)
+    {
+        auto &batch = m_batches[type];
+
+        auto it = batch.index.find(key);
+        if (it != batch.index.end())
+        {
+            batch.updates[it->second] = update;
+        }
+        else
+        {
+            batch.index[key] = batch.updates.size();
+            batch.updates.push_back(update);
+        }
+
+        pendingSubjects().insert(this);
+    }
+
+    void deliverBatches()
+    {
+        map<SubjectType, Batch> batches;
+        batches.swap(m_batches);
+
+        for (auto &it: batches)
+        {
+            vector<void *> cntxs;
+            for (auto &update: it.second.updates)
+            {
+                cntxs.push_back(update.get());
+            }
+
+            for (auto iter: m_observers)
+            {
+                if (isBatched(iter, it.first))
+                {
+                    iter->updateBatch(it.first, cntxs);
+                }
+            }
+        }
+    }
 };
 
 #endif /* SWSS_OBSERVER_H */
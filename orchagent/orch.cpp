@@ -12,10 +12,16 @@
 #include "zmqserver.h"
 #include "zmqconsumerstatetable.h"
 #include "sai_serialize.h"
+#include "redisapi.h"
+#include "redisreply.h"
 
 using namespace swss;
 
 int gBatchSize = 0;
+size_t gConsumerTaskBudget = 0;
+uint64_t gConsumerUsecBudget = 0;
+bool gConsumerStatsEnabled = false;
+std::atomic<uint64_t> gPoppedTasks(0);
 
 Orch::Orch(DBConnector *db, const string tableName, int pri)
 {
@@ -64,49 +70,71 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
 {
     SWSS_LOG_ENTER();
 
-    string key = kfvKey(entry);
-    string op  = kfvOp(entry);
+    const string &key = kfvKey(entry);
+    const string &op  = kfvOp(entry);
 
     /* Record incoming tasks */
-    Recorder::Instance().swss.record(dumpTuple(entry));
+    auto &recorder = Recorder::Instance().swss;
+    if (recorder.isRecord())
+    {
+        recorder.record(getTableName(), getConsumerTable()->getTableNameSeparator(), entry);
+    }
+
+    /* Tasks parked for the key go back in front of the new one */
+    if (!m_retryCache.empty())
+    {
+        vector<KeyOpFieldsValuesTuple> parked;
+        if (m_retryCache.evict(key, parked))
+        {
+            for (auto &task : parked)
+            {
+                m_toSync.emplace(key, task);
+            }
+        }
+    }
+
+    mergeToSync(entry);
+
+    updateReadyState();
+}
+
+void ConsumerBase::mergeToSync(const KeyOpFieldsValuesTuple &entry)
+{
+    const string &key = kfvKey(entry);
+    const string &op  = kfvOp(entry);
 
     /*
-    * m_toSync is a multimap which will allow one key with multiple values,
-    * Also, the order of the key-value pairs whose keys compare equivalent
-    * is the order of insertion and does not change. (since C++11)
+    * m_toSync keeps the tasks of a key adjacent and in insertion order.
+    * We maintain maximum two values per key.
+    * In case there is one key-value, it should be DEL or SET
+    * In case there are two key-value pairs, it should be DEL then SET
     */
+    auto ret = m_toSync.equal_range(key);
 
     /* If a new task comes we directly put it into getConsumerTable().m_toSync map */
-    if (m_toSync.find(key) == m_toSync.end())
+    if (ret.first == ret.second)
     {
         m_toSync.emplace(key, entry);
     }
 
-    /* if a DEL task comes, we overwrite the old key */
+    /* if a DEL task comes, it collapses all the pending tasks of the key */
     else if (op == DEL_COMMAND)
     {
-        m_toSync.erase(key);
-        m_toSync.emplace(key, entry);
+        ret.first->second = entry;
+        m_toSync.erase(std::next(ret.first), ret.second);
     }
     else
     {
         /*
         * Now we are trying to add the key-value with SET.
-        * We maintain maximum two values per key.
-        * In case there is one key-value, it should be DEL or SET
-        * In case there are two key-value pairs, it should be DEL then SET
-        * The code logic is following:
-        * We iterate the values with the key, we skip the value with DEL and then
-        * check if that was the only one (I,E, the iter pointer now points to end or next key),
-        * in such case, we insert the key-value with SET.
-        * If there was a SET already (I,E, the pointer still points to the same key), we combine the kfv.
+        * We skip the value with DEL, if there is no SET yet we append
+        * the new one after it. If there was a SET already, we merge the
+        * new fields into it in place.
         */
-        auto ret = m_toSync.equal_range(key);
         auto iter = ret.first;
         for (; iter != ret.second; ++iter)
         {
-            auto old_op = kfvOp(iter->second);
-            if (old_op == SET_COMMAND)
+            if (kfvOp(iter->second) == SET_COMMAND)
                 break;
         }
         if (iter == ret.second)
@@ -115,32 +143,24 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
         }
         else
         {
-            KeyOpFieldsValuesTuple existing_data = iter->second;
+            auto &existing_values = kfvFieldsValues(iter->second);
 
-            auto new_values = kfvFieldsValues(entry);
-            auto existing_values = kfvFieldsValues(existing_data);
-
-
-            for (auto it : new_values)
+            for (const auto &it : kfvFieldsValues(entry))
             {
-                string field = fvField(it);
-                string value = fvValue(it);
+                const string &field = fvField(it);
 
                 auto iu = existing_values.begin();
                 while (iu != existing_values.end())
                 {
-                    string ofield = fvField(*iu);
-                    if (field == ofield)
+                    if (fvField(*iu) == field)
                         iu = existing_values.erase(iu);
                     else
                         iu++;
                 }
-                existing_values.push_back(FieldValueTuple(field, value));
+                existing_values.push_back(it);
             }
-            iter->second = KeyOpFieldsValuesTuple(key, op, existing_values);
         }
     }
-
 }
 
 size_t ConsumerBase::addToSync(const std::deque<KeyOpFieldsValuesTuple> &entries)
@@ -158,9 +178,17 @@ size_t ConsumerBase::addToSync(const std::deque<KeyOpFieldsValuesTuple> &entries
 // TODO: Table should be const
 size_t ConsumerBase::refillToSync(Table* table)
 {
-    std::deque<KeyOpFieldsValuesTuple> entries;
     vector<string> keys;
+
     table->getKeys(keys);
+    return refillToSync(table, keys);
+}
+
+size_t ConsumerBase::refillToSync(Table* table, const vector<string> &keys)
+{
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    size_t refilled = 0;
+
     for (const auto &key: keys)
     {
         KeyOpFieldsValuesTuple kco;
@@ -173,9 +201,114 @@ size_t ConsumerBase::refillToSync(Table* table)
             continue;
         }
         entries.push_back(kco);
+
+        if (entries.size() >= REFILL_BATCH_SIZE)
+        {
+            refilled += addToSync(entries);
+            entries.clear();
+        }
     }
 
-    return addToSync(entries);
+    return refilled + addToSync(entries);
+}
+
+std::function<std::string(DBConnector *)> ConsumerBase::refillScriptLoader = [](DBConnector *db)
+{
+    return loadRedisScript(db, loadLuaScript("refill_table.lua"));
+};
+
+/*
+ * Refill from the table in the DB, REFILL_BATCH_SIZE keys per round trip.
+ * The hashes of a batch are read by refill_table.lua, instead of one HGETALL
+ * round trip per key, which matters on warm restart with large tables.
+ * Without the script, the keys are read one by one from the Table.
+ */
+size_t ConsumerBase::refillToSync(DBConnector *db, const string &tableName)
+{
+    SWSS_LOG_ENTER();
+
+    Table table(db, tableName);
+    vector<string> keys;
+    size_t refilled = 0;
+
+    table.getKeys(keys);
+    if (keys.empty())
+    {
+        return 0;
+    }
+
+    string sha;
+    try
+    {
+        sha = refillScriptLoader(db);
+    }
+    catch (const std::exception &e)
+    {
+        SWSS_LOG_WARN("Failed to load refill_table.lua, refilling %s key by key: %s", tableName.c_str(), e.what());
+        return refillToSync(&table);
+    }
+
+    for (size_t start = 0; start < keys.size(); start += REFILL_BATCH_SIZE)
+    {
+        size_t end = min(keys.size(), start + REFILL_BATCH_SIZE);
+
+        vector<string> args = { "EVALSHA", sha, to_string(end - start) };
+        for (size_t i = start; i < end; i++)
+        {
+            args.push_back(table.getKeyName(keys[i]));
+        }
+
+        RedisCommand command;
+        command.format(args);
+
+        // The reply type is checked below, RedisReply still throws on an error reply
+        unique_ptr<RedisReply> r;
+        try
+        {
+            r.reset(new RedisReply(db, command));
+        }
+        catch (const std::exception &e)
+        {
+            SWSS_LOG_WARN("Failed to run refill_table.lua, refilling the %zu keys left of %s key by key: %s",
+                          keys.size() - start, tableName.c_str(), e.what());
+            return refilled + refillToSync(&table, vector<string>(keys.begin() + start, keys.end()));
+        }
+
+        redisReply *reply = r->getContext();
+        if (reply->type != REDIS_REPLY_ARRAY)
+        {
+            SWSS_LOG_WARN("Unexpected refill_table.lua reply type %d, refilling the %zu keys left of %s key by key",
+                          reply->type, keys.size() - start, tableName.c_str());
+            return refilled + refillToSync(&table, vector<string>(keys.begin() + start, keys.end()));
+        }
+
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        for (size_t i = 0; i < reply->elements && start + i < end; i++)
+        {
+            redisReply *hash = reply->element[i];
+            if (hash->type != REDIS_REPLY_ARRAY || hash->elements == 0)
+            {
+                // Removed since getKeys
+                continue;
+            }
+
+            KeyOpFieldsValuesTuple kco;
+
+            kfvKey(kco) = keys[start + i];
+            kfvOp(kco) = SET_COMMAND;
+
+            for (size_t j = 0; j + 1 < hash->elements; j += 2)
+            {
+                kfvFieldsValues(kco).emplace_back(string(hash->element[j]->str, hash->element[j]->len),
+                                                  string(hash->element[j + 1]->str, hash->element[j + 1]->len));
+            }
+            entries.push_back(std::move(kco));
+        }
+
+        refilled += addToSync(entries);
+    }
+
+    return refilled;
 }
 
 size_t ConsumerBase::refillToSync()
@@ -199,16 +332,12 @@ size_t ConsumerBase::refillToSync()
     if (consumerTable != NULL)
     {
         // consumerTable is either ConsumerStateTable or ConsumerTable
-        auto db = consumerTable->getDbConnector();
-        auto table = Table(db, tableName);
-        return refillToSync(&table);
+        return refillToSync(consumerTable->getDbConnector(), tableName);
     }
     auto zmqTable = dynamic_cast<ZmqConsumerStateTable *>(getSelectable());
     if (zmqTable != NULL)
     {
-        auto db = zmqTable->getDbConnector();
-        auto table = Table(db, tableName);
-        return refillToSync(&table);
+        return refillToSync(zmqTable->getDbConnector(), tableName);
     }
     return 0;
 }
@@ -225,6 +354,64 @@ string ConsumerBase::dumpTuple(const KeyOpFieldsValuesTuple &tuple)
     return s;
 }
 
+void ConsumerBase::updateReadyState()
+{
+    bool ready = !m_toSync.empty();
+    if (ready == m_ready || m_orch == nullptr)
+    {
+        return;
+    }
+
+    m_ready = ready;
+    if (ready)
+    {
+        m_orch->markReady(this);
+    }
+    else
+    {
+        m_orch->clearReady(this);
+    }
+}
+
+SyncMap::iterator ConsumerBase::parkTask(SyncMap::iterator it, const Constraint &cst)
+{
+    string key = it->first;
+    vector<KeyOpFieldsValuesTuple> tasks;
+
+    while (it != m_toSync.end() && it->first == key)
+    {
+        tasks.push_back(it->second);
+        it = m_toSync.erase(it);
+    }
+
+    SWSS_LOG_INFO("Park %zu task(s) of %s:%s until %s is resolved",
+                  tasks.size(), getName().c_str(), key.c_str(), cst.second.c_str());
+
+    m_retryCounters.parked += tasks.size();
+    m_retryCache.insert(key, cst, std::move(tasks));
+
+    return it;
+}
+
+size_t ConsumerBase::wakeTasks(const Constraint &cst)
+{
+    vector<KeyOpFieldsValuesTuple> tasks;
+    if (m_retryCache.resolve(cst, tasks) == 0)
+    {
+        return 0;
+    }
+
+    for (auto &task : tasks)
+    {
+        m_toSync.emplace(kfvKey(task), task);
+    }
+
+    m_retryCounters.woken += tasks.size();
+    updateReadyState();
+
+    return tasks.size();
+}
+
 void ConsumerBase::dumpPendingTasks(vector<string> &ts)
 {
     for (auto &tm : m_toSync)
@@ -235,6 +422,138 @@ void ConsumerBase::dumpPendingTasks(vector<string> &ts)
 
         ts.push_back(s);
     }
+
+    /* Parked tasks are pending as well */
+    m_retryCache.forEach([&](const Constraint &cst, const KeyOpFieldsValuesTuple &tuple) {
+        ts.push_back(dumpTuple(tuple) + "|<waiting:" + cst.second + ">");
+    });
+}
+
+void ConsumerBase::dumpStats(vector<string> &ts)
+{
+    string s = getName();
+    for (const auto &fv : getStatsFieldValues())
+    {
+        s += "|" + fvField(fv) + ":" + fvValue(fv);
+    }
+
+    ts.push_back(s);
+}
+
+size_t ConsumerBase::getBudget() const
+{
+    size_t budget = gConsumerTaskBudget;
+
+    if (gConsumerUsecBudget != 0)
+    {
+        size_t timed = BUDGET_PROBE_TASKS;
+        if (m_usecPerTask > 0)
+        {
+            timed = max<size_t>(1, static_cast<size_t>(static_cast<double>(gConsumerUsecBudget) / m_usecPerTask));
+        }
+
+        budget = budget ? min(budget, timed) : timed;
+    }
+
+    return budget;
+}
+
+ConsumerBase::DrainSlice::DrainSlice(ConsumerBase &consumer)
+    : m_consumer(consumer)
+{
+    auto &toSync = consumer.m_toSync;
+    size_t budget = consumer.getBudget();
+
+    if (gConsumerUsecBudget != 0)
+    {
+        m_start = chrono::steady_clock::now();
+    }
+
+    m_tasks = toSync.size();
+    if (budget == 0 || toSync.size() <= budget)
+    {
+        return;
+    }
+
+    /* Move the first tasks back in m_toSync, without splitting the tasks of a key */
+    m_deferred.swap(toSync);
+
+    auto it = m_deferred.begin();
+    while (it != m_deferred.end())
+    {
+        if (toSync.size() >= budget && it->first != toSync.rbegin()->first)
+        {
+            break;
+        }
+
+        toSync.emplace(it->first, std::move(it->second));
+        it = m_deferred.erase(it);
+    }
+
+    m_tasks = toSync.size();
+}
+
+ConsumerBase::DrainSlice::~DrainSlice()
+{
+    auto &toSync = m_consumer.m_toSync;
+
+    if (gConsumerUsecBudget != 0 && m_tasks != 0)
+    {
+        double usec = static_cast<double>(chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - m_start).count());
+        double perTask = usec / static_cast<double>(m_tasks);
+        double &average = m_consumer.m_usecPerTask;
+
+        average = (average > 0) ? (average * 7 + perTask) / 8 : perTask;
+    }
+
+    m_consumer.m_backlog = !m_deferred.empty();
+    if (m_deferred.empty())
+    {
+        return;
+    }
+
+    /*
+     * The deferred tasks go first. The tasks left in the slice, retried or
+     * added during the drain, are newer than the deferred tasks of their key.
+     */
+    m_deferred.swap(toSync);
+    for (const auto &it : m_deferred)
+    {
+        m_consumer.mergeToSync(it.second);
+    }
+    m_deferred.clear();
+}
+
+ConsumerBase::DrainStats::DrainStats(ConsumerBase &consumer)
+{
+    if (!gConsumerStatsEnabled)
+    {
+        return;
+    }
+
+    m_consumer = &consumer;
+    m_depth = consumer.m_toSync.size();
+    m_parked = consumer.m_retryCounters.parked;
+    m_start = chrono::steady_clock::now();
+}
+
+ConsumerBase::DrainStats::~DrainStats()
+{
+    if (m_consumer == nullptr)
+    {
+        return;
+    }
+
+    auto usec = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - m_start).count();
+    auto &stats = m_consumer->m_stats;
+    size_t left = m_consumer->m_toSync.size() + (m_consumer->m_retryCounters.parked - m_parked);
+
+    stats.drainTime.add(usec);
+    stats.maxDepth = max<uint64_t>(stats.maxDepth, m_depth);
+    if (m_depth > left)
+    {
+        stats.completed += m_depth - left;
+    }
 }
 
 void Consumer::execute()
@@ -249,6 +568,7 @@ void Consumer::execute()
         std::deque<KeyOpFieldsValuesTuple> entries;
         table->pops(entries);
         update_size = addToSync(entries);
+        countPopped(update_size);
     } while (update_size != 0);
 
     drain();
@@ -257,7 +577,14 @@ void Consumer::execute()
 void Consumer::drain()
 {
     if (!m_toSync.empty())
+    {
+        DrainSlice slice(*this);
+        DrainStats stats(*this);
         ((Orch *)m_orch)->doTask((Consumer&)*this);
+        m_retryCounters.retried += m_toSync.size();
+    }
+
+    updateReadyState();
 }
 
 size_t Orch::addExistingData(const string& tableName)
@@ -300,8 +627,10 @@ bool Orch::bake()
             continue;
         }
 
+        auto start = std::chrono::steady_clock::now();
         size_t refilled = consumer->refillToSync();
-        SWSS_LOG_NOTICE("Add warm input: %s, %zd", executorName.c_str(), refilled);
+        auto msecs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        SWSS_LOG_NOTICE("Add warm input: %s, %zd in %" PRId64 " ms", executorName.c_str(), refilled, static_cast<int64_t>(msecs));
     }
 
     return true;
@@ -318,9 +647,18 @@ bool Orch::bake()
 - indication to the caller of the special case
 */
 bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &type_name, string &object_name)
+{
+    referenced_object *object;
+    return parseReference(type_maps, ref_in, type_name, object_name, object);
+}
+
+/* Same as above, also returns the referenced object, nullptr for [] */
+bool Orch::parseReference(type_map &type_maps, const string &ref_in, const string &type_name, string &object_name, referenced_object *&object)
 {
     SWSS_LOG_ENTER();
 
+    object = nullptr;
+
     SWSS_LOG_DEBUG("input:%s", ref_in.c_str());
 
     if (ref_in.size() == 0)
@@ -345,7 +683,7 @@ bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &typ
         SWSS_LOG_ERROR("not recognized type:%s\n", type_name.c_str());
         return false;
     }
-    auto obj_map = type_maps[type_name];
+    auto &obj_map = type_it->second;
     auto obj_it = obj_map->find(ref_in);
     if (obj_it == obj_map->end())
     {
@@ -358,6 +696,7 @@ bool Orch::parseReference(type_map &type_maps, string &ref_in, const string &typ
         return false;
     }
     object_name = ref_in;
+    object = &obj_it->second;
     SWSS_LOG_DEBUG("parsed: type_name:%s, object_name:%s", type_name.c_str(), object_name.c_str());
     return true;
 }
@@ -384,7 +723,8 @@ ref_resolve_status Orch::resolveFieldRefValue(
                 return ref_resolve_status::multiple_instances;
             }
             string object_name;
-            if (!parseReference(type_maps, fvValue(*i), ref_type_name, object_name))
+            referenced_object *object;
+            if (!parseReference(type_maps, fvValue(*i), ref_type_name, object_name, object))
             {
                 return ref_resolve_status::not_resolved;
             }
@@ -392,7 +732,7 @@ ref_resolve_status Orch::resolveFieldRefValue(
             {
                 return ref_resolve_status::empty;
             }
-            sai_object = (*(type_maps[ref_type_name]))[object_name].m_saiObjectId;
+            sai_object = object->m_saiObjectId;
             referenced_object_name = ref_type_name + delimiter + object_name;
             hit = true;
         }
@@ -405,6 +745,32 @@ ref_resolve_status Orch::resolveFieldRefValue(
     return ref_resolve_status::success;
 }
 
+/*
+ * Call f(table, object) for each "table:object" of a reference list
+ * "table:object,table:object", without building token vectors.
+ */
+template <typename F>
+static void forEachReference(const string &references, F f)
+{
+    size_t start = 0;
+    while (start < references.size())
+    {
+        size_t end = references.find(list_item_delimiter, start);
+        if (end == string::npos)
+        {
+            end = references.size();
+        }
+
+        size_t sep = references.find(delimiter, start);
+        if (sep < end)
+        {
+            f(references.substr(start, sep - start), references.substr(sep + 1, end - sep - 1));
+        }
+
+        start = end + 1;
+    }
+}
+
 void Orch::removeMeFromObjsReferencedByMe(
     type_map &type_maps,
     const string &table,
@@ -413,20 +779,15 @@ void Orch::removeMeFromObjsReferencedByMe(
     const string &old_referenced_obj_name,
     bool remove_field)
 {
-    vector<string> objects = tokenize(old_referenced_obj_name, list_item_delimiter);
-    for (auto &obj : objects)
-    {
-        // obj_name references token
-        auto tokens = tokenize(obj, delimiter);
-        auto &referenced_table = tokens[0];
-        auto &ref_obj_name = tokens[1];
+    forEachReference(old_referenced_obj_name, [&](const string &referenced_table, const string &ref_obj_name) {
+        // obj_name references ref_obj_name
         auto &old_referenced_obj = (*type_maps[referenced_table])[ref_obj_name];
         old_referenced_obj.m_objsDependingOnMe.erase(obj_name);
-        SWSS_LOG_INFO("Obj %s.%s Field %s: Remove reference to %s %s (now %s)",
+        SWSS_LOG_INFO("Obj %s.%s Field %s: Remove reference to %s %s (now %zu)",
                       table.c_str(), obj_name.c_str(), field.c_str(),
                       referenced_table.c_str(), ref_obj_name.c_str(),
-                      to_string(old_referenced_obj.m_objsDependingOnMe.size()).c_str());
-    }
+                      old_referenced_obj.m_objsDependingOnMe.size());
+    });
 
     if (remove_field)
     {
@@ -451,19 +812,14 @@ void Orch::setObjectReference(
     obj.m_objsReferencingByMe[field] = referenced_obj;
 
     // Add the reference to the new object being referenced
-    vector<string> objs = tokenize(referenced_obj, list_item_delimiter);
-    for (auto &obj : objs)
-    {
-        auto tokens = tokenize(obj, delimiter);
-        auto &referenced_table = tokens[0];
-        auto &referenced_obj_name = tokens[1];
+    forEachReference(referenced_obj, [&](const string &referenced_table, const string &referenced_obj_name) {
         auto &new_obj_being_referenced = (*type_maps[referenced_table])[referenced_obj_name];
         new_obj_being_referenced.m_objsDependingOnMe.insert(obj_name);
-        SWSS_LOG_INFO("Obj %s.%s Field %s: Add reference to %s %s (now %s)",
+        SWSS_LOG_INFO("Obj %s.%s Field %s: Add reference to %s %s (now %zu)",
                       table.c_str(), obj_name.c_str(), field.c_str(),
                       referenced_table.c_str(), referenced_obj_name.c_str(),
-                      to_string(new_obj_being_referenced.m_objsDependingOnMe.size()).c_str());
-    }
+                      new_obj_being_referenced.m_objsDependingOnMe.size());
+    });
 }
 
 bool Orch::doesObjectExist(
@@ -536,10 +892,86 @@ string Orch::objectReferenceInfo(
 
 void Orch::doTask()
 {
+    /*
+     * Drain ready executors only, by priority. The ready list may change
+     * while draining (a drained consumer leaves it, or a task feeds another
+     * consumer), so look up the next entry after each drain.
+     */
+    auto it = m_readyExecutors.begin();
+    while (it != m_readyExecutors.end())
+    {
+        auto ready = *it;
+
+        auto executor = m_consumerMap.find(ready.second);
+        if (executor != m_consumerMap.end())
+        {
+            executor->second->drain();
+        }
+
+        it = m_readyExecutors.upper_bound(ready);
+    }
+}
+
+bool Orch::hasBacklog() const
+{
+    for (const auto &ready : m_readyExecutors)
+    {
+        auto executor = m_consumerMap.find(ready.second);
+        if (executor == m_consumerMap.end())
+        {
+            continue;
+        }
+
+        auto consumer = dynamic_cast<ConsumerBase *>(executor->second.get());
+        if (consumer != NULL && consumer->hasBacklog())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Orch::markReady(Executor *executor)
+{
+    auto it = m_consumerMap.find(executor->getName());
+
+    // Only executors owned by this Orch are scheduled by it
+    if (it == m_consumerMap.end() || it->second.get() != executor)
+    {
+        return;
+    }
+
+    m_readyExecutors.emplace(-executor->getPri(), executor->getName());
+}
+
+void Orch::clearReady(Executor *executor)
+{
+    auto it = m_consumerMap.find(executor->getName());
+    if (it == m_consumerMap.end() || it->second.get() != executor)
+    {
+        return;
+    }
+
+    m_readyExecutors.erase(make_pair(-executor->getPri(), executor->getName()));
+}
+
+size_t Orch::resolveConstraint(const Constraint &cst)
+{
+    size_t woken = 0;
+
     for (auto &it : m_consumerMap)
     {
-        it.second->drain();
+        auto consumer = dynamic_cast<ConsumerBase *>(it.second.get());
+        if (consumer == NULL || !consumer->hasParkedTasks())
+        {
+            continue;
+        }
+
+        woken += consumer->wakeTasks(cst);
     }
+
+    return woken;
 }
 
 void Orch::dumpPendingTasks(vector<string> &ts)
@@ -557,6 +989,34 @@ void Orch::dumpPendingTasks(vector<string> &ts)
     }
 }
 
+void Orch::dumpConsumerStats(vector<string> &ts)
+{
+    for (auto &it : m_consumerMap)
+    {
+        ConsumerBase* consumer = dynamic_cast<ConsumerBase *>(it.second.get());
+        if (consumer == NULL)
+        {
+            continue;
+        }
+
+        consumer->dumpStats(ts);
+    }
+}
+
+void Orch::publishConsumerStats(Table &table)
+{
+    for (auto &it : m_consumerMap)
+    {
+        ConsumerBase* consumer = dynamic_cast<ConsumerBase *>(it.second.get());
+        if (consumer == NULL)
+        {
+            continue;
+        }
+
+        table.set(consumer->getName(), consumer->getStatsFieldValues());
+    }
+}
+
 void Orch::flushResponses()
 {
     m_publisher.flush();
@@ -596,12 +1056,14 @@ ref_resolve_status Orch::resolveFieldRefArray(
             }
             for (size_t ind = 0; ind < list_items.size(); ind++)
             {
-                if (!parseReference(type_maps, list_items[ind], ref_type_name, object_name))
+                referenced_object *object;
+                if (!parseReference(type_maps, list_items[ind], ref_type_name, object_name, object))
                 {
                     SWSS_LOG_NOTICE("Failed to parse profile reference:%s\n", list_items[ind].c_str());
                     return ref_resolve_status::not_resolved;
                 }
-                sai_object_id_t sai_obj = (*(type_maps[ref_type_name]))[object_name].m_saiObjectId;
+                // An empty item references no object
+                sai_object_id_t sai_obj = object ? object->m_saiObjectId : SAI_NULL_OBJECT_ID;
                 SWSS_LOG_DEBUG("Resolved to sai_object:0x%" PRIx64 ", type:%s, name:%s", sai_obj, ref_type_name.c_str(), object_name.c_str());
                 sai_object_arr.push_back(sai_obj);
                 if (!object_name_list.empty())
@@ -821,10 +1283,13 @@ void Orch2::doTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    m_bulkConsumer = &consumer;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
         bool erase_from_queue = true;
+        m_deferCurrent = false;
         try
         {
             request_.parse(it->second);
@@ -863,7 +1328,11 @@ void Orch2::doTask(Consumer &consumer)
         }
         request_.clear();
 
-        if (erase_from_queue)
+        if (m_deferCurrent)
+        {
+            m_deferredTasks.push_back(it++);
+        }
+        else if (erase_from_queue)
         {
             it = consumer.m_toSync.erase(it);
         }
@@ -872,4 +1341,44 @@ void Orch2::doTask(Consumer &consumer)
             ++it;
         }
     }
+
+    flushOperations();
+    m_bulkConsumer = nullptr;
+}
+
+bool Orch2::deferOperation()
+{
+    m_deferCurrent = true;
+    return false;
+}
+
+void Orch2::flushOperations()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_deferredTasks.empty())
+    {
+        return;
+    }
+
+    std::vector<bool> done;
+    try
+    {
+        done = doBulkOperations();
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("Exception was catched in the bulk operations: %s", e.what());
+    }
+
+    /* The tasks without a result are retried */
+    for (size_t i = 0; i < m_deferredTasks.size(); i++)
+    {
+        if (i < done.size() && done[i])
+        {
+            m_bulkConsumer->m_toSync.erase(m_deferredTasks[i]);
+        }
+    }
+
+    m_deferredTasks.clear();
 }
@@ -7,6 +7,8 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <chrono>
+#include <functional>
 
 extern "C" {
 #include <sai.h>
@@ -24,6 +26,10 @@ extern "C" {
 #include "macaddress.h"
 #include "response_publisher.h"
 #include "recorder.h"
+#include "retrycache.h"
+#include "syncmap.h"
+#include "consumerstats.h"
+#include "objectnameset.h"
 
 const char delimiter           = ':';
 const char list_item_delimiter = ',';
@@ -51,6 +57,27 @@ const char state_db_key_delimiter  = '|';
 
 const int default_orch_pri = 0;
 
+/* Keys read per round trip, and added to m_toSync at once, by refillToSync */
+#define REFILL_BATCH_SIZE 1000
+
+/* Tasks per drain until the time per task is known, with a time budget only */
+#define BUDGET_PROBE_TASKS 128
+
+/*
+ * Work budget of one drain of a consumer, orchagent -t (tasks) and -u
+ * (microseconds), 0 for no limit. The tasks over the budget are left
+ * for the next loop iteration.
+ */
+extern size_t gConsumerTaskBudget;
+extern uint64_t gConsumerUsecBudget;
+
+/* Execution groups, see Orch::setExecutionGroup() */
+#define ORCH_GROUP_MAIN     "main"
+#define ORCH_GROUP_P4       "p4"
+#define ORCH_GROUP_DASH     "dash"
+#define ORCH_GROUP_NAT      "nat"
+#define ORCH_GROUP_COUNTERS "counters"
+
 typedef enum
 {
     task_success,
@@ -64,7 +91,7 @@ typedef enum
 typedef struct
 {
     // m_objsDependingOnMe stores names (without table name) of all objects depending on the current obj
-    std::set<std::string> m_objsDependingOnMe;
+    ObjectNameSet m_objsDependingOnMe;
     // m_objsReferencingByMe is a map from a field of the current object's to the object names it references
     // the object names are with table name
     // multiple objects being referenced are separated by ','
@@ -73,16 +100,12 @@ typedef struct
     bool m_pendingRemove;
 } referenced_object;
 
-typedef std::map<std::string, referenced_object> object_reference_map;
-typedef std::map<std::string, std::shared_ptr<object_reference_map>> type_map;
+typedef std::unordered_map<std::string, referenced_object> object_reference_map;
+typedef std::unordered_map<std::string, std::shared_ptr<object_reference_map>> type_map;
 
 typedef std::map<std::string, sai_object_id_t> object_map;
 typedef std::pair<std::string, sai_object_id_t> object_map_pair;
 
-// Use multimap to support multiple OpFieldsValues for the same key (e,g, DEL and SET)
-// The order of the key-value pairs whose keys compare equivalent is the order of
-// insertion and does not change. (since C++11)
-typedef std::multimap<std::string, swss::KeyOpFieldsValuesTuple> SyncMap;
 
 typedef std::pair<std::string, int> table_name_with_pri_t;
 
@@ -96,7 +119,8 @@ class Executor : public swss::Selectable
 {
 public:
     Executor(swss::Selectable *selectable, Orch *orch, const std::string &name)
-        : m_selectable(selectable)
+        : swss::Selectable(selectable ? selectable->getPri() : 0)
+        , m_selectable(selectable)
         , m_orch(orch)
         , m_name(name)
     {
@@ -166,6 +190,116 @@ public:
 
     size_t refillToSync();
     size_t refillToSync(swss::Table* table);
+    size_t refillToSync(swss::Table* table, const std::vector<std::string> &keys);
+    size_t refillToSync(swss::DBConnector *db, const std::string &tableName);
+
+    /*
+     * Loads refill_table.lua into the DB and returns its SHA, throws if it
+     * can not. refillToSync() then reads the keys one by one from the Table.
+     */
+    static std::function<std::string(swss::DBConnector *)> refillScriptLoader;
+
+    /*
+     * Keep the owning Orch's ready list in sync with m_toSync:
+     * the consumer is ready while it has pending tasks.
+     */
+    void updateReadyState();
+
+    /*
+     * Park the task at 'it', and the later tasks for the same key, until
+     * the constraint is resolved instead of retrying them on every drain.
+     * Returns the iterator following the parked tasks.
+     */
+    SyncMap::iterator parkTask(SyncMap::iterator it, const Constraint &cst);
+
+    // Move the tasks waiting on the constraint back to m_toSync
+    size_t wakeTasks(const Constraint &cst);
+
+    bool hasParkedTasks() const
+    {
+        return !m_retryCache.empty();
+    }
+
+    /* The last drain left tasks over the budget in m_toSync */
+    bool hasBacklog() const
+    {
+        return m_backlog;
+    }
+
+    const RetryCounters &getRetryCounters() const
+    {
+        return m_retryCounters;
+    }
+
+    const ConsumerStats &getStats() const
+    {
+        return m_stats;
+    }
+
+    std::vector<swss::FieldValueTuple> getStatsFieldValues() const
+    {
+        return m_stats.toFieldValues(m_retryCounters.retried, m_retryCounters.parked);
+    }
+
+    void dumpStats(std::vector<std::string> &ts);
+
+protected:
+    RetryCounters m_retryCounters;
+    ConsumerStats m_stats;
+
+    /* Updates m_stats around one drain of m_toSync, if gConsumerStatsEnabled */
+    class DrainStats
+    {
+    public:
+        DrainStats(ConsumerBase &consumer);
+        ~DrainStats();
+
+    private:
+        ConsumerBase *m_consumer = nullptr;
+        size_t m_depth = 0;
+        uint64_t m_parked = 0;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    /*
+     * Keeps only the tasks within the work budget in m_toSync for one drain,
+     * the others are set aside and put back after the remaining tasks.
+     */
+    class DrainSlice
+    {
+    public:
+        DrainSlice(ConsumerBase &consumer);
+        ~DrainSlice();
+
+    private:
+        ConsumerBase &m_consumer;
+        SyncMap m_deferred;
+        size_t m_tasks = 0;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    void countPopped(size_t count)
+    {
+        gPoppedTasks += count;
+        if (gConsumerStatsEnabled)
+        {
+            m_stats.popped += count;
+        }
+    }
+
+private:
+    bool m_ready = false;
+    bool m_backlog = false;
+
+    // Average drain time per task, for gConsumerUsecBudget
+    double m_usecPerTask = 0;
+
+    RetryCache m_retryCache;
+
+    // Merge a task in m_toSync, see addToSync()
+    void mergeToSync(const swss::KeyOpFieldsValuesTuple &entry);
+
+    size_t getBudget() const;
 };
 
 class Consumer : public ConsumerBase {
@@ -235,7 +369,7 @@ public:
     // otherwise fallback to cold start
     virtual bool bake();
 
-    /* Iterate all consumers in m_consumerMap and run doTask(Consumer) */
+    /* Iterate ready consumers by priority and run doTask(Consumer) */
     virtual void doTask();
 
     /* Run doTask against a specific executor */
@@ -245,13 +379,60 @@ public:
 
     void dumpPendingTasks(std::vector<std::string> &ts);
 
+    /* Consumer statistics, see gConsumerStatsEnabled */
+    void dumpConsumerStats(std::vector<std::string> &ts);
+    void publishConsumerStats(swss::Table &table);
+
     /**
      * @brief Flush pending responses
      */
     void flushResponses();
+
+    /*
+     * Ready list: executors which have pending tasks to drain.
+     * Consumers add/remove themselves when their m_toSync changes
+     * from/to empty, so idle consumers are skipped by doTask().
+     */
+    void markReady(Executor *executor);
+    void clearReady(Executor *executor);
+    bool hasReadyExecutors() const { return !m_readyExecutors.empty(); }
+
+    /* Whether a ready consumer has tasks left over its work budget */
+    bool hasBacklog() const;
+
+    /* Wake the tasks parked on the constraint in all consumers of this Orch */
+    size_t resolveConstraint(const Constraint &cst);
+
+    /*
+     * Execution group: the orchs of a group other than ORCH_GROUP_MAIN run
+     * on their own thread and Select loop in OrchDaemon::start(), under the
+     * lock of their group. Orchs declare their group from their constructor.
+     *
+     * An orch may only call into the orchs of its own group and of the
+     * groups it lists in dependencies: its group then runs with the locks
+     * of all of them held, so it is serialized with those groups only.
+     * Orchs called from every group (CrmOrch used counters) guard their
+     * shared state with a lock of their own instead, and must not call
+     * into other orchs while holding it. A group which does not depend on
+     * ORCH_GROUP_MAIN must also pop its tables through a DBConnector of
+     * its own, a hiredis context is not shared between threads.
+     */
+    void setExecutionGroup(const std::string &group, const std::vector<std::string> &dependencies = {})
+    {
+        m_executionGroup = group;
+        m_groupDependencies = dependencies;
+    }
+    const std::string &getExecutionGroup() const { return m_executionGroup; }
+    const std::vector<std::string> &getGroupDependencies() const { return m_groupDependencies; }
 protected:
     ConsumerMap m_consumerMap;
 
+    /*
+     * Ready executors, by decreasing table priority (table_name_with_pri_t)
+     * then name: the critical tables of an Orch are drained first.
+     */
+    std::set<std::pair<int, std::string>> m_readyExecutors;
+
     Orch();
     ref_resolve_status resolveFieldRefValue(type_map&, const std::string&, const std::string&, swss::KeyOpFieldsValuesTuple&, sai_object_id_t&, std::string&);
     std::set<std::string> generateIdListFromMap(unsigned long idsMap, sai_uint32_t maxId);
@@ -259,6 +440,7 @@ protected:
     bool isItemIdsMapContinuous(unsigned long idsMap, sai_uint32_t maxId);
     bool parseIndexRange(const std::string &input, sai_uint32_t &range_low, sai_uint32_t &range_high);
     bool parseReference(type_map &type_maps, std::string &ref, const std::string &table_name, std::string &object_name);
+    bool parseReference(type_map &type_maps, const std::string &ref, const std::string &table_name, std::string &object_name, referenced_object *&object);
     ref_resolve_status resolveFieldRefArray(type_map&, const std::string&, const std::string&, swss::KeyOpFieldsValuesTuple&, std::vector<sai_object_id_t>&, std::string&);
     void setObjectReference(type_map&, const std::string&, const std::string&, const std::string&, const std::string&);
     bool doesObjectExist(type_map&, const std::string&, const std::string&, const std::string&, std::string&);
@@ -273,6 +455,9 @@ protected:
 
     ResponsePublisher m_publisher{"APPL_STATE_DB"};
 private:
+    std::string m_executionGroup = ORCH_GROUP_MAIN;
+    std::vector<std::string> m_groupDependencies;
+
     void addConsumer(swss::DBConnector *db, std::string tableName, int pri = default_orch_pri);
 };
 
@@ -297,8 +482,25 @@ protected:
     virtual bool addOperation(const Request& request)=0;
     virtual bool delOperation(const Request& request)=0;
 
+    /*
+     * Bulk support: addOperation() or delOperation() may queue the SAI objects
+     * of a request and return deferOperation(). The task then stays in m_toSync
+     * until flushOperations(), which doTask() calls once all the tasks were
+     * seen, and which the orch calls itself before a request that depends on
+     * the queued ones.
+     * doBulkOperations() applies the queued objects and returns, for each
+     * deferred request in order, whether its task is done.
+     */
+    bool deferOperation();
+    void flushOperations();
+    virtual std::vector<bool> doBulkOperations() { return {}; }
+
 private:
     Request& request_;
+
+    Consumer *m_bulkConsumer = nullptr;
+    bool m_deferCurrent = false;
+    std::vector<SyncMap::iterator> m_deferredTasks;
 };
 
 #endif /* SWSS_ORCH_H */
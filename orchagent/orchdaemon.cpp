@@ -1,7 +1,10 @@
 #include <unistd.h>
 #include <unordered_map>
+#include <algorithm>
 #include <chrono>
+#include <set>
 #include <limits.h>
+#include <inttypes.h>
 #include "orchdaemon.h"
 #include "logger.h"
 #include <sairedis.h>
@@ -25,6 +28,12 @@ using namespace swss;
 /* orchagent heart beat message interval */
 #define HEART_BEAT_INTERVAL_MSECS 10 * 1000
 
+/* Consumer statistics, published when enabled by orchagent -p */
+#define STATE_CONSUMER_STATS_TABLE_NAME "CONSUMER_STATS_TABLE"
+/* sairedis pipeline flush statistics */
+#define STATE_FLUSH_STATS_TABLE_NAME "FLUSH_STATS_TABLE"
+#define STATS_INTERVAL_MSECS 10 * 1000
+
 extern sai_switch_api_t*           sai_switch_api;
 extern sai_object_id_t             gSwitchId;
 extern string                      gMySwitchType;
@@ -71,22 +80,40 @@ event_handle_t g_events_handle;
 #define DEFAULT_MAX_BULK_SIZE 1000
 size_t gMaxBulkSize = DEFAULT_MAX_BULK_SIZE;
 
+#define DEFAULT_FLUSH_THRESHOLD 1000
+#define DEFAULT_FLUSH_MAX_AGE_MSECS 5
+size_t gFlushThreshold = DEFAULT_FLUSH_THRESHOLD;
+unsigned int gFlushMaxAgeMsecs = DEFAULT_FLUSH_MAX_AGE_MSECS;
+
 OrchDaemon::OrchDaemon(DBConnector *applDb, DBConnector *configDb, DBConnector *stateDb, DBConnector *chassisAppDb, ZmqServer *zmqServer) :
         m_applDb(applDb),
         m_configDb(configDb),
         m_stateDb(stateDb),
         m_chassisAppDb(chassisAppDb),
-        m_zmqServer(zmqServer)
+        m_zmqServer(zmqServer),
+        m_flushPolicy(gFlushThreshold, std::chrono::milliseconds(gFlushMaxAgeMsecs))
 {
     SWSS_LOG_ENTER();
     m_select = new Select();
     m_lastHeartBeat = std::chrono::high_resolution_clock::now();
+    m_lastStats = m_lastHeartBeat;
+
+    if (m_stateDb)
+    {
+        m_flushStatsTable.reset(new Table(m_stateDb, STATE_FLUSH_STATS_TABLE_NAME));
+        if (gConsumerStatsEnabled)
+        {
+            m_consumerStatsTable.reset(new Table(m_stateDb, STATE_CONSUMER_STATS_TABLE_NAME));
+        }
+    }
 }
 
 OrchDaemon::~OrchDaemon()
 {
     SWSS_LOG_ENTER();
 
+    stopOrchGroups();
+
     /*
      * Some orchagents call other agents in their destructor.
      * To avoid accessing deleted agent, do deletion in reverse order.
@@ -196,6 +223,7 @@ bool OrchDaemon::init()
     gDirectory.set(chassis_frontend_orch);
 
     gIntfsOrch = new IntfsOrch(m_applDb, APP_INTF_TABLE_NAME, vrf_orch, m_chassisAppDb);
+    gPortsOrch->attach(gIntfsOrch);
     gNeighOrch = new NeighOrch(m_applDb, APP_NEIGH_TABLE_NAME, gIntfsOrch, gFdbOrch, gPortsOrch, m_chassisAppDb);
 
     const int fgnhgorch_pri = 15;
@@ -250,11 +278,14 @@ bool OrchDaemon::init()
     NvgreTunnelMapOrch *nvgre_tunnel_map_orch = new NvgreTunnelMapOrch(m_configDb, CFG_NVGRE_TUNNEL_MAP_TABLE_NAME);
     gDirectory.set(nvgre_tunnel_map_orch);
 
+    /* The dash group runs alongside the main group, it must not share the m_applDb context */
+    m_dashApplDb.reset(new DBConnector("APPL_DB", 0));
+
 	vector<string> dash_vnet_tables = {
         APP_DASH_VNET_TABLE_NAME,
         APP_DASH_VNET_MAPPING_TABLE_NAME
     };
-    DashVnetOrch *dash_vnet_orch = new DashVnetOrch(m_applDb, dash_vnet_tables, m_zmqServer);
+    DashVnetOrch *dash_vnet_orch = new DashVnetOrch(m_dashApplDb.get(), dash_vnet_tables, m_zmqServer);
     gDirectory.set(dash_vnet_orch);
 
     vector<string> dash_tables = {
@@ -265,7 +296,7 @@ bool OrchDaemon::init()
         APP_DASH_QOS_TABLE_NAME
     };
 
-    DashOrch *dash_orch = new DashOrch(m_applDb, dash_tables, m_zmqServer);
+    DashOrch *dash_orch = new DashOrch(m_dashApplDb.get(), dash_tables, m_zmqServer);
     gDirectory.set(dash_orch);
 
     vector<string> dash_route_tables = {
@@ -274,7 +305,7 @@ bool OrchDaemon::init()
         APP_DASH_ROUTE_GROUP_TABLE_NAME
     };
 
-    DashRouteOrch *dash_route_orch = new DashRouteOrch(m_applDb, dash_route_tables, dash_orch, m_zmqServer);
+    DashRouteOrch *dash_route_orch = new DashRouteOrch(m_dashApplDb.get(), dash_route_tables, dash_orch, m_zmqServer);
     gDirectory.set(dash_route_orch);
 
     vector<string> dash_acl_tables = {
@@ -284,7 +315,7 @@ bool OrchDaemon::init()
         APP_DASH_ACL_GROUP_TABLE_NAME,
         APP_DASH_ACL_RULE_TABLE_NAME
     };
-    DashAclOrch *dash_acl_orch = new DashAclOrch(m_applDb, dash_acl_tables, dash_orch, m_zmqServer);
+    DashAclOrch *dash_acl_orch = new DashAclOrch(m_dashApplDb.get(), dash_acl_tables, dash_orch, m_zmqServer);
     gDirectory.set(dash_acl_orch);
 
     vector<string> qos_tables = {
@@ -781,10 +812,16 @@ bool OrchDaemon::init()
 }
 
 /* Flush redis through sairedis interface */
-void OrchDaemon::flush()
+void OrchDaemon::flush(FlushPolicy::Reason reason, const vector<Orch *> &orchs)
 {
     SWSS_LOG_ENTER();
 
+    {
+        lock_guard<mutex> lock(m_flushMutex);
+        m_flushPolicy.update(gPoppedTasks, FlushPolicy::Clock::now());
+        m_flushPolicy.flushed(reason);
+    }
+
     sai_attribute_t attr;
     attr.id = SAI_REDIS_SWITCH_ATTR_FLUSH;
     sai_status_t status = sai_switch_api->set_switch_attribute(gSwitchId, &attr);
@@ -794,12 +831,57 @@ void OrchDaemon::flush()
         handleSaiFailure(true);
     }
 
-    for (auto* orch: m_orchList)
+    for (auto* orch: orchs)
     {
         orch->flushResponses();
     }
 }
 
+void OrchDaemon::checkFlush(const vector<Orch *> &orchs)
+{
+    auto now = FlushPolicy::Clock::now();
+    FlushPolicy::Reason reason;
+    bool needFlush;
+
+    {
+        lock_guard<mutex> lock(m_flushMutex);
+        m_flushPolicy.update(gPoppedTasks, now);
+        needFlush = m_flushPolicy.check(now, reason);
+    }
+
+    if (needFlush)
+    {
+        flush(reason, orchs);
+    }
+}
+
+int OrchDaemon::selectTimeout(const vector<Orch *> &orchs, const vector<mutex *> &locks)
+{
+    {
+        GroupLock lock(locks);
+        if (hasBacklog(orchs))
+        {
+            return 0;
+        }
+    }
+
+    lock_guard<mutex> lock(m_flushMutex);
+    return m_flushPolicy.selectTimeout(FlushPolicy::Clock::now(), SELECT_TIMEOUT);
+}
+
+bool OrchDaemon::hasBacklog(const vector<Orch *> &orchs) const
+{
+    for (Orch *o : orchs)
+    {
+        if (o->hasBacklog())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /* Release the file handle so the log can be rotated */
 void OrchDaemon::logRotate() {
     SWSS_LOG_ENTER();
@@ -820,7 +902,9 @@ void OrchDaemon::start()
 
     Recorder::Instance().sairedis.setRotate(false);
 
-    for (Orch *o : m_orchList)
+    startOrchGroups();
+
+    for (Orch *o : m_mainOrchs)
     {
         m_select->addSelectables(o->getSelectables());
     }
@@ -832,7 +916,11 @@ void OrchDaemon::start()
         Selectable *s;
         int ret;
 
-        ret = m_select->select(&s, SELECT_TIMEOUT);
+        /*
+         * Wake up in time to flush the pending tasks at their max age, or
+         * right away to go on with the tasks left over the work budget.
+         */
+        ret = m_select->select(&s, selectTimeout(m_mainOrchs, m_mainLocks));
 
         auto tend = std::chrono::high_resolution_clock::now();
         heartBeat(tend);
@@ -843,23 +931,40 @@ void OrchDaemon::start()
         {
             tstart = std::chrono::high_resolution_clock::now();
 
-            flush();
+            /* Stats and responses of every group: stop them all meanwhile */
+            GroupLock allLock(m_allLocks);
+            publishStats(tend);
+            flush(FlushPolicy::FLUSH_REASON_PERIODIC, m_orchList);
         }
 
+        GroupLock lock(m_mainLocks);
+
         if (ret == Select::ERROR)
         {
             SWSS_LOG_NOTICE("Error: %s!\n", strerror(errno));
             continue;
         }
 
-        if (ret == Select::TIMEOUT)
+        bool backlog = hasBacklog(m_mainOrchs);
+
+        if (ret == Select::TIMEOUT && !backlog)
         {
             /* Let sairedis to flush all SAI function call to ASIC DB.
              * Normally the redis pipeline will flush when enough request
              * accumulated. Still it is possible that small amount of
              * requests live in it. When the daemon has nothing to do, it
              * is a good chance to flush the pipeline  */
-            flush();
+            FlushPolicy::Reason reason;
+            bool hitLimit;
+            {
+                lock_guard<mutex> flushLock(m_flushMutex);
+                hitLimit = m_flushPolicy.check(FlushPolicy::Clock::now(), reason);
+            }
+            if (!hitLimit)
+            {
+                reason = FlushPolicy::FLUSH_REASON_IDLE;
+            }
+            flush(reason, m_mainOrchs);
             continue;
         }
 
@@ -871,15 +976,27 @@ void OrchDaemon::start()
             logRotate();
         }
 
-        auto *c = (Executor *)s;
-        c->execute();
+        if (ret != Select::TIMEOUT)
+        {
+            auto *c = (Executor *)s;
+            c->execute();
+        }
 
-        /* After each iteration, periodically check all m_toSync map to
-         * execute all the remaining tasks that need to be retried. */
+        /* After each iteration, execute the remaining tasks that need to be
+         * retried. Only orchs with ready consumers are visited, in
+         * m_orchList order, so idle orchs cost a single check. */
+        for (Orch *o : m_mainOrchs)
+        {
+            if (o->hasReadyExecutors())
+            {
+                o->doTask();
+            }
+        }
 
-        /* TODO: Abstract Orch class to have a specific todo list */
-        for (Orch *o : m_orchList)
-            o->doTask();
+        /* Observers which batch their updates get them once per iteration */
+        Subject::notifyBatches();
+
+        checkFlush(m_mainOrchs);
 
         /*
          * Asked to check warm restart readiness.
@@ -888,6 +1005,10 @@ void OrchDaemon::start()
          */
         if (gSwitchOrch && gSwitchOrch->checkRestartReady())
         {
+            /* Check and freeze with every group stopped, kept across the freeze */
+            lock.unlock();
+            GroupLock allLock(m_allLocks);
+
             bool ret = warmRestartCheck();
             if (ret)
             {
@@ -909,7 +1030,7 @@ void OrchDaemon::start()
                     }
 
                     // Flush sairedis's redis pipeline
-                    flush();
+                    flush(FlushPolicy::FLUSH_REASON_WARM_RESTART, m_orchList);
 
                     SWSS_LOG_WARN("Orchagent is frozen for warm restart!");
                     freezeAndHeartBeat(UINT_MAX);
@@ -919,6 +1040,148 @@ void OrchDaemon::start()
     }
 }
 
+mutex *OrchDaemon::groupMutex(const string &name)
+{
+    auto &m = m_groupMutexes[name];
+    if (!m)
+    {
+        m.reset(new mutex());
+    }
+
+    return m.get();
+}
+
+/*
+ * Split m_orchList by execution group and start a thread running the
+ * Select loop of each group other than ORCH_GROUP_MAIN.
+ */
+void OrchDaemon::startOrchGroups()
+{
+    SWSS_LOG_ENTER();
+
+    /* Group name to the groups it runs with: itself and its dependencies */
+    map<string, set<string>> lockedGroups;
+
+    groupMutex(ORCH_GROUP_MAIN);
+    lockedGroups[ORCH_GROUP_MAIN].insert(ORCH_GROUP_MAIN);
+
+    for (Orch *o : m_orchList)
+    {
+        const string &name = o->getExecutionGroup();
+
+        groupMutex(name);
+        lockedGroups[name].insert(name);
+        for (const auto &dep : o->getGroupDependencies())
+        {
+            groupMutex(dep);
+            lockedGroups[name].insert(dep);
+        }
+
+        if (name == ORCH_GROUP_MAIN)
+        {
+            m_mainOrchs.push_back(o);
+            continue;
+        }
+
+        auto it = find_if(m_orchGroups.begin(), m_orchGroups.end(),
+                          [&name](const unique_ptr<OrchGroup> &g) { return g->name == name; });
+        if (it == m_orchGroups.end())
+        {
+            unique_ptr<OrchGroup> group(new OrchGroup());
+            group->name = name;
+            group->select.reset(new Select());
+            it = m_orchGroups.insert(m_orchGroups.end(), move(group));
+        }
+
+        (*it)->orchs.push_back(o);
+        (*it)->select->addSelectables(o->getSelectables());
+    }
+
+    /* Every lock vector follows the m_groupMutexes order */
+    for (const auto &it : m_groupMutexes)
+    {
+        m_allLocks.push_back(it.second.get());
+        if (lockedGroups[ORCH_GROUP_MAIN].count(it.first))
+        {
+            m_mainLocks.push_back(it.second.get());
+        }
+        for (auto &group : m_orchGroups)
+        {
+            if (lockedGroups[group->name].count(it.first))
+            {
+                group->locks.push_back(it.second.get());
+            }
+        }
+    }
+
+    for (auto &group : m_orchGroups)
+    {
+        SWSS_LOG_NOTICE("Starting execution group %s with %zu orchs, %zu locks",
+                        group->name.c_str(), group->orchs.size(), group->locks.size());
+        group->thread.reset(new thread(&OrchDaemon::runOrchGroup, this, group.get()));
+    }
+}
+
+void OrchDaemon::stopOrchGroups()
+{
+    SWSS_LOG_ENTER();
+
+    m_stopGroups = true;
+
+    for (auto &group : m_orchGroups)
+    {
+        if (group->thread && group->thread->joinable())
+        {
+            group->thread->join();
+        }
+    }
+}
+
+/*
+ * Select loop of an execution group. The group flushes the tasks it popped
+ * as the flush policy asks; periodic and idle flushes, heart beat, log rotate
+ * and warm restart checks are left to the main group.
+ */
+void OrchDaemon::runOrchGroup(OrchGroup *group)
+{
+    SWSS_LOG_ENTER();
+
+    while (!m_stopGroups)
+    {
+        Selectable *s;
+        int ret;
+
+        ret = group->select->select(&s, selectTimeout(group->orchs, group->locks));
+
+        if (ret == Select::ERROR)
+        {
+            SWSS_LOG_NOTICE("Error in execution group %s: %s!\n", group->name.c_str(), strerror(errno));
+            continue;
+        }
+
+        GroupLock lock(group->locks);
+
+        if (ret != Select::TIMEOUT)
+        {
+            auto *c = (Executor *)s;
+            c->execute();
+        }
+
+        /* Also retry on timeout: tasks may have been woken by another group */
+        for (Orch *o : group->orchs)
+        {
+            if (o->hasReadyExecutors())
+            {
+                o->doTask();
+            }
+        }
+
+        Subject::notifyBatches();
+
+        checkFlush(group->orchs);
+    }
+}
+
 /*
  * Try to perform orchagent state restore and dynamic states sync up if
  * warm start request is detected.
@@ -927,11 +1190,24 @@ bool OrchDaemon::warmRestoreAndSyncUp()
 {
     WarmStart::setWarmStartState("orchagent", WarmStart::INITIALIZED);
 
+    /* The warm input is processed in full by the passes below */
+    auto taskBudget = gConsumerTaskBudget;
+    auto usecBudget = gConsumerUsecBudget;
+    gConsumerTaskBudget = 0;
+    gConsumerUsecBudget = 0;
+
+    /* Time spent per table is logged by Orch::bake() */
+    auto tstart = std::chrono::steady_clock::now();
+
     for (Orch *o : m_orchList)
     {
         o->bake();
     }
 
+    auto tbaked = std::chrono::steady_clock::now();
+    SWSS_LOG_NOTICE("Orchagent warm input added in %" PRId64 " ms",
+            static_cast<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(tbaked - tstart).count()));
+
     /*
      * Three iterations are needed.
      *
@@ -956,6 +1232,8 @@ bool OrchDaemon::warmRestoreAndSyncUp()
 
             o->doTask();
         }
+
+        Subject::notifyBatches();
     }
 
     // MirrorOrch depends on everything else being settled before it can run,
@@ -964,6 +1242,13 @@ bool OrchDaemon::warmRestoreAndSyncUp()
     gMirrorOrch->doTask();
     gAclOrch->doTask();
 
+    gConsumerTaskBudget = taskBudget;
+    gConsumerUsecBudget = usecBudget;
+
+    SWSS_LOG_NOTICE("Orchagent warm input processed in %" PRId64 " ms",
+            static_cast<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - tbaked).count()));
+
     /*
      * At this point, all the pre-existing data should have been processed properly, and
      * orchagent should be in exact same state of pre-shutdown.
@@ -1002,6 +1287,16 @@ void OrchDaemon::getTaskToSync(vector<string> &ts)
     }
 }
 
+/*
+ * Get the statistics of the consumers of each orch, one line per consumer
+ */
+void OrchDaemon::getConsumerStats(vector<string> &ts)
+{
+    for (Orch *o : m_orchList)
+    {
+        o->dumpConsumerStats(ts);
+    }
+}
 
 /* Perform basic validation after start restore for warm start */
 bool OrchDaemon::warmRestoreValidation()
@@ -1048,6 +1343,15 @@ bool OrchDaemon::warmRestartCheck()
         {
             SWSS_LOG_NOTICE("    %s", s.c_str());
         }
+
+        /* The retry and park counts tell which consumers are stuck */
+        vector<string> stats;
+        getConsumerStats(stats);
+        SWSS_LOG_NOTICE("Consumer statistics: ");
+        for (auto &s : stats)
+        {
+            SWSS_LOG_NOTICE("    %s", s.c_str());
+        }
         if (!gSwitchOrch->skipPendingTaskCheck())
         {
             data = "NOT_READY";
@@ -1081,6 +1385,35 @@ void OrchDaemon::heartBeat(std::chrono::time_point<std::chrono::high_resolution_
     }
 }
 
+void OrchDaemon::publishStats(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent)
+{
+    auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(tcurrent - m_lastStats);
+    if (diff.count() < STATS_INTERVAL_MSECS)
+    {
+        return;
+    }
+
+    m_lastStats = tcurrent;
+
+    if (m_flushStatsTable)
+    {
+        vector<FieldValueTuple> fvs;
+        {
+            lock_guard<mutex> lock(m_flushMutex);
+            fvs = m_flushPolicy.toFieldValues();
+        }
+        m_flushStatsTable->set("sairedis", fvs);
+    }
+
+    if (m_consumerStatsTable)
+    {
+        for (Orch *o : m_orchList)
+        {
+            o->publishConsumerStats(*m_consumerStatsTable);
+        }
+    }
+}
+
 void OrchDaemon::freezeAndHeartBeat(unsigned int duration)
 {
     while (duration > 0)
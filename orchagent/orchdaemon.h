@@ -51,8 +51,15 @@
 #include "dash/dashorch.h"
 #include "dash/dashrouteorch.h"
 #include "dash/dashvnetorch.h"
+#include "flushpolicy.h"
 #include <sairedis.h>
 
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 using namespace swss;
 
 class OrchDaemon
@@ -65,6 +72,7 @@ public:
     void start();
     bool warmRestoreAndSyncUp();
     void getTaskToSync(vector<string> &ts);
+    void getConsumerStats(vector<string> &ts);
     bool warmRestoreValidation();
 
     bool warmRestartCheck();
@@ -90,16 +98,110 @@ private:
     DBConnector *m_chassisAppDb;
     ZmqServer *m_zmqServer;
 
+    /* APPL_DB connector of the dash group, which pops its tables alongside the main group */
+    std::unique_ptr<DBConnector> m_dashApplDb;
+
     bool m_fabricEnabled = false;
     bool m_fabricPortStatEnabled = true;
     bool m_fabricQueueStatEnabled = true;
 
     std::vector<Orch *> m_orchList;
     Select *m_select;
-    
+
+    /* Orchs of an execution group other than ORCH_GROUP_MAIN */
+    struct OrchGroup
+    {
+        std::string name;
+        std::vector<Orch *> orchs;
+        /* Locks of the group and of its dependencies, in lock order */
+        std::vector<std::mutex *> locks;
+        std::unique_ptr<Select> select;
+        std::unique_ptr<std::thread> thread;
+    };
+
+    /*
+     * Holds a set of group locks, taken in the order of the vector and
+     * released in the reverse order.
+     */
+    class GroupLock
+    {
+    public:
+        GroupLock(const std::vector<std::mutex *> &locks) : m_locks(locks)
+        {
+            for (auto *m : m_locks)
+            {
+                m->lock();
+            }
+            m_locked = true;
+        }
+
+        ~GroupLock()
+        {
+            unlock();
+        }
+
+        void unlock()
+        {
+            if (!m_locked)
+            {
+                return;
+            }
+
+            for (auto it = m_locks.rbegin(); it != m_locks.rend(); ++it)
+            {
+                (*it)->unlock();
+            }
+            m_locked = false;
+        }
+
+    private:
+        const std::vector<std::mutex *> &m_locks;
+        bool m_locked = false;
+    };
+
+    /* ORCH_GROUP_MAIN orchs, run by start() itself */
+    std::vector<Orch *> m_mainOrchs;
+    std::vector<std::unique_ptr<OrchGroup>> m_orchGroups;
+
+    /*
+     * One lock per execution group, held while the orchs of the group
+     * process their tasks. A group also takes the locks of the groups it
+     * depends on (Orch::setExecutionGroup), always in the order of this
+     * map, so groups which do not share orchs run in parallel and groups
+     * which do are serialized without lock order inversion.
+     */
+    std::map<std::string, std::unique_ptr<std::mutex>> m_groupMutexes;
+    /* Locks of ORCH_GROUP_MAIN and of every group, in lock order */
+    std::vector<std::mutex *> m_mainLocks;
+    std::vector<std::mutex *> m_allLocks;
+    std::atomic<bool> m_stopGroups{false};
+
     std::chrono::time_point<std::chrono::high_resolution_clock> m_lastHeartBeat;
 
-    void flush();
+    std::unique_ptr<Table> m_consumerStatsTable;
+    std::unique_ptr<Table> m_flushStatsTable;
+    std::chrono::time_point<std::chrono::high_resolution_clock> m_lastStats;
+
+    /* Shared by all the groups, guarded by m_flushMutex */
+    FlushPolicy m_flushPolicy;
+    std::mutex m_flushMutex;
+
+    /* Flush the sairedis pipeline, then the responses of the given orchs */
+    void flush(FlushPolicy::Reason reason, const std::vector<Orch *> &orchs);
+
+    /* Flush if the tasks popped since the last flush hit the policy limits */
+    void checkFlush(const std::vector<Orch *> &orchs);
+
+    /* Select timeout of a loop: 0 while its orchs have tasks over their budget */
+    int selectTimeout(const std::vector<Orch *> &orchs, const std::vector<std::mutex *> &locks);
+    bool hasBacklog(const std::vector<Orch *> &orchs) const;
+
+    void publishStats(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent);
+
+    std::mutex *groupMutex(const std::string &name);
+    void startOrchGroups();
+    void stopOrchGroups();
+    void runOrchGroup(OrchGroup *group);
 
     void heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent);
 
@@ -17,6 +17,7 @@
 #include <tuple>
 #include <sstream>
 #include <unordered_set>
+#include <array>
 
 #include <netinet/if_ether.h>
 #include "net/if.h"
@@ -33,6 +34,7 @@
 #include "switchorch.h"
 #include "stringutility.h"
 #include "subscriberstatetable.h"
+#include "bulker.h"
 
 #include "saitam.h"
 
@@ -58,6 +60,7 @@ extern SwitchOrch *gSwitchOrch;
 extern Directory<Orch*> gDirectory;
 extern sai_system_port_api_t *sai_system_port_api;
 extern string gMySwitchType;
+extern size_t gMaxBulkSize;
 extern int32_t gVoqMySwitchId;
 extern string gMyHostName;
 extern string gMyAsicName;
@@ -3404,6 +3407,7 @@ sai_status_t PortsOrch::removePort(sai_object_id_t port_id)
         SWSS_LOG_INFO("Removing cached information for queue %" PRIx64, queue_id);
         m_queueInfo.erase(queue_id);
     }
+    m_portQosObjects.erase(port_id);
 
     sai_status_t status = sai_port_api->remove_port(port_id);
     if (status != SAI_STATUS_SUCCESS)
@@ -3894,6 +3898,24 @@ void PortsOrch::doPortTask(Consumer &consumer)
                     }
                 }
 
+                // Bulk read of the QoS objects of the existing ports to initialize
+                std::vector<sai_object_id_t> portsToInitList;
+                for (const auto &cit : m_lanesAliasSpeedMap)
+                {
+                    auto lanes = m_portListLaneMap.find(cit.first);
+                    if (lanes == m_portListLaneMap.end())
+                    {
+                        continue;
+                    }
+
+                    auto port = m_portList.find(cit.second.key);
+                    if (port == m_portList.end() || port->second.m_port_id != lanes->second)
+                    {
+                        portsToInitList.push_back(lanes->second);
+                    }
+                }
+                bulkInitializePortQosObjects(portsToInitList);
+
                 // Port add comparison logic
                 for (auto it = m_lanesAliasSpeedMap.begin(); it != m_lanesAliasSpeedMap.end();)
                 {
@@ -3925,6 +3947,13 @@ void PortsOrch::doPortTask(Consumer &consumer)
                         SWSS_LOG_THROW("PortsOrch initialization failure");
                     }
 
+                    std::vector<sai_object_id_t> addedPortList;
+                    for (const auto &cit : portsToAddList)
+                    {
+                        addedPortList.push_back(m_portListLaneMap[cit.lanes.value]);
+                    }
+                    bulkInitializePortQosObjects(addedPortList);
+
                     for (const auto &cit : portsToAddList)
                     {
                         if (!initPort(cit))
@@ -4970,11 +4999,23 @@ void PortsOrch::doVlanMemberTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    /*
+     * Consecutive additions, or removals, are created or removed in bulk.
+     * The queued tasks are flushed when the operation changes so that the
+     * tasks are applied in order.
+     */
+    deque<VlanMemberBulkContext> toBulk;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
         auto &t = it->second;
 
+        if (!toBulk.empty() && toBulk.back().is_set != (kfvOp(t) == SET_COMMAND))
+        {
+            flushVlanMemberBulk(consumer, toBulk);
+        }
+
         string key = kfvKey(t);
 
         /* Ensure the key starts with "Vlan" otherwise ignore */
@@ -5049,27 +5090,23 @@ void PortsOrch::doVlanMemberTask(Consumer &consumer)
                 continue;
             }
 
-            if (addBridgePort(port) && addVlanMember(vlan, port, tagging_mode))
-                it = consumer.m_toSync.erase(it);
-            else
-                it++;
+            toBulk.emplace_back();
+            auto &ctx = toBulk.back();
+            ctx.is_set = true;
+            ctx.vlan_alias = vlan_alias;
+            ctx.port_alias = port_alias;
+            ctx.tagging_mode = tagging_mode;
+            ctx.task = it++;
         }
         else if (op == DEL_COMMAND)
         {
             if (vlan.m_members.find(port_alias) != vlan.m_members.end())
             {
-                if (removeVlanMember(vlan, port))
-                {
-                    if (m_portVlanMember[port.m_alias].empty())
-                    {
-                        removeBridgePort(port);
-                    }
-                    it = consumer.m_toSync.erase(it);
-                }
-                else
-                {
-                    it++;
-                }
+                toBulk.emplace_back();
+                auto &ctx = toBulk.back();
+                ctx.vlan_alias = vlan_alias;
+                ctx.port_alias = port_alias;
+                ctx.task = it++;
             }
             else
                 /* Cannot locate the VLAN */
@@ -5081,6 +5118,275 @@ void PortsOrch::doVlanMemberTask(Consumer &consumer)
             it = consumer.m_toSync.erase(it);
         }
     }
+
+    flushVlanMemberBulk(consumer, toBulk);
+}
+
+void PortsOrch::flushVlanMemberBulk(Consumer &consumer, deque<VlanMemberBulkContext> &toBulk)
+{
+    SWSS_LOG_ENTER();
+
+    if (toBulk.empty())
+    {
+        return;
+    }
+
+    if (toBulk.front().is_set)
+    {
+        addVlanMembers(consumer, toBulk);
+    }
+    else
+    {
+        removeVlanMembers(consumer, toBulk);
+    }
+
+    toBulk.clear();
+}
+
+/* The tasks which fail are left in m_toSync and retried */
+void PortsOrch::addVlanMembers(Consumer &consumer, deque<VlanMemberBulkContext> &toBulk)
+{
+    SWSS_LOG_ENTER();
+
+    addVlanMembers(toBulk);
+
+    for (const auto &ctx : toBulk)
+    {
+        if (ctx.done)
+        {
+            consumer.m_toSync.erase(ctx.task);
+        }
+    }
+}
+
+/*
+ * Create the bridge ports missing for the new members, then the members.
+ * ctx.done is set for the members which were added, and for the ones
+ * which failed and must not be retried.
+ */
+void PortsOrch::addVlanMembers(deque<VlanMemberBulkContext> &toBulk)
+{
+    SWSS_LOG_ENTER();
+
+    ObjectBulker<sai_bridge_api_t> bridgePortBulker(sai_bridge_api, gSwitchId, gMaxBulkSize);
+    ObjectBulker<sai_vlan_api_t> vlanMemberBulker(sai_vlan_api, gSwitchId, gMaxBulkSize);
+
+    /* One bridge port per port, however many VLANs it joins */
+    map<string, pair<sai_object_id_t, sai_status_t>> bridgePorts;
+    for (const auto &ctx : toBulk)
+    {
+        Port port;
+        if (!getPort(ctx.port_alias, port) || port.m_bridge_port_id != SAI_NULL_OBJECT_ID ||
+            bridgePorts.find(ctx.port_alias) != bridgePorts.end())
+        {
+            continue;
+        }
+
+        vector<sai_attribute_t> attrs;
+        if (!getBridgePortAttributes(port, attrs))
+        {
+            continue;
+        }
+
+        auto &bridgePort = bridgePorts[ctx.port_alias];
+        bridgePortBulker.create_entry(&bridgePort.first, &bridgePort.second, (uint32_t)attrs.size(), attrs.data());
+    }
+
+    bridgePortBulker.flush();
+
+    /* The members of the ports whose bridge port failed for good are dropped */
+    set<string> failedPorts;
+    for (const auto &bridgePort : bridgePorts)
+    {
+        sai_status_t status = bridgePort.second.second;
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to add bridge port %s to default 1Q bridge, rv:%d",
+                bridgePort.first.c_str(), status);
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_BRIDGE, status);
+            if (handle_status != task_success)
+            {
+                if (parseHandleSaiStatusFailure(handle_status))
+                {
+                    failedPorts.insert(bridgePort.first);
+                }
+                continue;
+            }
+        }
+
+        Port port;
+        getPort(bridgePort.first, port);
+        port.m_bridge_port_id = bridgePort.second.first;
+        addBridgePortPost(port);
+    }
+
+    for (auto &ctx : toBulk)
+    {
+        if (failedPorts.find(ctx.port_alias) != failedPorts.end())
+        {
+            ctx.done = true;
+            continue;
+        }
+
+        Port vlan, port;
+        if (!getPort(ctx.vlan_alias, vlan) || !getPort(ctx.port_alias, port) ||
+            port.m_bridge_port_id == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        vector<sai_attribute_t> attrs;
+        ctx.sai_tagging_mode = getVlanMemberAttributes(vlan, port, ctx.tagging_mode, attrs);
+        vlanMemberBulker.create_entry(&ctx.vlan_member_id, &ctx.status, (uint32_t)attrs.size(), attrs.data());
+        ctx.pending = true;
+    }
+
+    vlanMemberBulker.flush();
+
+    for (auto &ctx : toBulk)
+    {
+        if (!ctx.pending)
+        {
+            continue;
+        }
+
+        /* The VLAN and port are updated by each new member */
+        Port vlan, port;
+        getPort(ctx.vlan_alias, vlan);
+        getPort(ctx.port_alias, port);
+
+        if (ctx.status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to add member %s to VLAN %s vid:%hu pid:%" PRIx64,
+                    port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_VLAN, ctx.status);
+            if (handle_status != task_success)
+            {
+                /* Not retried, the task is dropped */
+                ctx.done = parseHandleSaiStatusFailure(handle_status);
+                continue;
+            }
+        }
+
+        ctx.done = addVlanMemberPost(vlan, port, ctx.vlan_member_id, ctx.sai_tagging_mode);
+    }
+}
+
+/*
+ * Remove the members, then the bridge ports of the ports which are no
+ * longer member of any VLAN.
+ */
+void PortsOrch::removeVlanMembers(Consumer &consumer, deque<VlanMemberBulkContext> &toBulk)
+{
+    SWSS_LOG_ENTER();
+
+    ObjectBulker<sai_vlan_api_t> vlanMemberBulker(sai_vlan_api, gSwitchId, gMaxBulkSize);
+    ObjectBulker<sai_bridge_api_t> bridgePortBulker(sai_bridge_api, gSwitchId, gMaxBulkSize);
+
+    for (auto &ctx : toBulk)
+    {
+        Port vlan, port;
+        if (!getPort(ctx.vlan_alias, vlan) || !getPort(ctx.port_alias, port))
+        {
+            continue;
+        }
+
+        auto members = m_portVlanMember.find(ctx.port_alias);
+        if (members == m_portVlanMember.end())
+        {
+            continue;
+        }
+
+        auto vlan_member = members->second.find(vlan.m_vlan_info.vlan_id);
+        if (vlan_member == members->second.end())
+        {
+            continue;
+        }
+
+        ctx.vlan_member_id = vlan_member->second.vlan_member_id;
+        vlanMemberBulker.remove_entry(&ctx.status, ctx.vlan_member_id);
+        ctx.pending = true;
+    }
+
+    vlanMemberBulker.flush();
+
+    set<string> leftPorts;
+    for (auto &ctx : toBulk)
+    {
+        if (!ctx.pending)
+        {
+            continue;
+        }
+
+        Port vlan, port;
+        getPort(ctx.vlan_alias, vlan);
+        getPort(ctx.port_alias, port);
+
+        if (ctx.status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove member %s from VLAN %s vid:%hx vmid:%" PRIx64,
+                    port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, ctx.vlan_member_id);
+            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_VLAN, ctx.status);
+            if (handle_status != task_success)
+            {
+                if (parseHandleSaiStatusFailure(handle_status))
+                {
+                    consumer.m_toSync.erase(ctx.task);
+                }
+                continue;
+            }
+        }
+
+        if (!removeVlanMemberPost(vlan, port))
+        {
+            continue;
+        }
+
+        if (m_portVlanMember.find(port.m_alias) == m_portVlanMember.end())
+        {
+            leftPorts.insert(port.m_alias);
+        }
+        consumer.m_toSync.erase(ctx.task);
+    }
+
+    map<string, sai_status_t> bridgePorts;
+    for (const auto &alias : leftPorts)
+    {
+        Port port;
+        if (!getPort(alias, port) || port.m_bridge_port_id == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        if (!disableBridgePort(port))
+        {
+            continue;
+        }
+
+        bridgePortBulker.remove_entry(&bridgePorts[alias], port.m_bridge_port_id);
+    }
+
+    bridgePortBulker.flush();
+
+    for (const auto &bridgePort : bridgePorts)
+    {
+        Port port;
+        getPort(bridgePort.first, port);
+
+        if (bridgePort.second != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove bridge port %s from default 1Q bridge, rv:%d",
+                port.m_alias.c_str(), bridgePort.second);
+            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_BRIDGE, bridgePort.second);
+            if (handle_status != task_success)
+            {
+                parseHandleSaiStatusFailure(handle_status);
+                continue;
+            }
+        }
+
+        removeBridgePortPost(port);
+    }
 }
 
 void PortsOrch::doTransceiverPresenceCheck(Consumer &consumer)
@@ -5588,10 +5894,236 @@ void PortsOrch::doTask(Consumer &consumer)
     }
 }
 
+void PortsOrch::bulkInitializeQueueInfo(const vector<sai_object_id_t> &queue_ids)
+{
+    SWSS_LOG_ENTER();
+
+    ObjectBulker<sai_queue_api_t> queueBulker(sai_queue_api, gSwitchId, gMaxBulkSize);
+
+    vector<sai_object_id_t> oids;
+    for (auto queue_id : queue_ids)
+    {
+        if (queue_id != SAI_NULL_OBJECT_ID && m_queueInfo.find(queue_id) == m_queueInfo.end())
+        {
+            oids.push_back(queue_id);
+        }
+    }
+
+    if (oids.empty())
+    {
+        return;
+    }
+
+    vector<array<sai_attribute_t, 2>> attrs(oids.size());
+    vector<sai_status_t> statuses(oids.size());
+
+    for (size_t i = 0; i < oids.size(); i++)
+    {
+        attrs[i][0].id = SAI_QUEUE_ATTR_TYPE;
+        attrs[i][1].id = SAI_QUEUE_ATTR_INDEX;
+        queueBulker.get_entry_attribute(&statuses[i], oids[i], 2, attrs[i].data());
+    }
+    queueBulker.flush();
+
+    for (size_t i = 0; i < oids.size(); i++)
+    {
+        /* Queues which failed are read again on demand by getQueueTypeAndIndex() */
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Failed to get queue type and index for queue %" PRIx64 " in bulk rv:%d", oids[i], statuses[i]);
+            continue;
+        }
+
+        m_queueInfo[oids[i]].type = static_cast<sai_queue_type_t>(attrs[i][0].value.s32);
+        m_queueInfo[oids[i]].index = attrs[i][1].value.u8;
+    }
+
+    SWSS_LOG_INFO("Cached type and index of %zu queues", oids.size());
+}
+
+void PortsOrch::bulkInitializePortQosObjects(const vector<sai_object_id_t> &port_ids)
+{
+    SWSS_LOG_ENTER();
+
+    if (port_ids.empty() || gMySwitchType == "dpu")
+    {
+        return;
+    }
+
+    ObjectBulker<sai_port_api_t> portBulker(sai_port_api, gSwitchId, gMaxBulkSize);
+
+    /* Read the number of queues, priority groups and scheduler groups of all ports */
+    vector<array<sai_attribute_t, 3>> counts(port_ids.size());
+    vector<sai_status_t> statuses(port_ids.size());
+
+    for (size_t i = 0; i < port_ids.size(); i++)
+    {
+        counts[i][0].id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
+        counts[i][1].id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
+        counts[i][2].id = SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS;
+        portBulker.get_entry_attribute(&statuses[i], port_ids[i], 3, counts[i].data());
+    }
+    portBulker.flush();
+
+    /* Then the object lists, sized from the counts */
+    vector<vector<sai_attribute_t>> lists(port_ids.size());
+
+    for (size_t i = 0; i < port_ids.size(); i++)
+    {
+        /* Ports which failed are initialized one by one, which handles the error */
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Failed to get QoS object numbers of port %" PRIx64 " in bulk rv:%d", port_ids[i], statuses[i]);
+            continue;
+        }
+
+        auto &qos = m_portQosObjects[port_ids[i]];
+        qos.queue_ids.resize(counts[i][0].value.u32);
+        qos.priority_group_ids.resize(counts[i][1].value.u32);
+        qos.scheduler_group_ids.resize(counts[i][2].value.u32);
+
+        sai_attribute_t attr;
+        auto &attrList = lists[i];
+
+        if (!qos.queue_ids.empty())
+        {
+            attr.id = SAI_PORT_ATTR_QOS_QUEUE_LIST;
+            attr.value.objlist.count = (uint32_t)qos.queue_ids.size();
+            attr.value.objlist.list = qos.queue_ids.data();
+            attrList.push_back(attr);
+        }
+
+        if (!qos.priority_group_ids.empty())
+        {
+            attr.id = SAI_PORT_ATTR_INGRESS_PRIORITY_GROUP_LIST;
+            attr.value.objlist.count = (uint32_t)qos.priority_group_ids.size();
+            attr.value.objlist.list = qos.priority_group_ids.data();
+            attrList.push_back(attr);
+        }
+
+        if (!qos.scheduler_group_ids.empty())
+        {
+            attr.id = SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST;
+            attr.value.objlist.count = (uint32_t)qos.scheduler_group_ids.size();
+            attr.value.objlist.list = qos.scheduler_group_ids.data();
+            attrList.push_back(attr);
+        }
+
+        if (!attrList.empty())
+        {
+            portBulker.get_entry_attribute(&statuses[i], port_ids[i], (uint32_t)attrList.size(), attrList.data());
+        }
+    }
+    portBulker.flush();
+
+    vector<sai_object_id_t> queue_ids;
+
+    for (size_t i = 0; i < port_ids.size(); i++)
+    {
+        auto qos = m_portQosObjects.find(port_ids[i]);
+        if (qos == m_portQosObjects.end())
+        {
+            continue;
+        }
+
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Failed to get QoS object lists of port %" PRIx64 " in bulk rv:%d", port_ids[i], statuses[i]);
+            m_portQosObjects.erase(qos);
+            continue;
+        }
+
+        queue_ids.insert(queue_ids.end(), qos->second.queue_ids.begin(), qos->second.queue_ids.end());
+    }
+
+    bulkInitializeQueueInfo(queue_ids);
+
+    SWSS_LOG_NOTICE("Read QoS objects of %zu ports in bulk", m_portQosObjects.size());
+}
+
+void PortsOrch::bulkInitializeVoqs(const vector<sai_object_id_t> &system_port_ids)
+{
+    SWSS_LOG_ENTER();
+
+    if (system_port_ids.empty())
+    {
+        return;
+    }
+
+    ObjectBulker<sai_system_port_api_t> systemPortBulker(sai_system_port_api, gSwitchId, gMaxBulkSize);
+
+    vector<sai_attribute_t> attrs(system_port_ids.size());
+    vector<sai_status_t> statuses(system_port_ids.size());
+
+    for (size_t i = 0; i < system_port_ids.size(); i++)
+    {
+        attrs[i].id = SAI_SYSTEM_PORT_ATTR_QOS_NUMBER_OF_VOQS;
+        systemPortBulker.get_entry_attribute(&statuses[i], system_port_ids[i], 1, &attrs[i]);
+    }
+    systemPortBulker.flush();
+
+    for (size_t i = 0; i < system_port_ids.size(); i++)
+    {
+        /* System ports which failed are initialized one by one, which handles the error */
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Failed to get number of voqs of system port %" PRIx64 " in bulk rv:%d", system_port_ids[i], statuses[i]);
+            continue;
+        }
+
+        auto &voq_ids = m_systemPortVoqs[system_port_ids[i]];
+        voq_ids.resize(attrs[i].value.u32);
+
+        if (voq_ids.empty())
+        {
+            continue;
+        }
+
+        attrs[i].id = SAI_SYSTEM_PORT_ATTR_QOS_VOQ_LIST;
+        attrs[i].value.objlist.count = (uint32_t)voq_ids.size();
+        attrs[i].value.objlist.list = voq_ids.data();
+        systemPortBulker.get_entry_attribute(&statuses[i], system_port_ids[i], 1, &attrs[i]);
+    }
+    systemPortBulker.flush();
+
+    vector<sai_object_id_t> voq_ids;
+
+    for (size_t i = 0; i < system_port_ids.size(); i++)
+    {
+        auto voqs = m_systemPortVoqs.find(system_port_ids[i]);
+        if (voqs == m_systemPortVoqs.end())
+        {
+            continue;
+        }
+
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Failed to get voq list of system port %" PRIx64 " in bulk rv:%d", system_port_ids[i], statuses[i]);
+            m_systemPortVoqs.erase(voqs);
+            continue;
+        }
+
+        voq_ids.insert(voq_ids.end(), voqs->second.begin(), voqs->second.end());
+    }
+
+    bulkInitializeQueueInfo(voq_ids);
+
+    SWSS_LOG_NOTICE("Read voqs of %zu system ports in bulk", m_systemPortVoqs.size());
+}
+
 void PortsOrch::initializeVoqs(Port &port)
 {
     SWSS_LOG_ENTER();
 
+    auto voqs = m_systemPortVoqs.find(port.m_system_port_oid);
+    if (voqs != m_systemPortVoqs.end())
+    {
+        SWSS_LOG_INFO("Got %zu voqs for port %s in bulk", voqs->second.size(), port.m_alias.c_str());
+        m_port_voq_ids[port.m_alias] = std::move(voqs->second);
+        m_systemPortVoqs.erase(voqs);
+        return;
+    }
+
     sai_attribute_t attr;
     attr.id = SAI_SYSTEM_PORT_ATTR_QOS_NUMBER_OF_VOQS;
     sai_status_t status = sai_system_port_api->get_system_port_attribute(
@@ -5637,6 +6169,15 @@ void PortsOrch::initializeQueues(Port &port)
 {
     SWSS_LOG_ENTER();
 
+    auto qos = m_portQosObjects.find(port.m_port_id);
+    if (qos != m_portQosObjects.end())
+    {
+        SWSS_LOG_INFO("Got %zu queues for port %s in bulk", qos->second.queue_ids.size(), port.m_alias.c_str());
+        port.m_queue_ids = qos->second.queue_ids;
+        port.m_queue_lock.resize(port.m_queue_ids.size());
+        return;
+    }
+
     sai_attribute_t attr;
     attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
     sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
@@ -5682,6 +6223,13 @@ void PortsOrch::initializeSchedulerGroups(Port &port)
     std::vector<sai_object_id_t> scheduler_group_ids;
     SWSS_LOG_ENTER();
 
+    auto qos = m_portQosObjects.find(port.m_port_id);
+    if (qos != m_portQosObjects.end())
+    {
+        SWSS_LOG_INFO("Got %zu scheduler groups for port %s in bulk", qos->second.scheduler_group_ids.size(), port.m_alias.c_str());
+        return;
+    }
+
     sai_attribute_t attr;
     attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS;
     sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
@@ -5725,6 +6273,14 @@ void PortsOrch::initializePriorityGroups(Port &port)
 {
     SWSS_LOG_ENTER();
 
+    auto qos = m_portQosObjects.find(port.m_port_id);
+    if (qos != m_portQosObjects.end())
+    {
+        SWSS_LOG_INFO("Got %zu priority groups for port %s in bulk", qos->second.priority_group_ids.size(), port.m_alias.c_str());
+        port.m_priority_group_ids = qos->second.priority_group_ids;
+        return;
+    }
+
     sai_attribute_t attr;
     attr.id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
     sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
@@ -5799,6 +6355,9 @@ bool PortsOrch::initializePort(Port &port)
         initializeQueues(port);
         initializeSchedulerGroups(port);
         initializePortBufferMaximumParameters(port);
+
+        /* The QoS objects read in bulk are now owned by the port */
+        m_portQosObjects.erase(port.m_port_id);
     }
 
     /* Create host interface */
@@ -6061,6 +6620,31 @@ bool PortsOrch::addBridgePort(Port &port)
         return true;
     }
 
+    vector<sai_attribute_t> attrs;
+    if (!getBridgePortAttributes(port, attrs))
+    {
+        return false;
+    }
+
+    sai_status_t status = sai_bridge_api->create_bridge_port(&port.m_bridge_port_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to add bridge port %s to default 1Q bridge, rv:%d",
+            port.m_alias.c_str(), status);
+        task_process_status handle_status = handleSaiCreateStatus(SAI_API_BRIDGE, status);
+        if (handle_status != task_success)
+        {
+            return parseHandleSaiStatusFailure(handle_status);
+        }
+    }
+
+    return addBridgePortPost(port);
+}
+
+bool PortsOrch::getBridgePortAttributes(const Port &port, vector<sai_attribute_t> &attrs)
+{
+    SWSS_LOG_ENTER();
+
     if (port.m_rif_id != 0)
     {
         SWSS_LOG_NOTICE("Cannot create bridge port, interface %s is a router port", port.m_alias.c_str());
@@ -6068,7 +6652,6 @@ bool PortsOrch::addBridgePort(Port &port)
     }
 
     sai_attribute_t attr;
-    vector<sai_attribute_t> attrs;
 
     if (port.m_type == Port::PHY)
     {
@@ -6121,17 +6704,13 @@ bool PortsOrch::addBridgePort(Port &port)
     attr.value.s32 = port.m_learn_mode;
     attrs.push_back(attr);
 
-    sai_status_t status = sai_bridge_api->create_bridge_port(&port.m_bridge_port_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to add bridge port %s to default 1Q bridge, rv:%d",
-            port.m_alias.c_str(), status);
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_BRIDGE, status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
+    return true;
+}
+
+/* Bookkeeping once the bridge port of the port is created */
+bool PortsOrch::addBridgePortPost(Port &port)
+{
+    SWSS_LOG_ENTER();
 
     if (!setHostIntfsStripTag(port, SAI_HOSTIF_VLAN_TAG_KEEP))
     {
@@ -6157,6 +6736,34 @@ bool PortsOrch::removeBridgePort(Port &port)
     {
         return true;
     }
+
+    if (!disableBridgePort(port))
+    {
+        return false;
+    }
+
+    /* Remove bridge port */
+    sai_status_t status = sai_bridge_api->remove_bridge_port(port.m_bridge_port_id);
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to remove bridge port %s from default 1Q bridge, rv:%d",
+            port.m_alias.c_str(), status);
+        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_BRIDGE, status);
+        if (handle_status != task_success)
+        {
+            return parseHandleSaiStatusFailure(handle_status);
+        }
+    }
+
+    removeBridgePortPost(port);
+    return true;
+}
+
+/* Set the bridge port down and flush its FDB entries before it is removed */
+bool PortsOrch::disableBridgePort(Port &port)
+{
+    SWSS_LOG_ENTER();
+
     /* Set bridge port admin status to DOWN */
     sai_attribute_t attr;
     attr.id = SAI_BRIDGE_PORT_ATTR_ADMIN_STATE;
@@ -6185,18 +6792,14 @@ bool PortsOrch::removeBridgePort(Port &port)
     gFdbOrch->flushFDBEntries(port.m_bridge_port_id, SAI_NULL_OBJECT_ID);
     SWSS_LOG_INFO("Flush FDB entries for port %s", port.m_alias.c_str());
 
-    /* Remove bridge port */
-    status = sai_bridge_api->remove_bridge_port(port.m_bridge_port_id);
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to remove bridge port %s from default 1Q bridge, rv:%d",
-            port.m_alias.c_str(), status);
-        task_process_status handle_status = handleSaiRemoveStatus(SAI_API_BRIDGE, status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
+    return true;
+}
+
+/* Bookkeeping once the bridge port of the port is removed */
+void PortsOrch::removeBridgePortPost(Port &port)
+{
+    SWSS_LOG_ENTER();
+
     saiOidToAlias.erase(port.m_bridge_port_id);
     port.m_bridge_port_id = SAI_NULL_OBJECT_ID;
 
@@ -6207,7 +6810,6 @@ bool PortsOrch::removeBridgePort(Port &port)
     SWSS_LOG_NOTICE("Remove bridge port %s from default 1Q bridge", port.m_alias.c_str());
 
     m_portList[port.m_alias] = port;
-    return true;
 }
 
 bool PortsOrch::setBridgePortLearnMode(Port &port, sai_bridge_port_fdb_learning_mode_t learn_mode)
@@ -6380,8 +6982,29 @@ bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, stri
         return addVlanFloodGroups(vlan, port, end_point_ip);
     }
 
-    sai_attribute_t attr;
     vector<sai_attribute_t> attrs;
+    sai_vlan_tagging_mode_t sai_tagging_mode = getVlanMemberAttributes(vlan, port, tagging_mode, attrs);
+
+    sai_object_id_t vlan_member_id;
+    sai_status_t status = sai_vlan_api->create_vlan_member(&vlan_member_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to add member %s to VLAN %s vid:%hu pid:%" PRIx64,
+                port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
+        task_process_status handle_status = handleSaiCreateStatus(SAI_API_VLAN, status);
+        if (handle_status != task_success)
+        {
+            return parseHandleSaiStatusFailure(handle_status);
+        }
+    }
+
+    return addVlanMemberPost(vlan, port, vlan_member_id, sai_tagging_mode);
+}
+
+sai_vlan_tagging_mode_t PortsOrch::getVlanMemberAttributes(const Port &vlan, const Port &port,
+        const string &tagging_mode, vector<sai_attribute_t> &attrs)
+{
+    sai_attribute_t attr;
 
     attr.id = SAI_VLAN_MEMBER_ATTR_VLAN_ID;
     attr.value.oid = vlan.m_vlan_info.vlan_oid;
@@ -6404,18 +7027,14 @@ bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, stri
     attr.value.s32 = sai_tagging_mode;
     attrs.push_back(attr);
 
-    sai_object_id_t vlan_member_id;
-    sai_status_t status = sai_vlan_api->create_vlan_member(&vlan_member_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to add member %s to VLAN %s vid:%hu pid:%" PRIx64,
-                port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_VLAN, status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
+    return sai_tagging_mode;
+}
+
+/* Bookkeeping once the VLAN member is created */
+bool PortsOrch::addVlanMemberPost(Port &vlan, Port &port, sai_object_id_t vlan_member_id, sai_vlan_tagging_mode_t sai_tagging_mode)
+{
+    SWSS_LOG_ENTER();
+
     SWSS_LOG_NOTICE("Add member %s to VLAN %s vid:%hu pid%" PRIx64,
             port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
 
@@ -6727,12 +7346,10 @@ bool PortsOrch::removeVlanMember(Port &vlan, Port &port, string end_point_ip)
         return removeVlanEndPointIp(vlan, port, end_point_ip);
     }
     sai_object_id_t vlan_member_id;
-    sai_vlan_tagging_mode_t sai_tagging_mode;
     auto vlan_member = m_portVlanMember[port.m_alias].find(vlan.m_vlan_info.vlan_id);
 
     /* Assert the port belongs to this VLAN */
     assert (vlan_member != m_portVlanMember[port.m_alias].end());
-    sai_tagging_mode = vlan_member->second.vlan_mode;
     vlan_member_id = vlan_member->second.vlan_member_id;
 
     sai_status_t status = sai_vlan_api->remove_vlan_member(vlan_member_id);
@@ -6746,6 +7363,20 @@ bool PortsOrch::removeVlanMember(Port &vlan, Port &port, string end_point_ip)
             return parseHandleSaiStatusFailure(handle_status);
         }
     }
+
+    return removeVlanMemberPost(vlan, port);
+}
+
+/* Bookkeeping once the VLAN member is removed */
+bool PortsOrch::removeVlanMemberPost(Port &vlan, Port &port)
+{
+    SWSS_LOG_ENTER();
+
+    auto vlan_member = m_portVlanMember[port.m_alias].find(vlan.m_vlan_info.vlan_id);
+    assert (vlan_member != m_portVlanMember[port.m_alias].end());
+    sai_vlan_tagging_mode_t sai_tagging_mode = vlan_member->second.vlan_mode;
+    sai_object_id_t vlan_member_id = vlan_member->second.vlan_member_id;
+
     m_portVlanMember[port.m_alias].erase(vlan_member);
     if (m_portVlanMember[port.m_alias].empty())
     {
@@ -8157,7 +8788,7 @@ void PortsOrch::updatePortOperStatus(Port &port, sai_port_oper_status_t status)
 
 
     PortOperStateUpdate update = {port, status};
-    notify(SUBJECT_TYPE_PORT_OPER_STATE_CHANGE, static_cast<void *>(&update));
+    notify(SUBJECT_TYPE_PORT_OPER_STATE_CHANGE, update, port.m_alias);
 }
 
 void PortsOrch::updateDbPortOperSpeed(Port &port, sai_uint32_t speed)
@@ -9097,6 +9728,14 @@ bool PortsOrch::addSystemPorts()
     DBConnector appDb(APPL_DB, DBConnector::DEFAULT_UNIXSOCKET, 0);
     Table appSystemPortTable(&appDb, APP_SYSTEM_PORT_TABLE_NAME);
 
+    //Read the voqs of all the system ports of the switch in bulk
+    vector<sai_object_id_t> system_port_ids;
+    for (const auto &sp : m_systemPortOidMap)
+    {
+        system_port_ids.push_back(sp.second);
+    }
+    bulkInitializeVoqs(system_port_ids);
+
     //Retrieve system port configurations from APP DB
     appSystemPortTable.getKeys(keys);
     for ( auto &alias : keys )
@@ -9238,6 +9877,9 @@ bool PortsOrch::addSystemPorts()
         }
     }
 
+    //Drop the voqs of the system ports which are not configured
+    m_systemPortVoqs.clear();
+
     return true;
 }
 
@@ -1,6 +1,7 @@
 #ifndef SWSS_PORTSORCH_H
 #define SWSS_PORTSORCH_H
 
+#include <deque>
 #include <map>
 #include <unordered_set>
 
@@ -105,6 +106,22 @@ struct VlanMemberUpdate
     bool add;
 };
 
+/* VLAN member task queued by doVlanMemberTask, created or removed in bulk */
+struct VlanMemberBulkContext
+{
+    bool is_set = false;
+    string vlan_alias;
+    string port_alias;
+    string tagging_mode;
+    SyncMap::iterator task;
+
+    bool pending = false;               // Queued in the VLAN member bulker
+    sai_vlan_tagging_mode_t sai_tagging_mode = SAI_VLAN_TAGGING_MODE_UNTAGGED;
+    sai_object_id_t vlan_member_id = SAI_NULL_OBJECT_ID;
+    sai_status_t status = SAI_STATUS_NOT_EXECUTED;
+    bool done = false;                  // Created and recorded in the VLAN
+};
+
 struct queueInfo
 {
     // SAI_QUEUE_ATTR_TYPE
@@ -213,6 +230,7 @@ public:
     bool addBridgePort(Port &port);
     bool removeBridgePort(Port &port);
     bool addVlanMember(Port &vlan, Port &port, string& tagging_mode, string end_point_ip = "");
+    void addVlanMembers(deque<VlanMemberBulkContext> &toBulk);
     bool removeVlanMember(Port &vlan, Port &port, string end_point_ip = "");
     bool isVlanMember(Port &vlan, Port &port, string end_point_ip = "");
     bool addVlanFloodGroups(Port &vlan, Port &port, string end_point_ip);
@@ -354,6 +372,9 @@ private:
     void doSendToIngressPortTask(Consumer &consumer);
     void doVlanTask(Consumer &consumer);
     void doVlanMemberTask(Consumer &consumer);
+    void flushVlanMemberBulk(Consumer &consumer, deque<VlanMemberBulkContext> &toBulk);
+    void addVlanMembers(Consumer &consumer, deque<VlanMemberBulkContext> &toBulk);
+    void removeVlanMembers(Consumer &consumer, deque<VlanMemberBulkContext> &toBulk);
     void doLagTask(Consumer &consumer);
     void doLagMemberTask(Consumer &consumer);
     void doTransceiverPresenceCheck(Consumer &consumer);
@@ -372,12 +393,23 @@ private:
     void initializeQueues(Port &port);
     void initializeSchedulerGroups(Port &port);
     void initializeVoqs(Port &port);
+    void bulkInitializePortQosObjects(const vector<sai_object_id_t> &port_ids);
+    void bulkInitializeVoqs(const vector<sai_object_id_t> &system_port_ids);
+    void bulkInitializeQueueInfo(const vector<sai_object_id_t> &queue_ids);
 
     bool addHostIntfs(Port &port, string alias, sai_object_id_t &host_intfs_id);
     bool setHostIntfsStripTag(Port &port, sai_hostif_vlan_tag_t strip);
 
     bool setBridgePortLearnMode(Port &port, sai_bridge_port_fdb_learning_mode_t learn_mode);
 
+    bool getBridgePortAttributes(const Port &port, vector<sai_attribute_t> &attrs);
+    bool addBridgePortPost(Port &port);
+    bool disableBridgePort(Port &port);
+    void removeBridgePortPost(Port &port);
+    sai_vlan_tagging_mode_t getVlanMemberAttributes(const Port &vlan, const Port &port, const string &tagging_mode, vector<sai_attribute_t> &attrs);
+    bool addVlanMemberPost(Port &vlan, Port &port, sai_object_id_t vlan_member_id, sai_vlan_tagging_mode_t sai_tagging_mode);
+    bool removeVlanMemberPost(Port &vlan, Port &port);
+
     bool addVlan(string vlan);
     bool removeVlan(Port vlan);
 
@@ -522,6 +554,19 @@ private:
     std::unordered_set<std::string> generateCounterStats(const string& type, bool gearbox = false);
     map<sai_object_id_t, struct queueInfo> m_queueInfo;
 
+    /*
+     * QoS objects read in bulk ahead of the port initialization, by port and
+     * system port oid. Entries are consumed by initializePort/initializeVoqs.
+     */
+    struct PortQosObjects
+    {
+        vector<sai_object_id_t> queue_ids;
+        vector<sai_object_id_t> priority_group_ids;
+        vector<sai_object_id_t> scheduler_group_ids;
+    };
+    map<sai_object_id_t, PortQosObjects> m_portQosObjects;
+    map<sai_object_id_t, vector<sai_object_id_t>> m_systemPortVoqs;
+
     /* Protoypes for Path tracing */
     bool setPortPtTam(const Port& port, sai_object_id_t tam_id);
 
@@ -0,0 +1,13 @@
+-- KEYS - full names of the table keys to read
+-- ARGV - None
+
+-- return the fields and values of each key, in the order of KEYS, as
+-- returned by HGETALL: an empty list for a key which was removed
+
+local result = {}
+
+for i = 1, #KEYS do
+    result[i] = redis.call('HGETALL', KEYS[i])
+end
+
+return result
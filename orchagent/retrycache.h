@@ -0,0 +1,180 @@
+#ifndef SWSS_RETRYCACHE_H
+#define SWSS_RETRYCACHE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "table.h"
+
+/*
+ * Objects a pending task can wait on. The constraint name is the
+ * object name as used by the orch which creates the object.
+ */
+enum ConstraintType
+{
+    RETRY_CST_DUMMY,            // No constraint
+    RETRY_CST_NEIGH,            // Neighbor "<ip>@<alias>"
+    RETRY_CST_PORT,             // Port "<alias>"
+    RETRY_CST_NHG,              // Next hop group "<index>"
+    RETRY_CST_MIRROR_SESSION    // Mirror session "<name>"
+};
+
+typedef std::pair<ConstraintType, std::string> Constraint;
+
+const Constraint DUMMY_CONSTRAINT = { RETRY_CST_DUMMY, "" };
+
+struct ConstraintHash
+{
+    size_t operator()(const Constraint &cst) const
+    {
+        return std::hash<std::string>()(cst.second) ^ (static_cast<size_t>(cst.first) << 1);
+    }
+};
+
+struct RetryCounters
+{
+    uint64_t retried = 0;   // Tasks left in m_toSync after a drain
+    uint64_t parked = 0;    // Tasks parked until their constraint is resolved
+    uint64_t woken = 0;     // Parked tasks moved back to m_toSync
+};
+
+/*
+ * RetryCache holds the tasks of a consumer which cannot be processed
+ * until another object shows up. Parked tasks are not retried on each
+ * drain; they go back to m_toSync when their constraint is resolved, or
+ * when a newer task for the same key arrives.
+ */
+class RetryCache
+{
+public:
+    bool empty() const
+    {
+        return m_parked.empty();
+    }
+
+    size_t size() const
+    {
+        return m_taskCount;
+    }
+
+    /* Park the tasks of a key, in order, until the constraint is resolved */
+    void insert(const std::string &key, const Constraint &cst, std::vector<swss::KeyOpFieldsValuesTuple> &&tasks)
+    {
+        auto &parked = m_parked[key];
+
+        if (!parked.tasks.empty() && parked.constraint != cst)
+        {
+            eraseWaiting(key, parked.constraint);
+        }
+
+        parked.constraint = cst;
+        m_taskCount += tasks.size();
+        for (auto &task : tasks)
+        {
+            parked.tasks.emplace_back(std::move(task));
+        }
+
+        m_waiting[cst].insert(key);
+    }
+
+    /* Take back all the tasks parked for a key */
+    bool evict(const std::string &key, std::vector<swss::KeyOpFieldsValuesTuple> &tasks)
+    {
+        auto it = m_parked.find(key);
+        if (it == m_parked.end())
+        {
+            return false;
+        }
+
+        eraseWaiting(key, it->second.constraint);
+        takeTasks(it->second, tasks);
+        m_parked.erase(it);
+
+        return true;
+    }
+
+    /* Take back the tasks of all the keys waiting on the constraint */
+    size_t resolve(const Constraint &cst, std::vector<swss::KeyOpFieldsValuesTuple> &tasks)
+    {
+        auto waiting = m_waiting.find(cst);
+        if (waiting == m_waiting.end())
+        {
+            return 0;
+        }
+
+        size_t count = 0;
+        for (const auto &key : waiting->second)
+        {
+            auto it = m_parked.find(key);
+            if (it == m_parked.end())
+            {
+                continue;
+            }
+
+            count += it->second.tasks.size();
+            takeTasks(it->second, tasks);
+            m_parked.erase(it);
+        }
+        m_waiting.erase(waiting);
+
+        return count;
+    }
+
+    template <typename F>
+    void forEach(F &&f) const
+    {
+        for (const auto &it : m_parked)
+        {
+            for (const auto &task : it.second.tasks)
+            {
+                f(it.second.constraint, task);
+            }
+        }
+    }
+
+private:
+    struct ParkedTasks
+    {
+        Constraint constraint;
+        std::vector<swss::KeyOpFieldsValuesTuple> tasks;
+    };
+
+    // Key -> tasks parked for the key
+    std::unordered_map<std::string, ParkedTasks> m_parked;
+
+    // Constraint -> keys waiting on it
+    std::unordered_map<Constraint, std::unordered_set<std::string>, ConstraintHash> m_waiting;
+
+    size_t m_taskCount = 0;
+
+    void eraseWaiting(const std::string &key, const Constraint &cst)
+    {
+        auto waiting = m_waiting.find(cst);
+        if (waiting == m_waiting.end())
+        {
+            return;
+        }
+
+        waiting->second.erase(key);
+        if (waiting->second.empty())
+        {
+            m_waiting.erase(waiting);
+        }
+    }
+
+    void takeTasks(ParkedTasks &parked, std::vector<swss::KeyOpFieldsValuesTuple> &tasks)
+    {
+        m_taskCount -= parked.tasks.size();
+        for (auto &task : parked.tasks)
+        {
+            tasks.emplace_back(std::move(task));
+        }
+        parked.tasks.clear();
+    }
+};
+
+#endif /* SWSS_RETRYCACHE_H */
@@ -88,6 +88,9 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
 
     SWSS_LOG_NOTICE("Maximum number of ECMP groups supported is %d", m_maxNextHopGroupCount);
 
+    /* Routes waiting for a neighbor are woken up on neighbor changes */
+    m_neighOrch->attach(this);
+
     m_stateDb = shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
     m_stateDefaultRouteTb = unique_ptr<swss::Table>(new Table(m_stateDb.get(), STATE_ROUTE_TABLE_NAME));
 
@@ -842,7 +845,7 @@ void RouteOrch::doTask(Consumer& consumer)
                     catch (const std::out_of_range& e)
                     {
                         SWSS_LOG_ERROR("Next hop group %s does not exist", nhg_index.c_str());
-                        ++it;
+                        it = consumer.parkTask(it, make_pair(RETRY_CST_NHG, nhg_index));
                         continue;
                     }
                 }
@@ -887,6 +890,8 @@ void RouteOrch::doTask(Consumer& consumer)
                     {
                         if (addRoute(ctx, nhg))
                             it = consumer.m_toSync.erase(it);
+                        else if (ctx.retry_cst != DUMMY_CONSTRAINT)
+                            it = consumer.parkTask(it, ctx.retry_cst);
                         else
                             it++;
                     }
@@ -904,6 +909,8 @@ void RouteOrch::doTask(Consumer& consumer)
                 {
                     if (addRoute(ctx, nhg))
                         it = consumer.m_toSync.erase(it);
+                    else if (ctx.retry_cst != DUMMY_CONSTRAINT)
+                        it = consumer.parkTask(it, ctx.retry_cst);
                     else
                         it++;
                 }
@@ -1041,6 +1048,30 @@ void RouteOrch::doTask(Consumer& consumer)
     }
 }
 
+void RouteOrch::update(SubjectType type, void *cntx)
+{
+    SWSS_LOG_ENTER();
+
+    if (type != SUBJECT_TYPE_NEIGH_CHANGE)
+    {
+        return;
+    }
+
+    NeighborUpdate *update = static_cast<NeighborUpdate *>(cntx);
+    if (!update->add)
+    {
+        return;
+    }
+
+    /* Wake the routes parked until this neighbor is resolved */
+    const auto &entry = update->entry;
+    size_t woken = resolveConstraint(make_pair(RETRY_CST_NEIGH, entry.ip_address.to_string() + NH_DELIMITER + entry.alias));
+    if (woken > 0)
+    {
+        SWSS_LOG_INFO("Neighbor %s resolved, %zu route task(s) to retry", entry.to_string().c_str(), woken);
+    }
+}
+
 void RouteOrch::notifyNextHopChangeObservers(sai_object_id_t vrf_id, const IpPrefix &prefix, const NextHopGroupKey &nexthops, bool add)
 {
     SWSS_LOG_ENTER();
@@ -1843,6 +1874,7 @@ bool RouteOrch::addRoute(RouteBulkContext& ctx, const NextHopGroupKey &nextHops)
                     SWSS_LOG_INFO("Failed to get next hop %s for %s, resolving neighbor",
                             nextHops.to_string().c_str(), ipPrefix.to_string().c_str());
                     m_neighOrch->resolveNeighbor(nexthop);
+                    ctx.retry_cst = make_pair(RETRY_CST_NEIGH, nexthop.ip_address.to_string() + NH_DELIMITER + nexthop.alias);
                     return false;
                 }
             }
@@ -122,13 +122,15 @@ struct RouteBulkContext
     bool                                excp_intfs_flag;
     // using_temp_nhg will track if the NhgOrch's owned NHG is temporary or not
     bool                                using_temp_nhg;
+    // Object the route waits on when it can't be added yet
+    Constraint                          retry_cst;
 
     std::string                         key;       // Key in database table
     std::string                         protocol;  // Protocol string
     bool                                is_set;    // True if set operation
 
     RouteBulkContext(const std::string& key, bool is_set)
-        : key(key), excp_intfs_flag(false), using_temp_nhg(false), is_set(is_set)
+        : key(key), excp_intfs_flag(false), using_temp_nhg(false), retry_cst(DUMMY_CONSTRAINT), is_set(is_set)
     {
     }
 
@@ -144,6 +146,7 @@ struct RouteBulkContext
         excp_intfs_flag = false;
         vrf_id = SAI_NULL_OBJECT_ID;
         using_temp_nhg = false;
+        retry_cst = DUMMY_CONSTRAINT;
         key.clear();
         protocol.clear();
     }
@@ -181,11 +184,13 @@ struct LabelRouteBulkContext
     }
 };
 
-class RouteOrch : public Orch, public Subject
+class RouteOrch : public Orch, public Subject, public Observer
 {
 public:
     RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames, SwitchOrch *switchOrch, NeighOrch *neighOrch, IntfsOrch *intfsOrch, VRFOrch *vrfOrch, FgNhgOrch *fgNhgOrch, Srv6Orch *srv6Orch);
 
+    void update(SubjectType type, void *cntx);
+
     bool hasNextHopGroup(const NextHopGroupKey&) const;
     sai_object_id_t getNextHopGroupId(const NextHopGroupKey&);
 
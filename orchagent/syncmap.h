@@ -0,0 +1,513 @@
+#ifndef SWSS_SYNCMAP_H
+#define SWSS_SYNCMAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "table.h"
+
+/*
+ * SyncMap is the pending task store of a consumer (m_toSync).
+ *
+ * It keeps the subset of the std::multimap interface used by the orchs,
+ * with these properties:
+ * - Entries are kept in insertion order, and the entries of one key are
+ *   always adjacent, in the order they were added (e.g. DEL then SET).
+ * - Keys are looked up through an open addressing hash index which points
+ *   to the first entry of each key.
+ * - Entries live in nodes of a doubly linked list allocated from a pool,
+ *   so iterators stay valid until their own entry is erased.
+ */
+class SyncMap
+{
+public:
+    typedef std::string key_type;
+    typedef swss::KeyOpFieldsValuesTuple mapped_type;
+    typedef std::pair<const std::string, swss::KeyOpFieldsValuesTuple> value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+private:
+    struct NodeBase
+    {
+        NodeBase *prev;
+        NodeBase *next;
+    };
+
+    struct Node : public NodeBase
+    {
+        template <typename... Args>
+        Node(size_t h, Args&&... args)
+            : value(std::forward<Args>(args)...), hash(h)
+        {
+        }
+
+        value_type value;
+        size_t hash;
+    };
+
+    /* Fixed size node allocator, chunks grow geometrically */
+    class NodePool
+    {
+    public:
+        NodePool() = default;
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+
+        void *allocate()
+        {
+            if (m_free == nullptr)
+            {
+                grow();
+            }
+
+            Slot *slot = m_free;
+            m_free = slot->next;
+            return slot;
+        }
+
+        void deallocate(void *p)
+        {
+            Slot *slot = static_cast<Slot *>(p);
+            slot->next = m_free;
+            m_free = slot;
+        }
+
+        void swap(NodePool &other)
+        {
+            m_chunks.swap(other.m_chunks);
+            std::swap(m_free, other.m_free);
+            std::swap(m_chunkSize, other.m_chunkSize);
+        }
+
+        /* Give back all the chunks but the first one, no node may be in use */
+        void release()
+        {
+            if (m_chunks.size() <= 1)
+            {
+                return;
+            }
+
+            m_chunks.resize(1);
+            m_free = nullptr;
+            thread(m_chunks.front().get(), MIN_CHUNK_SIZE);
+            m_chunkSize = MIN_CHUNK_SIZE * 2;
+        }
+
+    private:
+        enum
+        {
+            MIN_CHUNK_SIZE = 64,
+            MAX_CHUNK_SIZE = 4096
+        };
+
+        union Slot
+        {
+            Slot *next;
+            typename std::aligned_storage<sizeof(Node), alignof(Node)>::type storage;
+        };
+
+        std::vector<std::unique_ptr<Slot[]>> m_chunks;
+        Slot *m_free = nullptr;
+        size_t m_chunkSize = MIN_CHUNK_SIZE;
+
+        void grow()
+        {
+            Slot *chunk = new Slot[m_chunkSize];
+            m_chunks.emplace_back(chunk);
+            thread(chunk, m_chunkSize);
+
+            if (m_chunkSize < MAX_CHUNK_SIZE)
+            {
+                m_chunkSize *= 2;
+            }
+        }
+
+        void thread(Slot *chunk, size_t count)
+        {
+            for (size_t i = count; i > 0; i--)
+            {
+                chunk[i - 1].next = m_free;
+                m_free = &chunk[i - 1];
+            }
+        }
+    };
+
+    template <bool IsConst>
+    class Iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef SyncMap::value_type value_type;
+        typedef SyncMap::difference_type difference_type;
+        typedef typename std::conditional<IsConst, const value_type*, value_type*>::type pointer;
+        typedef typename std::conditional<IsConst, const value_type&, value_type&>::type reference;
+
+        Iterator() : m_node(nullptr) {}
+
+        // iterator converts to const_iterator
+        template <bool C = IsConst, typename = typename std::enable_if<C>::type>
+        Iterator(const Iterator<false> &other) : m_node(other.m_node) {}
+
+        reference operator*() const { return static_cast<Node *>(m_node)->value; }
+        pointer operator->() const { return &static_cast<Node *>(m_node)->value; }
+
+        Iterator& operator++() { m_node = m_node->next; return *this; }
+        Iterator operator++(int) { Iterator tmp = *this; m_node = m_node->next; return tmp; }
+        Iterator& operator--() { m_node = m_node->prev; return *this; }
+        Iterator operator--(int) { Iterator tmp = *this; m_node = m_node->prev; return tmp; }
+
+        bool operator==(const Iterator &other) const { return m_node == other.m_node; }
+        bool operator!=(const Iterator &other) const { return m_node != other.m_node; }
+
+    private:
+        friend class SyncMap;
+        friend class Iterator<true>;
+
+        explicit Iterator(NodeBase *node) : m_node(node) {}
+
+        NodeBase *m_node;
+    };
+
+public:
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    SyncMap()
+    {
+        m_head.prev = &m_head;
+        m_head.next = &m_head;
+    }
+
+    ~SyncMap()
+    {
+        destroyNodes();
+    }
+
+    SyncMap(const SyncMap&) = delete;
+    SyncMap& operator=(const SyncMap&) = delete;
+
+    iterator begin() { return iterator(m_head.next); }
+    iterator end() { return iterator(&m_head); }
+    const_iterator begin() const { return const_iterator(m_head.next); }
+    const_iterator end() const { return const_iterator(const_cast<NodeBase *>(&m_head)); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    void clear()
+    {
+        destroyNodes();
+        m_head.prev = &m_head;
+        m_head.next = &m_head;
+        m_size = 0;
+        m_keys = 0;
+        std::fill(m_index.begin(), m_index.end(), nullptr);
+        releaseMemory();
+    }
+
+    /* Exchange the entries, iterators stay valid and follow their entry */
+    void swap(SyncMap &other)
+    {
+        std::swap(m_head, other.m_head);
+        std::swap(m_size, other.m_size);
+        m_index.swap(other.m_index);
+        std::swap(m_keys, other.m_keys);
+        m_pool.swap(other.m_pool);
+
+        relinkHead();
+        other.relinkHead();
+    }
+
+    iterator find(const std::string &key)
+    {
+        size_t pos = 0;
+        Node *node = lookup(key, std::hash<std::string>()(key), pos);
+        return node ? iterator(node) : end();
+    }
+
+    const_iterator find(const std::string &key) const
+    {
+        return const_cast<SyncMap *>(this)->find(key);
+    }
+
+    size_t count(const std::string &key) const
+    {
+        size_t n = 0;
+        for (auto it = find(key); it != end() && it->first == key; ++it)
+        {
+            n++;
+        }
+        return n;
+    }
+
+    std::pair<iterator, iterator> equal_range(const std::string &key)
+    {
+        auto first = find(key);
+        auto last = first;
+        while (last != end() && last->first == key)
+        {
+            ++last;
+        }
+        return std::make_pair(first, last);
+    }
+
+    /* Add an entry after the existing entries of the same key */
+    template <typename... Args>
+    iterator emplace(const std::string &key, Args&&... args)
+    {
+        size_t hash = std::hash<std::string>()(key);
+        size_t pos = 0;
+        Node *first = lookup(key, hash, pos);
+
+        NodeBase *before = &m_head;
+        if (first != nullptr)
+        {
+            NodeBase *last = first;
+            while (last->next != &m_head && static_cast<Node *>(last->next)->value.first == key)
+            {
+                last = last->next;
+            }
+            before = last->next;
+        }
+
+        Node *node = new (m_pool.allocate()) Node(hash, std::piecewise_construct,
+                std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+        link(node, before);
+        m_size++;
+
+        if (first == nullptr)
+        {
+            indexInsert(node);
+        }
+
+        return iterator(node);
+    }
+
+    iterator erase(const_iterator it)
+    {
+        Node *node = static_cast<Node *>(it.m_node);
+        NodeBase *next = node->next;
+
+        size_t pos = 0;
+        Node *first = lookup(node->value.first, node->hash, pos);
+        if (first == node)
+        {
+            // Let the index point to the next entry of the key, if any
+            if (next != &m_head && static_cast<Node *>(next)->value.first == node->value.first)
+            {
+                m_index[pos] = static_cast<Node *>(next);
+            }
+            else
+            {
+                indexErase(pos);
+            }
+        }
+
+        unlink(node);
+        node->~Node();
+        m_pool.deallocate(node);
+
+        if (--m_size == 0)
+        {
+            releaseMemory();
+        }
+
+        return iterator(next);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        while (first != last)
+        {
+            first = erase(first);
+        }
+        return iterator(last.m_node);
+    }
+
+    size_t erase(const std::string &key)
+    {
+        size_t n = 0;
+        auto it = find(key);
+        while (it != end() && it->first == key)
+        {
+            it = erase(it);
+            n++;
+        }
+        return n;
+    }
+
+private:
+    enum
+    {
+        MIN_INDEX_SIZE = 16,
+        RELEASE_INDEX_SIZE = 1024
+    };
+
+    NodeBase m_head;
+    size_t m_size = 0;
+
+    // Hash index of the first entry of each key, linear probing
+    std::vector<Node *> m_index;
+    size_t m_keys = 0;
+
+    NodePool m_pool;
+
+    static void link(Node *node, NodeBase *before)
+    {
+        node->next = before;
+        node->prev = before->prev;
+        before->prev->next = node;
+        before->prev = node;
+    }
+
+    static void unlink(Node *node)
+    {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    /* Point the first and last nodes back to m_head, after a swap */
+    void relinkHead()
+    {
+        if (m_size == 0)
+        {
+            m_head.prev = &m_head;
+            m_head.next = &m_head;
+            return;
+        }
+
+        m_head.next->prev = &m_head;
+        m_head.prev->next = &m_head;
+    }
+
+    void destroyNodes()
+    {
+        NodeBase *n = m_head.next;
+        while (n != &m_head)
+        {
+            Node *node = static_cast<Node *>(n);
+            n = n->next;
+            node->~Node();
+            m_pool.deallocate(node);
+        }
+    }
+
+    /* Nothing is pending: give back the memory of a past burst */
+    void releaseMemory()
+    {
+        m_pool.release();
+        if (m_index.size() > RELEASE_INDEX_SIZE)
+        {
+            std::vector<Node *>().swap(m_index);
+        }
+    }
+
+    Node *lookup(const std::string &key, size_t hash, size_t &pos) const
+    {
+        if (m_index.empty())
+        {
+            return nullptr;
+        }
+
+        size_t mask = m_index.size() - 1;
+        for (pos = hash & mask; m_index[pos] != nullptr; pos = (pos + 1) & mask)
+        {
+            Node *node = m_index[pos];
+            if (node->hash == hash && node->value.first == key)
+            {
+                return node;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void indexInsert(Node *node)
+    {
+        if ((m_keys + 1) * 4 > m_index.size() * 3)
+        {
+            rehash(m_index.empty() ? MIN_INDEX_SIZE : m_index.size() * 2);
+        }
+
+        size_t mask = m_index.size() - 1;
+        size_t pos = node->hash & mask;
+        while (m_index[pos] != nullptr)
+        {
+            pos = (pos + 1) & mask;
+        }
+
+        m_index[pos] = node;
+        m_keys++;
+    }
+
+    /* Backward shift deletion keeps the probe sequences intact */
+    void indexErase(size_t pos)
+    {
+        size_t mask = m_index.size() - 1;
+        size_t next = pos;
+
+        while (true)
+        {
+            next = (next + 1) & mask;
+            if (m_index[next] == nullptr)
+            {
+                break;
+            }
+
+            size_t home = m_index[next]->hash & mask;
+            bool stays = (pos <= next) ? (pos < home && home <= next) : (pos < home || home <= next);
+            if (stays)
+            {
+                continue;
+            }
+
+            m_index[pos] = m_index[next];
+            pos = next;
+        }
+
+        m_index[pos] = nullptr;
+        m_keys--;
+    }
+
+    void rehash(size_t size)
+    {
+        std::vector<Node *> index(size, nullptr);
+        size_t mask = size - 1;
+
+        for (Node *node : m_index)
+        {
+            if (node == nullptr)
+            {
+                continue;
+            }
+
+            size_t pos = node->hash & mask;
+            while (index[pos] != nullptr)
+            {
+                pos = (pos + 1) & mask;
+            }
+            index[pos] = node;
+        }
+
+        m_index.swap(index);
+    }
+};
+
+#endif /* SWSS_SYNCMAP_H */
@@ -20,6 +20,7 @@ extern "C" {
 #include "sai_serialize.h"
 #include "flex_counter_manager.h"
 #include "converter.h"
+#include "bulker.h"
 
 /* Global variables */
 extern sai_object_id_t gSwitchId;
@@ -29,6 +30,7 @@ extern sai_next_hop_api_t *sai_next_hop_api;
 extern Directory<Orch*> gDirectory;
 extern PortsOrch*       gPortsOrch;
 extern sai_object_id_t  gUnderlayIfId;
+extern size_t gMaxBulkSize;
 extern FlexManagerDirectory g_FlexManagerDirectory;
 extern bool gTraditionalFlexCounter;
 
@@ -161,7 +163,8 @@ remove_tunnel_map(sai_object_id_t tunnel_map_id)
     }
 }
 
-static sai_object_id_t create_tunnel_map_entry(
+static void get_tunnel_map_entry_attrs(
+    std::vector<sai_attribute_t>& tunnel_map_entry_attrs,
     MAP_T map_t,
     sai_object_id_t tunnel_map_id,
     sai_uint32_t vni,
@@ -171,8 +174,6 @@ static sai_object_id_t create_tunnel_map_entry(
     )
 {
     sai_attribute_t attr;
-    sai_object_id_t tunnel_map_entry_id;
-    std::vector<sai_attribute_t> tunnel_map_entry_attrs;
 
     attr.id = SAI_TUNNEL_MAP_ENTRY_ATTR_TUNNEL_MAP_TYPE;
     attr.value.s32 = tunnel_map_type(map_t);
@@ -197,6 +198,21 @@ static sai_object_id_t create_tunnel_map_entry(
     attr.id = (encap)? tunnel_map_val(map_t):tunnel_map_key(map_t);
     attr.value.u32 = vni;
     tunnel_map_entry_attrs.push_back(attr);
+}
+
+static sai_object_id_t create_tunnel_map_entry(
+    MAP_T map_t,
+    sai_object_id_t tunnel_map_id,
+    sai_uint32_t vni,
+    sai_uint16_t vlan_id,
+    sai_object_id_t obj_id=SAI_NULL_OBJECT_ID,
+    bool encap=false
+    )
+{
+    sai_object_id_t tunnel_map_entry_id;
+    std::vector<sai_attribute_t> tunnel_map_entry_attrs;
+
+    get_tunnel_map_entry_attrs(tunnel_map_entry_attrs, map_t, tunnel_map_id, vni, vlan_id, obj_id, encap);
 
     sai_status_t status = sai_tunnel_api->create_tunnel_map_entry(&tunnel_map_entry_id, gSwitchId,
                                             static_cast<uint32_t> (tunnel_map_entry_attrs.size()),
@@ -1905,6 +1921,12 @@ bool VxlanTunnelMapOrch::addOperation(const Request& request)
 {
     SWSS_LOG_ENTER();
 
+    // The removals queued before apply first, they may remove the tunnel
+    if (!bulk_contexts_.empty() && !bulk_contexts_.back().is_add)
+    {
+        flushOperations();
+    }
+
     sai_vlan_id_t vlan_id = (sai_vlan_id_t)request.getAttrVlan("vlan");
     Port tempPort;
     bool isL3Vni = false;
@@ -1982,32 +2004,55 @@ bool VxlanTunnelMapOrch::addOperation(const Request& request)
     VRFOrch* vrf_orch = gDirectory.get<VRFOrch*>();
     isL3Vni = vrf_orch->isL3VniVlan(vni_id);
 
-    try
+    VxlanTunnelMapBulkContext ctx;
+    ctx.is_add = true;
+    ctx.tunnel_name = tunnel_name;
+    ctx.tunnel_map_entry_name = tunnel_map_entry_name;
+    ctx.full_tunnel_map_entry_name = full_tunnel_map_entry_name;
+    ctx.vlan_id = vlan_id;
+    ctx.vni_id = vni_id;
+
+    // The VNI of a VRF is mapped by VxlanVrfMapOrch, no entry for the VLAN
+    if (isL3Vni)
     {
-        if (isL3Vni == false)
-        {
-            auto tunnel_map_entry_id = create_tunnel_map_entry(MAP_T::VNI_TO_VLAN_ID,
-                                                               tunnel_map_id, vni_id, vlan_id);
-            vxlan_tunnel_map_table_[full_tunnel_map_entry_name].map_entry_id = tunnel_map_entry_id;
-        }
-        else
-        {
-            vxlan_tunnel_map_table_[full_tunnel_map_entry_name].map_entry_id = SAI_NULL_OBJECT_ID;
-        }
-        vxlan_tunnel_map_table_[full_tunnel_map_entry_name].vlan_id = vlan_id;
-        vxlan_tunnel_map_table_[full_tunnel_map_entry_name].vni_id = vni_id;
+        ctx.status = SAI_STATUS_SUCCESS;
+        return addOperationPost(ctx);
     }
-    catch(const std::runtime_error& error)
+
+    get_tunnel_map_entry_attrs(ctx.attrs, MAP_T::VNI_TO_VLAN_ID, tunnel_map_id, vni_id, vlan_id);
+    bulk_contexts_.push_back(std::move(ctx));
+
+    return deferOperation();
+}
+
+bool VxlanTunnelMapOrch::addOperationPost(const VxlanTunnelMapBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+
+    if (ctx.status != SAI_STATUS_SUCCESS)
     {
-        SWSS_LOG_WARN("Error adding tunnel map entry. Tunnel: %s. Entry: %s. Error: %s",
-            tunnel_name.c_str(), tunnel_map_entry_name.c_str(), error.what());
+        SWSS_LOG_WARN("Error adding tunnel map entry. Tunnel: %s. Entry: %s. Status: %d",
+            ctx.tunnel_name.c_str(), ctx.tunnel_map_entry_name.c_str(), ctx.status);
+
+        // The request is retried and counts the VNI again
+        if (tunnel_orch->isTunnelExists(ctx.tunnel_name))
+        {
+            tunnel_orch->getVxlanTunnel(ctx.tunnel_name)->vlan_vrf_vni_count--;
+        }
         return false;
     }
 
-    tunnel_orch->addVlanMappedToVni(vni_id, vlan_id);
+    auto& entry = vxlan_tunnel_map_table_[ctx.full_tunnel_map_entry_name];
+    entry.map_entry_id = ctx.map_entry_id;
+    entry.vlan_id = ctx.vlan_id;
+    entry.vni_id = ctx.vni_id;
+
+    tunnel_orch->addVlanMappedToVni(ctx.vni_id, ctx.vlan_id);
 
     SWSS_LOG_NOTICE("Vxlan tunnel map entry '%s' for tunnel '%s' was created",
-                   tunnel_map_entry_name.c_str(), tunnel_name.c_str());
+                   ctx.tunnel_map_entry_name.c_str(), ctx.tunnel_name.c_str());
 
     return true;
 }
@@ -2016,11 +2061,16 @@ bool VxlanTunnelMapOrch::delOperation(const Request& request)
 {
     SWSS_LOG_ENTER();
 
+    // The additions queued before apply first, they may create the tunnel
+    if (!bulk_contexts_.empty() && bulk_contexts_.back().is_add)
+    {
+        flushOperations();
+    }
+
     Port vlanPort;
     const auto& tunnel_name = request.getKeyString(0);
     const auto& tunnel_map_entry_name = request.getKeyString(1);
     const auto& full_tunnel_map_entry_name = request.getFullKey();
-    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
 
     if (!isTunnelMapExists(full_tunnel_map_entry_name))
     {
@@ -2037,14 +2087,32 @@ bool VxlanTunnelMapOrch::delOperation(const Request& request)
 
     vlanPort.m_vnid = (uint32_t) VNID_NONE;
 
-    auto tunnel_map_entry_id = vxlan_tunnel_map_table_[full_tunnel_map_entry_name].map_entry_id;
-    try
-    {
-        remove_tunnel_map_entry(tunnel_map_entry_id);
-    }
-    catch (const std::runtime_error& error)
+    VxlanTunnelMapBulkContext ctx;
+    ctx.is_add = false;
+    ctx.tunnel_name = tunnel_name;
+    ctx.tunnel_map_entry_name = tunnel_map_entry_name;
+    ctx.full_tunnel_map_entry_name = full_tunnel_map_entry_name;
+    ctx.vlan_id = vlan_id;
+    ctx.vni_id = vxlan_tunnel_map_table_[full_tunnel_map_entry_name].vni_id;
+    ctx.map_entry_id = vxlan_tunnel_map_table_[full_tunnel_map_entry_name].map_entry_id;
+    bulk_contexts_.push_back(std::move(ctx));
+
+    return deferOperation();
+}
+
+bool VxlanTunnelMapOrch::delOperationPost(const VxlanTunnelMapBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    const auto& tunnel_name = ctx.tunnel_name;
+    const auto& tunnel_map_entry_name = ctx.tunnel_map_entry_name;
+    const auto& full_tunnel_map_entry_name = ctx.full_tunnel_map_entry_name;
+    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+
+    if (ctx.status != SAI_STATUS_SUCCESS)
     {
-        SWSS_LOG_ERROR("Error removing tunnel map %s: %s", full_tunnel_map_entry_name.c_str(), error.what());
+        SWSS_LOG_ERROR("Error removing tunnel map %s: status %d",
+                       full_tunnel_map_entry_name.c_str(), ctx.status);
         return false;
     }
 
@@ -2134,6 +2202,46 @@ bool VxlanTunnelMapOrch::delOperation(const Request& request)
     return true;
 }
 
+/*
+ * Creates or removes the map entries of the deferred requests, which are all
+ * additions or all removals, then completes the requests in order.
+ */
+std::vector<bool> VxlanTunnelMapOrch::doBulkOperations()
+{
+    SWSS_LOG_ENTER();
+
+    std::deque<VxlanTunnelMapBulkContext> contexts;
+    contexts.swap(bulk_contexts_);
+
+    ObjectBulker<sai_tunnel_api_t> bulker(sai_tunnel_api, gSwitchId, gMaxBulkSize);
+    for (auto& ctx : contexts)
+    {
+        if (ctx.is_add)
+        {
+            bulker.create_entry(&ctx.map_entry_id, &ctx.status,
+                                static_cast<uint32_t>(ctx.attrs.size()), ctx.attrs.data());
+        }
+        else if (ctx.map_entry_id != SAI_NULL_OBJECT_ID)
+        {
+            bulker.remove_entry(&ctx.status, ctx.map_entry_id);
+        }
+        else
+        {
+            ctx.status = SAI_STATUS_SUCCESS;
+        }
+    }
+
+    bulker.flush();
+
+    std::vector<bool> done;
+    for (const auto& ctx : contexts)
+    {
+        done.push_back(ctx.is_add ? addOperationPost(ctx) : delOperationPost(ctx));
+    }
+
+    return done;
+}
+
 //------------------- VXLAN_VRF_MAP Table --------------------------//
 
 bool VxlanVrfMapOrch::addOperation(const Request& request)
@@ -2408,15 +2516,32 @@ bool EvpnRemoteVnip2pOrch::addOperation(const Request& request)
         return false;
     }
 
-    // SAI Call to add tunnel to the VLAN flood domain
+    // The tunnel is added to the VLAN flood domain in bulk, in doBulkOperations()
 
-    string tagging_mode = "untagged"; 
-    gPortsOrch->addVlanMember(vlanPort, tunnelPort, tagging_mode);
+    vlan_members_.emplace_back();
+    auto& ctx = vlan_members_.back();
+    ctx.is_set = true;
+    ctx.vlan_alias = vlanPort.m_alias;
+    ctx.port_alias = tunnelPort.m_alias;
+    ctx.tagging_mode = "untagged";
 
     SWSS_LOG_INFO("remote_vtep=%s vni=%d vlanid=%d ",
                    remote_vtep.c_str(), vni_id, vlan_id);
 
-    return true;
+    return deferOperation();
+}
+
+std::vector<bool> EvpnRemoteVnip2pOrch::doBulkOperations()
+{
+    SWSS_LOG_ENTER();
+
+    std::deque<VlanMemberBulkContext> contexts;
+    contexts.swap(vlan_members_);
+
+    gPortsOrch->addVlanMembers(contexts);
+
+    // A failed VLAN member is not retried, as with addVlanMember()
+    return std::vector<bool>(contexts.size(), true);
 }
 
 bool EvpnRemoteVnip2pOrch::delOperation(const Request& request)
@@ -2439,6 +2564,9 @@ bool EvpnRemoteVnip2pOrch::delOperation(const Request& request)
         return true;
     }
 
+    // The VLAN members queued may be the ones removed
+    flushOperations();
+
     // SAI Call to add tunnel to the VLAN flood domain
 
     VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
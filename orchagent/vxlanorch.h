@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <map>
 #include <unordered_map>
 #include <set>
@@ -395,6 +396,20 @@ const request_description_t vxlan_tunnel_map_request_description = {
 
 typedef std::map<std::string, tunnel_map_entry_t> VxlanTunnelMapTable;
 
+/* VXLAN_TUNNEL_MAP request whose map entry is created or removed in bulk */
+struct VxlanTunnelMapBulkContext
+{
+    bool is_add;
+    std::string tunnel_name;
+    std::string tunnel_map_entry_name;
+    std::string full_tunnel_map_entry_name;
+    sai_vlan_id_t vlan_id;
+    uint32_t vni_id;
+    std::vector<sai_attribute_t> attrs;
+    sai_object_id_t map_entry_id = SAI_NULL_OBJECT_ID;
+    sai_status_t status = SAI_STATUS_NOT_EXECUTED;
+};
+
 class VxlanTunnelMapRequest : public Request
 {
 public:
@@ -417,9 +432,14 @@ public:
 private:
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
+    virtual std::vector<bool> doBulkOperations();
+
+    bool addOperationPost(const VxlanTunnelMapBulkContext& ctx);
+    bool delOperationPost(const VxlanTunnelMapBulkContext& ctx);
 
     VxlanTunnelMapTable vxlan_tunnel_map_table_;
     VxlanTunnelMapRequest request_;
+    std::deque<VxlanTunnelMapBulkContext> bulk_contexts_;
 };
 
 const request_description_t vxlan_vrf_request_description = {
@@ -495,8 +515,10 @@ public:
 private:
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
+    virtual std::vector<bool> doBulkOperations();
 
     EvpnRemoteVniRequest request_;
+    std::deque<VlanMemberBulkContext> vlan_members_;
 };
 
 class EvpnRemoteVnip2mpOrch : public Orch2
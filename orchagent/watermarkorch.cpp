@@ -25,6 +25,8 @@ WatermarkOrch::WatermarkOrch(DBConnector *db, const vector<string> &tables):
 {
     SWSS_LOG_ENTER();
 
+    setExecutionGroup(ORCH_GROUP_COUNTERS, { ORCH_GROUP_MAIN });
+
     m_countersDb = make_shared<DBConnector>("COUNTERS_DB", 0);
     m_appDb = make_shared<DBConnector>("APPL_DB", 0);
     m_countersTable = make_shared<Table>(m_countersDb.get(), COUNTERS_TABLE);
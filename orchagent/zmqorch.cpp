@@ -16,6 +16,7 @@ void ZmqConsumer::execute()
         std::deque<KeyOpFieldsValuesTuple> entries;
         table->pops(entries);
         update_size = addToSync(entries);
+        countPopped(update_size);
     } while (update_size != 0);
 
     drain();
@@ -24,7 +25,14 @@ void ZmqConsumer::execute()
 void ZmqConsumer::drain()
 {
     if (!m_toSync.empty())
+    {
+        DrainSlice slice(*this);
+        DrainStats stats(*this);
         (static_cast<ZmqOrch*>(m_orch))->doTask(*this);
+        m_retryCounters.retried += m_toSync.size();
+    }
+
+    updateReadyState();
 }
 
 
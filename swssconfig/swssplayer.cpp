@@ -1,20 +1,49 @@
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
 
 #include <dbconnector.h>
 #include <producerstatetable.h>
+#include <redispipeline.h>
 #include <schema.h>
 #include <tokenize.h>
 
 using namespace std;
 using namespace swss;
 
+#define DEFAULT_BATCH_SIZE 128
+
+typedef chrono::steady_clock Clock;
+
 static int line_index = 0;
 static DBConnector db("APPL_DB", 0, true);
 
+struct ReplayStats
+{
+	uint64_t sets = 0;
+	uint64_t dels = 0;
+	uint64_t skipped = 0;
+	uint64_t flushes = 0;
+	/* Time spent flushing the pipeline, per flush */
+	vector<uint64_t> flush_usecs;
+	/* How late operations were sent compared to the recording, timed replay only */
+	uint64_t max_lag_usecs = 0;
+};
+
+static ReplayStats stats;
+
 void usage()
 {
-	cout << "Usage: swssplayer <file>" << endl;
+	cout << "Usage: swssplayer [-t] [-s speed] [-b batch_size] <file>" << endl;
+	cout << "    -t: preserve the recorded timing between operations (default: as fast as possible)" << endl;
+	cout << "    -s speed: replay speed factor with -t, e.g. 2 replays twice as fast (default 1)" << endl;
+	cout << "    -b batch_size: operations sent per redis pipeline flush (default 128)" << endl;
 	/* TODO: Add sample input file */
 }
 
@@ -34,46 +63,242 @@ vector<FieldValueTuple> processFieldsValuesTuple(string s)
 	return result;
 }
 
-void processTokens(vector<string> tokens)
+/* Parse the "%Y-%m-%d.%T.usec" recording timestamp, 0 if malformed */
+uint64_t parseTimestamp(const string &ts)
 {
-	auto key = tokens[1];
+	struct tm tm = {};
+	const char *rest = strptime(ts.c_str(), "%Y-%m-%d.%T.", &tm);
+	if (rest == NULL)
+	{
+		return 0;
+	}
+
+	tm.tm_isdst = -1;
+	return static_cast<uint64_t>(mktime(&tm)) * 1000000 + strtoul(rest, NULL, 10);
+}
+
+class Replayer
+{
+public:
+	/* Leave room in the pipeline so that it is only flushed by flush() */
+	Replayer(size_t batch_size) :
+		m_pipeline(&db, batch_size + 1),
+		m_batch_size(batch_size)
+	{
+	}
 
-	/* Process the key */
-	auto v_key = tokenize(key, ':', 1);
-	auto table_name = v_key[0];
-	auto key_name = v_key[1];
+	void processTokens(const vector<string> &tokens)
+	{
+		if (tokens.size() < 3)
+		{
+			stats.skipped++;
+			return;
+		}
+
+		auto key = tokens[1];
+
+		/* Process the key */
+		auto v_key = tokenize(key, ':', 1);
+		if (v_key.size() != 2)
+		{
+			/* e.g. "recording started" */
+			stats.skipped++;
+			return;
+		}
+		auto table_name = v_key[0];
+		auto key_name = v_key[1];
+
+		auto &producer = getProducer(table_name);
 
-	ProducerStateTable producer(&db, table_name);
+		/* Process the operation */
+		auto op = tokens[2];
+		if (op == SET_COMMAND)
+		{
+			auto tuples = tokens.size() > 3 ? processFieldsValuesTuple(tokens[3]) : vector<FieldValueTuple>();
+			producer.set(key_name, tuples, SET_COMMAND);
+			stats.sets++;
+		}
+		else if (op == DEL_COMMAND)
+		{
+			producer.del(key_name, DEL_COMMAND);
+			stats.dels++;
+		}
+		else
+		{
+			stats.skipped++;
+			return;
+		}
 
-	/* Process the operation */
-	auto op = tokens[2];
-	if (op == SET_COMMAND)
+		if (++m_pending >= m_batch_size)
+		{
+			flush();
+		}
+	}
+
+	void flush()
 	{
-		auto tuples = processFieldsValuesTuple(tokens[3]);
-		producer.set(key_name, tuples, SET_COMMAND);
+		if (m_pending == 0)
+		{
+			return;
+		}
+
+		auto start = Clock::now();
+		m_pipeline.flush();
+		auto usecs = chrono::duration_cast<chrono::microseconds>(Clock::now() - start).count();
+
+		stats.flushes++;
+		stats.flush_usecs.push_back(usecs);
+		m_pending = 0;
 	}
-	else if (op == DEL_COMMAND)
+
+private:
+	RedisPipeline m_pipeline;
+	size_t m_batch_size;
+	size_t m_pending = 0;
+
+	/* Producers are cached per table, buffered in the pipeline */
+	map<string, unique_ptr<ProducerStateTable>> m_producers;
+
+	ProducerStateTable &getProducer(const string &table_name)
 	{
-		producer.del(key_name, DEL_COMMAND);
+		auto it = m_producers.find(table_name);
+		if (it == m_producers.end())
+		{
+			it = m_producers.emplace(table_name, unique_ptr<ProducerStateTable>(
+						new ProducerStateTable(&m_pipeline, table_name, true))).first;
+		}
+
+		return *it->second;
+	}
+};
+
+uint64_t percentile(vector<uint64_t> &values, unsigned p)
+{
+	if (values.empty())
+	{
+		return 0;
+	}
+
+	size_t rank = (values.size() * p + 99) / 100;
+	nth_element(values.begin(), values.begin() + rank - 1, values.end());
+	return values[rank - 1];
+}
+
+void report(chrono::microseconds elapsed, bool timed)
+{
+	uint64_t ops = stats.sets + stats.dels;
+	double seconds = static_cast<double>(elapsed.count()) / 1000000;
+
+	cout << "Replayed " << ops << " operations (" << stats.sets << " SET, " << stats.dels << " DEL, "
+	     << stats.skipped << " lines skipped) from " << line_index << " lines" << endl;
+	cout << "Elapsed: " << seconds << " s, throughput: "
+	     << (seconds > 0 ? static_cast<uint64_t>(ops / seconds) : ops) << " ops/s" << endl;
+	cout << "Pipeline flushes: " << stats.flushes << ", latency p50/p99/max: "
+	     << percentile(stats.flush_usecs, 50) << "/" << percentile(stats.flush_usecs, 99) << "/"
+	     << percentile(stats.flush_usecs, 100) << " us" << endl;
+	if (timed)
+	{
+		cout << "Max lag behind the recording: " << stats.max_lag_usecs << " us" << endl;
 	}
 }
 
 int main(int argc, char **argv)
 {
-	if (argc != 2)
+	bool timed = false;
+	double speed = 1.0;
+	size_t batch_size = DEFAULT_BATCH_SIZE;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "ts:b:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 't':
+			timed = true;
+			break;
+		case 's':
+			speed = atof(optarg);
+			if (speed <= 0)
+			{
+				usage();
+				exit(EXIT_FAILURE);
+			}
+			break;
+		case 'b':
+			if (atoi(optarg) <= 0)
+			{
+				usage();
+				exit(EXIT_FAILURE);
+			}
+			batch_size = atoi(optarg);
+			break;
+		case 'h':
+			usage();
+			exit(EXIT_SUCCESS);
+		default:
+			usage();
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (optind != argc - 1)
 	{
 		usage();
 		exit(EXIT_FAILURE);
 	}
 
-	ifstream file(argv[1]);
+	ifstream file(argv[optind]);
+	if (!file.is_open())
+	{
+		cerr << "Failed to open " << argv[optind] << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	Replayer replayer(batch_size);
 	string line;
+	uint64_t first_ts = 0;
+	auto start = Clock::now();
 
 	while (getline(file, line))
 	{
+		line_index++;
+		if (line.empty())
+		{
+			continue;
+		}
+
 		auto tokens = tokenize(line, '|', 3);
-		processTokens(tokens);
 
-		line_index++;
+		if (timed)
+		{
+			uint64_t ts = parseTimestamp(tokens[0]);
+			if (ts != 0 && first_ts == 0)
+			{
+				first_ts = ts;
+			}
+
+			if (ts > first_ts)
+			{
+				auto due = start + chrono::microseconds(static_cast<uint64_t>((ts - first_ts) / speed));
+				auto now = Clock::now();
+				if (due > now)
+				{
+					/* Send what is due before waiting */
+					replayer.flush();
+					this_thread::sleep_until(due);
+				}
+				else
+				{
+					uint64_t lag = chrono::duration_cast<chrono::microseconds>(now - due).count();
+					stats.max_lag_usecs = max(stats.max_lag_usecs, lag);
+				}
+			}
+		}
+
+		replayer.processTokens(tokens);
 	}
+
+	replayer.flush();
+
+	report(chrono::duration_cast<chrono::microseconds>(Clock::now() - start), timed);
 }
@@ -0,0 +1,50 @@
+#include <fstream>
+#include <iostream>
+
+#include "lib/recorder.h"
+
+using namespace std;
+using namespace swss;
+
+void usage()
+{
+	cout << "Usage: swssrecconv <binary record file> [text record file]" << endl;
+	cout << "       Convert a binary swss.rec/responsepublisher.rec recording to text" << endl;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 2 && argc != 3)
+	{
+		usage();
+		exit(EXIT_FAILURE);
+	}
+
+	ifstream in(argv[1], ios::binary);
+	if (!in.is_open())
+	{
+		cerr << "Failed to open " << argv[1] << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	ofstream file;
+	if (argc == 3)
+	{
+		file.open(argv[2], ofstream::out | ofstream::trunc);
+		if (!file.is_open())
+		{
+			cerr << "Failed to open " << argv[2] << endl;
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	bool ok;
+	size_t count = RecWriter::binaryToText(in, argc == 3 ? file : cout, ok);
+	if (!ok)
+	{
+		cerr << "Corrupted or truncated record after " << count << " records" << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	return 0;
+}
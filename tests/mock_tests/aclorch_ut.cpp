@@ -1801,6 +1801,209 @@ namespace aclorch_test
         ASSERT_TRUE(orch->m_aclOrch->removeAclRule(tableId, ruleId));
     }
 
+    TEST_F(AclOrchTest, AclRule_BulkCreate)
+    {
+        string tableId = "acl_table";
+        const uint32_t ruleCount = 100;
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+        ASSERT_NE(orch->getTableById(tableId), SAI_NULL_OBJECT_ID);
+
+        // New rules of a task are created in bulk, the odd ones share a range
+        auto rangeCount = AclRange::m_ranges.size();
+        deque<KeyOpFieldsValuesTuple> kvfAclRules;
+        for (uint32_t i = 0; i < ruleCount; i++)
+        {
+            vector<FieldValueTuple> fields = {
+                { ACTION_PACKET_ACTION, PACKET_ACTION_DROP },
+                { MATCH_SRC_IP, "10.0." + to_string(i / 256) + "." + to_string(i % 256) },
+            };
+            if (i % 2)
+            {
+                fields.push_back({ MATCH_L4_SRC_PORT_RANGE, "1000..2000" });
+            }
+            kvfAclRules.push_back({ tableId + "|rule_" + to_string(i), SET_COMMAND, fields });
+        }
+
+        orch->doAclRuleTask(kvfAclRules);
+
+        ASSERT_EQ(AclRange::m_ranges.size(), rangeCount + 1);
+        auto rangeIt = AclRange::m_ranges.find(make_tuple(SAI_ACL_RANGE_TYPE_L4_SRC_PORT_RANGE, 1000, 2000));
+        ASSERT_NE(rangeIt, AclRange::m_ranges.end());
+        auto range = rangeIt->second;
+        ASSERT_EQ(range->m_refCnt, (int)ruleCount / 2);
+
+        for (uint32_t i = 0; i < ruleCount; i++)
+        {
+            auto rule = orch->getAclRule(tableId, "rule_" + to_string(i));
+            ASSERT_NE(rule, nullptr);
+            ASSERT_NE(Portal::AclRuleInternal::getRuleOid(rule), SAI_NULL_OBJECT_ID);
+            ASSERT_TRUE(validateAclRuleCounter(*rule, true));
+
+            sai_object_id_t rangeOids[2];
+            sai_attribute_t attr;
+            attr.id = SAI_ACL_ENTRY_ATTR_FIELD_ACL_RANGE_TYPE;
+            attr.value.aclfield.data.objlist.count = 2;
+            attr.value.aclfield.data.objlist.list = rangeOids;
+            auto status = sai_acl_api->get_acl_entry_attribute(Portal::AclRuleInternal::getRuleOid(rule), 1, &attr);
+            if (i % 2)
+            {
+                ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+                ASSERT_EQ(attr.value.aclfield.data.objlist.count, 1u);
+                ASSERT_EQ(rangeOids[0], range->getOid());
+            }
+        }
+
+        // An existing rule is replaced through the single rule path
+        orch->doAclRuleTask(deque<KeyOpFieldsValuesTuple>({{
+            tableId + "|rule_1",
+            SET_COMMAND,
+            {
+                { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                { MATCH_SRC_IP, "10.0.0.1" },
+            }
+        }}));
+
+        ASSERT_NE(orch->getAclRule(tableId, "rule_1"), nullptr);
+        ASSERT_EQ(range->m_refCnt, (int)ruleCount / 2 - 1);
+
+        for (uint32_t i = 0; i < ruleCount; i++)
+        {
+            orch->doAclRuleTask(deque<KeyOpFieldsValuesTuple>({{ tableId + "|rule_" + to_string(i), DEL_COMMAND, {} }}));
+        }
+
+        ASSERT_EQ(AclRange::m_ranges.size(), rangeCount);
+    }
+
+    uint32_t bulkCreateAclEntryCalls;
+    sai_ip4_t bulkCreateFailedSrcIp;
+
+    // Generic bulk create made of single ACL entry creates, failing the entry matching bulkCreateFailedSrcIp
+    sai_status_t bulkCreateAclObjects(sai_object_id_t switch_id, sai_object_type_t object_type, uint32_t object_count,
+                                      const uint32_t *attr_count, const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+                                      sai_object_id_t *object_id, sai_status_t *object_statuses)
+    {
+        if (object_type != SAI_OBJECT_TYPE_ACL_ENTRY)
+        {
+            return SAI_STATUS_NOT_SUPPORTED;
+        }
+
+        bulkCreateAclEntryCalls++;
+
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+            for (uint32_t j = 0; j < attr_count[i]; j++)
+            {
+                if (attr_list[i][j].id == SAI_ACL_ENTRY_ATTR_FIELD_SRC_IP &&
+                    attr_list[i][j].value.aclfield.data.ip4 == bulkCreateFailedSrcIp)
+                {
+                    object_statuses[i] = SAI_STATUS_FAILURE;
+                }
+            }
+
+            if (object_statuses[i] == SAI_STATUS_SUCCESS)
+            {
+                object_statuses[i] = sai_acl_api->create_acl_entry(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            }
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+
+        return status;
+    }
+
+    TEST_F(AclOrchTest, AclRule_BulkCreateFailure)
+    {
+        string tableId = "acl_table";
+        const uint32_t ruleCount = 10;
+
+        auto orch = createAclOrch();
+
+        orch->doAclTableTask(deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }}));
+        ASSERT_NE(orch->getTableById(tableId), SAI_NULL_OBJECT_ID);
+
+        auto &genericApi = BulkerGenericApi::instance();
+        auto oldBulkCreate = genericApi.bulk_object_create;
+        genericApi.bulk_object_create = bulkCreateAclObjects;
+        bulkCreateAclEntryCalls = 0;
+        bulkCreateFailedSrcIp = swss::IpAddress("10.0.0.5").getV4Addr();
+
+        deque<KeyOpFieldsValuesTuple> kvfAclRules;
+        for (uint32_t i = 0; i < ruleCount; i++)
+        {
+            kvfAclRules.push_back({ tableId + "|rule_" + to_string(i), SET_COMMAND, {
+                { ACTION_PACKET_ACTION, PACKET_ACTION_DROP },
+                { MATCH_SRC_IP, "10.0.0." + to_string(i) },
+            } });
+        }
+        orch->doAclRuleTask(kvfAclRules);
+
+        genericApi.bulk_object_create = oldBulkCreate;
+
+        // The entries are created in one bulk, only the failed one is left pending
+        ASSERT_EQ(bulkCreateAclEntryCalls, 1u);
+
+        swss::Table ruleStateTable(m_state_db.get(), STATE_ACL_RULE_TABLE_NAME);
+        for (uint32_t i = 0; i < ruleCount; i++)
+        {
+            string ruleId = "rule_" + to_string(i);
+            string status;
+            ASSERT_TRUE(ruleStateTable.hget(tableId + "|" + ruleId, "status", status));
+
+            auto rule = orch->getAclRule(tableId, ruleId);
+            if (i == 5)
+            {
+                ASSERT_EQ(rule, nullptr);
+                ASSERT_EQ(status, "Pending creation");
+            }
+            else
+            {
+                ASSERT_NE(rule, nullptr);
+                ASSERT_NE(Portal::AclRuleInternal::getRuleOid(rule), SAI_NULL_OBJECT_ID);
+                ASSERT_EQ(status, "Active");
+            }
+        }
+
+        // The retry creates the pending rule
+        orch->doAclRuleTask(deque<KeyOpFieldsValuesTuple>({ kvfAclRules[5] }));
+        auto rule = orch->getAclRule(tableId, "rule_5");
+        ASSERT_NE(rule, nullptr);
+        ASSERT_NE(Portal::AclRuleInternal::getRuleOid(rule), SAI_NULL_OBJECT_ID);
+
+        for (uint32_t i = 0; i < ruleCount; i++)
+        {
+            orch->doAclRuleTask(deque<KeyOpFieldsValuesTuple>({{ tableId + "|rule_" + to_string(i), DEL_COMMAND, {} }}));
+            ASSERT_EQ(orch->getAclRule(tableId, "rule_" + to_string(i)), nullptr);
+        }
+    }
+
     sai_switch_api_t *old_sai_switch_api;
 
     // The following function is used to override SAI API get_switch_attribute to request passing
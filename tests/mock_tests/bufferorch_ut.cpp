@@ -1,5 +1,8 @@
 #define private public // make Directory::m_values available to clean it.
 #include "directory.h"
+#include "bufferorch.h"
+#include "flexcounterorch.h"
+#include "portsorch.h"
 #undef private
 #define protected public
 #include "orch.h"
@@ -56,14 +59,38 @@ namespace bufferorch_test
     }
 
     uint32_t _ut_stub_set_pg_count;
+    set<sai_object_id_t> _ut_stub_failed_pg_ids;
     sai_status_t _ut_stub_sai_set_ingress_priority_group_attribute(
         _In_ sai_object_id_t ingress_priority_group_id,
         _In_ const sai_attribute_t *attr)
     {
         _ut_stub_set_pg_count++;
+        if (_ut_stub_failed_pg_ids.count(ingress_priority_group_id))
+        {
+            return SAI_STATUS_INSUFFICIENT_RESOURCES;
+        }
         return pold_sai_buffer_api->set_ingress_priority_group_attribute(ingress_priority_group_id, attr);
     }
 
+    sai_status_t _ut_stub_sai_set_ingress_priority_groups_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = _ut_stub_sai_set_ingress_priority_group_attribute(object_id[i], &attr_list[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+        return status;
+    }
+
     sai_uint64_t _ut_stub_buffer_profile_size;
     sai_uint64_t _ut_stub_buffer_profile_xon;
     sai_uint64_t _ut_stub_buffer_profile_xoff;
@@ -120,6 +147,25 @@ namespace bufferorch_test
         return pold_sai_queue_api->set_queue_attribute(queue_id, attr);
     }
 
+    sai_status_t _ut_stub_sai_set_queues_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = _ut_stub_sai_set_queue_attribute(object_id[i], &attr_list[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+        return status;
+    }
+
     void _hook_sai_apis()
     {
         ut_sai_port_api = *sai_port_api;
@@ -130,12 +176,14 @@ namespace bufferorch_test
         ut_sai_buffer_api = *sai_buffer_api;
         pold_sai_buffer_api = sai_buffer_api;
         ut_sai_buffer_api.set_ingress_priority_group_attribute = _ut_stub_sai_set_ingress_priority_group_attribute;
+        ut_sai_buffer_api.set_ingress_priority_groups_attribute = _ut_stub_sai_set_ingress_priority_groups_attribute;
         ut_sai_buffer_api.set_buffer_profile_attribute = _ut_stub_sai_set_buffer_profile_attribute;
         sai_buffer_api = &ut_sai_buffer_api;
 
         ut_sai_queue_api = *sai_queue_api;
         pold_sai_queue_api = sai_queue_api;
         ut_sai_queue_api.set_queue_attribute = _ut_stub_sai_set_queue_attribute;
+        ut_sai_queue_api.set_queues_attribute = _ut_stub_sai_set_queues_attribute;
         sai_queue_api = &ut_sai_queue_api;
     }
 
@@ -795,4 +843,61 @@ namespace bufferorch_test
         _ut_stub_buffer_profile_sanity_check = false;
         _unhook_sai_apis();
     }
+
+    TEST_F(BufferOrchTest, BufferOrchTestPgBulkSetPartialFailure)
+    {
+        _hook_sai_apis();
+        vector<string> ts;
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        DBConnector countersDb("COUNTERS_DB", 0);
+        Table pgNameMap = Table(&countersDb, COUNTERS_PG_NAME_MAP);
+        string pgOid;
+
+        gDirectory.get<FlexCounterOrch*>()->m_pg_watermark_enabled = true;
+
+        Port port;
+        ASSERT_TRUE(gPortsOrch->getPort("Ethernet0", port));
+        _ut_stub_failed_pg_ids.insert(port.m_priority_group_ids[4]);
+
+        // The profile is set on both PGs in one bulk set, PG 4 fails
+        entries.push_back({"Ethernet0:3-4", "SET",
+                           {
+                               {"profile", "ingress_lossless_profile"}
+                           }});
+        auto consumer = dynamic_cast<Consumer *>(gBufferOrch->getExecutor(APP_BUFFER_PG_TABLE_NAME));
+        consumer->addToSync(entries);
+        auto sai_pg_attr_set_count = _ut_stub_set_pg_count;
+        auto port_ref_count = gPortsOrch->m_port_ref_count["Ethernet0"];
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        ASSERT_EQ(sai_pg_attr_set_count + 2, _ut_stub_set_pg_count);
+
+        // Only PG 3 is accounted
+        ASSERT_EQ(port_ref_count + 1, gPortsOrch->m_port_ref_count["Ethernet0"]);
+        ASSERT_TRUE(pgNameMap.hget("", "Ethernet0:3", pgOid));
+        ASSERT_FALSE(pgNameMap.hget("", "Ethernet0:4", pgOid));
+        ASSERT_EQ(gBufferOrch->m_partiallyAppliedPgs.count("Ethernet0:3-4"), 1u);
+
+        // The failure is not retried by itself
+        static_cast<Orch *>(gBufferOrch)->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+
+        // Sending the same profile again sets the key again instead of skipping it
+        _ut_stub_failed_pg_ids.clear();
+        consumer->addToSync(entries);
+        sai_pg_attr_set_count = _ut_stub_set_pg_count;
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        ASSERT_EQ(sai_pg_attr_set_count + 2, _ut_stub_set_pg_count);
+        ASSERT_EQ(port_ref_count + 2, gPortsOrch->m_port_ref_count["Ethernet0"]);
+        ASSERT_TRUE(pgNameMap.hget("", "Ethernet0:4", pgOid));
+        ASSERT_EQ(gBufferOrch->m_partiallyAppliedPgs.count("Ethernet0:3-4"), 0u);
+
+        // Now that it is fully applied, the same profile is skipped
+        consumer->addToSync(entries);
+        sai_pg_attr_set_count = _ut_stub_set_pg_count;
+        static_cast<Orch *>(gBufferOrch)->doTask();
+        ASSERT_EQ(sai_pg_attr_set_count, _ut_stub_set_pg_count);
+        ASSERT_EQ(port_ref_count + 2, gPortsOrch->m_port_ref_count["Ethernet0"]);
+
+        _unhook_sai_apis();
+    }
 }
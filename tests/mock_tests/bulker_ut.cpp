@@ -8,6 +8,100 @@ namespace bulker_test
 {
     using namespace std;
 
+    uint32_t bulkGetCalls;
+    uint32_t singleGetCalls;
+    sai_status_t bulkGetStatus;
+    std::thread::id bulkGetThread;
+
+    // Hit bit is set for the entries with an even source address
+    sai_status_t readNatEntry(const sai_nat_entry_t *nat_entry, uint32_t attr_count, sai_attribute_t *attr_list)
+    {
+        if (nat_entry->data.key.src_ip == 0)
+        {
+            return SAI_STATUS_ITEM_NOT_FOUND;
+        }
+        for (uint32_t i = 0; i < attr_count; i++)
+        {
+            attr_list[i].value.booldata = (nat_entry->data.key.src_ip % 2) == 0;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t mockGetNatEntryAttribute(const sai_nat_entry_t *nat_entry, uint32_t attr_count, sai_attribute_t *attr_list)
+    {
+        singleGetCalls++;
+        return readNatEntry(nat_entry, attr_count, attr_list);
+    }
+
+    sai_status_t mockGetNatEntriesAttribute(uint32_t object_count, const sai_nat_entry_t *nat_entry, const uint32_t *attr_count,
+                                            sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        bulkGetCalls++;
+        bulkGetThread = std::this_thread::get_id();
+        if (bulkGetStatus != SAI_STATUS_SUCCESS)
+        {
+            return bulkGetStatus;
+        }
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = readNatEntry(&nat_entry[i], attr_count[i], attr_list[i]);
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    uint32_t bulkCreateCalls;
+
+    sai_status_t mockCreateRouteEntries(uint32_t object_count, const sai_route_entry_t *route_entry, const uint32_t *attr_count,
+                                        const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        bulkCreateCalls++;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = (attr_count[i] == 2 && attr_list[i][1].value.oid == route_entry[i].destination.addr.ip4) ?
+                                 SAI_STATUS_SUCCESS : SAI_STATUS_INVALID_PARAMETER;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    // Allocations of the attribute vectors the bulker kept per entry before the arena
+    size_t vectorAllocations;
+
+    template <typename T>
+    struct CountingAllocator
+    {
+        typedef T value_type;
+
+        CountingAllocator() = default;
+
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U> &)
+        {
+        }
+
+        T *allocate(size_t n)
+        {
+            vectorAllocations++;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T *p, size_t n)
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+    };
+
+    template <typename T, typename U>
+    bool operator==(const CountingAllocator<T> &, const CountingAllocator<U> &)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const CountingAllocator<T> &, const CountingAllocator<U> &)
+    {
+        return false;
+    }
+
     struct BulkerTest : public ::testing::Test
     {
         BulkerTest()
@@ -173,4 +267,259 @@ namespace bulker_test
         // Confirm neighbor entry is pending removal
         ASSERT_TRUE(gNeighBulker.bulk_entry_pending_removal(neighbor_entry_remove));
     }
+
+    TEST_F(BulkerTest, BulkGet)
+    {
+        sai_nat_api_t nat_api = {};
+        nat_api.get_nat_entry_attribute = mockGetNatEntryAttribute;
+        nat_api.get_nat_entries_attribute = mockGetNatEntriesAttribute;
+
+        EntityBulker<sai_nat_api_t> natBulker(&nat_api, 100);
+
+        bulkGetCalls = 0;
+        singleGetCalls = 0;
+        bulkGetStatus = SAI_STATUS_SUCCESS;
+
+        // Queue 250 reads, one of them on an unknown entry
+        vector<sai_nat_entry_t> entries(250);
+        vector<sai_attribute_t> attrs(250);
+        deque<sai_status_t> object_statuses;
+        for (uint32_t i = 0; i < entries.size(); i++)
+        {
+            entries[i].nat_type = SAI_NAT_TYPE_SOURCE_NAT;
+            entries[i].data.key.src_ip = i;
+            attrs[i].id = SAI_NAT_ENTRY_ATTR_HIT_BIT;
+            object_statuses.emplace_back();
+            natBulker.get_entry_attribute(&object_statuses.back(), &entries[i], 1, &attrs[i]);
+            ASSERT_EQ(object_statuses.back(), SAI_STATUS_NOT_EXECUTED);
+        }
+        ASSERT_EQ(natBulker.getting_entries_count(), 250);
+
+        natBulker.flush();
+
+        // Issued in max_bulk_size batches
+        ASSERT_EQ(bulkGetCalls, 3);
+        ASSERT_EQ(singleGetCalls, 0);
+        ASSERT_EQ(natBulker.getting_entries_count(), 0);
+        ASSERT_EQ(object_statuses[0], SAI_STATUS_ITEM_NOT_FOUND);
+        for (uint32_t i = 1; i < entries.size(); i++)
+        {
+            ASSERT_EQ(object_statuses[i], SAI_STATUS_SUCCESS);
+            ASSERT_EQ(attrs[i].value.booldata, (i % 2) == 0);
+        }
+
+        // Without bulk support, entries are read one by one
+        bulkGetStatus = SAI_STATUS_NOT_IMPLEMENTED;
+        for (uint32_t i = 0; i < entries.size(); i++)
+        {
+            natBulker.get_entry_attribute(&object_statuses[i], &entries[i], 1, &attrs[i]);
+        }
+        natBulker.flush();
+
+        ASSERT_EQ(bulkGetCalls, 4);
+        ASSERT_EQ(singleGetCalls, 250);
+        ASSERT_EQ(object_statuses[0], SAI_STATUS_ITEM_NOT_FOUND);
+        ASSERT_EQ(object_statuses[3], SAI_STATUS_SUCCESS);
+        ASSERT_FALSE(attrs[3].value.booldata);
+
+        // The bulk get is not tried again
+        natBulker.get_entry_attribute(&object_statuses[2], &entries[2], 1, &attrs[2]);
+        natBulker.flush();
+        ASSERT_EQ(bulkGetCalls, 4);
+        ASSERT_EQ(singleGetCalls, 251);
+        ASSERT_EQ(object_statuses[2], SAI_STATUS_SUCCESS);
+    }
+
+    TEST_F(BulkerTest, AsyncFlush)
+    {
+        sai_nat_api_t nat_api = {};
+        nat_api.get_nat_entry_attribute = mockGetNatEntryAttribute;
+        nat_api.get_nat_entries_attribute = mockGetNatEntriesAttribute;
+
+        EntityBulker<sai_nat_api_t> natBulker(&nat_api, 100);
+
+        bulkGetCalls = 0;
+        bulkGetStatus = SAI_STATUS_SUCCESS;
+
+        vector<sai_nat_entry_t> entries(10);
+        vector<sai_attribute_t> attrs(10);
+        vector<sai_status_t> object_statuses(10);
+        for (uint32_t i = 0; i < entries.size(); i++)
+        {
+            entries[i].data.key.src_ip = i + 1;
+            natBulker.get_entry_attribute(&object_statuses[i], &entries[i], 1, &attrs[i]);
+        }
+
+        auto completion = natBulker.flush_async();
+        ASSERT_EQ(natBulker.getting_entries_count(), 0);
+
+        // Entries queued while the flush is in flight go to the next one
+        sai_attribute_t next_attr;
+        sai_status_t next_status;
+        natBulker.get_entry_attribute(&next_status, &entries[0], 1, &next_attr);
+        ASSERT_EQ(natBulker.getting_entries_count(), 1);
+
+        // Callbacks run on the waiting thread, after the results are written
+        bool called = false;
+        completion->add_callback([&]() {
+            called = true;
+            ASSERT_EQ(object_statuses[9], SAI_STATUS_SUCCESS);
+            ASSERT_TRUE(attrs[9].value.booldata);
+        });
+        completion->wait();
+
+        ASSERT_TRUE(called);
+        ASSERT_TRUE(completion->ready());
+        ASSERT_EQ(bulkGetCalls, 1);
+        ASSERT_NE(bulkGetThread, std::this_thread::get_id());
+        for (uint32_t i = 0; i < entries.size(); i++)
+        {
+            ASSERT_EQ(object_statuses[i], SAI_STATUS_SUCCESS);
+            ASSERT_EQ(attrs[i].value.booldata, (i % 2) == 1);
+        }
+
+        natBulker.flush();
+        ASSERT_EQ(bulkGetCalls, 2);
+        ASSERT_EQ(bulkGetThread, std::this_thread::get_id());
+        ASSERT_EQ(next_status, SAI_STATUS_SUCCESS);
+
+        // Only reads are flushed asynchronously
+        sai_status_t remove_status;
+        natBulker.remove_entry(&remove_status, &entries[0]);
+        ASSERT_THROW(natBulker.flush_async(), std::logic_error);
+        ASSERT_EQ(natBulker.removing_entries_count(), 1);
+    }
+
+    TEST_F(BulkerTest, ArenaAllocations)
+    {
+        const uint32_t routes = 5000;
+
+        sai_route_api->create_route_entries = mockCreateRouteEntries;
+        EntityBulker<sai_route_api_t> routeBulker(sai_route_api, 1000);
+
+        // Nothing is allocated until a create is queued
+        ASSERT_EQ(routeBulker.arena.capacity(), 0u);
+
+        vector<sai_route_entry_t> entries(routes);
+        for (uint32_t i = 0; i < routes; i++)
+        {
+            entries[i].switch_id = 0x21000000000000;
+            entries[i].vr_id = 0x3000000000022;
+            entries[i].destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+            entries[i].destination.addr.ip4 = i + 1;
+            entries[i].destination.mask.ip4 = 0xffffffff;
+        }
+        deque<sai_status_t> object_statuses(routes);
+
+        vector<sai_attribute_t> attrs(2);
+        attrs[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+        attrs[0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+        attrs[1].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+
+        auto queueRoutes = [&](uint32_t count) {
+            for (uint32_t i = 0; i < count; i++)
+            {
+                attrs[1].value.oid = i + 1;
+                routeBulker.create_entry(&object_statuses[i], &entries[i], (uint32_t)attrs.size(), attrs.data());
+            }
+        };
+
+        const size_t minChunk = BulkerArena::MIN_CHUNK_BYTES;
+        const size_t maxChunk = BulkerArena::MAX_CHUNK_BYTES;
+        const size_t maxRetained = BulkerArena::RETAINED_BYTES;
+
+        // A small bulk only takes the first, small chunk
+        queueRoutes(1);
+        ASSERT_EQ(routeBulker.arena.chunk_allocations(), 1u);
+        ASSERT_EQ(routeBulker.arena.capacity(), minChunk);
+        routeBulker.clear();
+
+        // The attributes of all the routes fit in a few growing chunks
+        queueRoutes(routes);
+        size_t chunks = routeBulker.arena.chunk_allocations();
+        size_t bytes = routes * attrs.size() * sizeof(sai_attribute_t);
+        ASSERT_GE(routeBulker.arena.capacity(), bytes);
+        ASSERT_LE(chunks, 1 + bytes / maxChunk + 5);
+
+        bulkCreateCalls = 0;
+        routeBulker.flush();
+        ASSERT_EQ(bulkCreateCalls, 5);
+        ASSERT_EQ(routeBulker.creating_entries_count(), 0);
+        for (auto status: object_statuses)
+        {
+            ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+        }
+
+        // Up to RETAINED_BYTES of chunks are kept for the next flush
+        ASSERT_LE(routeBulker.arena.capacity(), maxRetained);
+        queueRoutes(500);
+        ASSERT_EQ(routeBulker.arena.chunk_allocations(), chunks);
+        routeBulker.flush();
+        ASSERT_EQ(bulkCreateCalls, 6);
+    }
+
+    /*
+     * Attribute allocations per route queued in the route bulker, before
+     * and after the arena. The bulker entry maps allocate the same way in
+     * both cases and are not counted.
+     */
+    TEST_F(BulkerTest, ArenaAllocations_Benchmark)
+    {
+        const uint32_t routes = 5000;
+        const uint32_t flushes = 4;
+
+        vector<sai_route_entry_t> entries(routes);
+        for (uint32_t i = 0; i < routes; i++)
+        {
+            entries[i].switch_id = 0x21000000000000;
+            entries[i].vr_id = 0x3000000000022;
+            entries[i].destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+            entries[i].destination.addr.ip4 = i + 1;
+            entries[i].destination.mask.ip4 = 0xffffffff;
+        }
+        deque<sai_status_t> object_statuses(routes);
+
+        vector<sai_attribute_t> attrs(2);
+        attrs[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+        attrs[0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+        attrs[1].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+
+        // Before: the attributes of each route copied in their own vector
+        vectorAllocations = 0;
+        for (uint32_t flush = 0; flush < flushes; flush++)
+        {
+            unordered_map<sai_route_entry_t, vector<sai_attribute_t, CountingAllocator<sai_attribute_t>>> creating_entries;
+            for (uint32_t i = 0; i < routes; i++)
+            {
+                attrs[1].value.oid = i + 1;
+                auto &queued = creating_entries[entries[i]];
+                queued.insert(queued.end(), attrs.begin(), attrs.end());
+            }
+        }
+        size_t before = vectorAllocations;
+
+        // After: the attributes in the arena of the route bulker
+        sai_route_api->create_route_entries = mockCreateRouteEntries;
+        EntityBulker<sai_route_api_t> routeBulker(sai_route_api, 1000);
+        for (uint32_t flush = 0; flush < flushes; flush++)
+        {
+            for (uint32_t i = 0; i < routes; i++)
+            {
+                attrs[1].value.oid = i + 1;
+                routeBulker.create_entry(&object_statuses[i], &entries[i], (uint32_t)attrs.size(), attrs.data());
+            }
+            routeBulker.flush();
+            for (auto status: object_statuses)
+            {
+                ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+            }
+        }
+        size_t after = routeBulker.arena.chunk_allocations();
+
+        printf("%u routes in %u flushes: %.4f attribute allocations per route with vectors, %.4f with the arena\n",
+                routes, flushes, (double)before / (routes * flushes), (double)after / (routes * flushes));
+
+        ASSERT_EQ(before, routes * flushes);
+        ASSERT_LT(after * 100, before);
+    }
 }
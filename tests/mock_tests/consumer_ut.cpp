@@ -2,10 +2,14 @@
 #include "mock_orchagent_main.h"
 #include "mock_table.h"
 
+#include <cstring>
 #include <sstream>
+#include <chrono>
 
 extern PortsOrch *gPortsOrch;
 
+extern redisReply *mockReply;
+
 namespace consumer_test
 {
     using namespace std;
@@ -322,4 +326,555 @@ namespace consumer_test
         validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
 
     }
+
+    TEST_F(ConsumerTest, ConsumerReadyList)
+    {
+        class ReadyTestOrch : public Orch
+        {
+        public:
+            ReadyTestOrch(swss::DBConnector *db, const vector<string> &tableNames)
+                : Orch(db, tableNames)
+            {
+            }
+
+            using Orch::doTask;
+
+            Consumer *getConsumer(const string &tableName)
+            {
+                return dynamic_cast<Consumer *>(getExecutor(tableName));
+            }
+
+            set<string> getReadyTables() const
+            {
+                set<string> tables;
+                for (const auto &ready : m_readyExecutors)
+                {
+                    tables.insert(ready.second);
+                }
+                return tables;
+            }
+
+            void doTask(Consumer &consumer) override
+            {
+                drained.push_back(consumer.getTableName());
+                if (!keepTasks)
+                {
+                    consumer.m_toSync.clear();
+                }
+            }
+
+            vector<string> drained;
+            bool keepTasks = false;
+        };
+
+        vector<string> tables = { "APP_TEST_TABLE_A", "APP_TEST_TABLE_B" };
+        ReadyTestOrch orch(m_app_db.get(), tables);
+        auto *consumerA = orch.getConsumer("APP_TEST_TABLE_A");
+        auto *consumerB = orch.getConsumer("APP_TEST_TABLE_B");
+        ASSERT_NE(consumerA, nullptr);
+        ASSERT_NE(consumerB, nullptr);
+
+        // Idle consumers are not drained
+        ASSERT_FALSE(orch.hasReadyExecutors());
+        orch.doTask();
+        ASSERT_TRUE(orch.drained.empty());
+
+        // A pending task makes its consumer, and only it, ready until it is drained
+        auto entry = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f1, v1a } } });
+        consumerA->addToSync(entry);
+        ASSERT_EQ(orch.getReadyTables(), set<string>({ "APP_TEST_TABLE_A" }));
+        orch.doTask();
+        ASSERT_EQ(orch.drained, vector<string>({ "APP_TEST_TABLE_A" }));
+        ASSERT_FALSE(orch.hasReadyExecutors());
+
+        // Tasks left for retry keep their consumer ready, the idle one is skipped
+        orch.drained.clear();
+        orch.keepTasks = true;
+        consumerB->addToSync(entry);
+        ASSERT_EQ(orch.getReadyTables(), set<string>({ "APP_TEST_TABLE_B" }));
+        orch.doTask();
+        orch.doTask();
+        ASSERT_EQ(orch.drained, vector<string>({ "APP_TEST_TABLE_B", "APP_TEST_TABLE_B" }));
+        ASSERT_EQ(orch.getReadyTables(), set<string>({ "APP_TEST_TABLE_B" }));
+
+        // Both consumers are drained once each when both have tasks
+        orch.drained.clear();
+        orch.keepTasks = false;
+        consumerA->addToSync(entry);
+        ASSERT_EQ(orch.getReadyTables(), set<string>({ "APP_TEST_TABLE_A", "APP_TEST_TABLE_B" }));
+        orch.doTask();
+        ASSERT_EQ(orch.drained.size(), 2u);
+        ASSERT_EQ(set<string>(orch.drained.begin(), orch.drained.end()), set<string>({ "APP_TEST_TABLE_A", "APP_TEST_TABLE_B" }));
+        ASSERT_FALSE(orch.hasReadyExecutors());
+
+        // Consumers not owned by the orch never enter its ready list
+        orch.drained.clear();
+        consumer->addToSync(entry);
+        ASSERT_EQ(consumer->m_toSync.size(), 1u);
+        ASSERT_FALSE(orch.hasReadyExecutors());
+        orch.doTask();
+        ASSERT_TRUE(orch.drained.empty());
+        ASSERT_EQ(consumer->m_toSync.size(), 1u);
+    }
+
+    TEST_F(ConsumerTest, ConsumerParkAndWakeTasks)
+    {
+        auto entrya = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f1, v1a } } });
+
+        auto entryb = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f2, v2a } } });
+
+        Constraint cst = make_pair(RETRY_CST_NEIGH, "10.0.0.1@Ethernet0");
+
+        // Parked tasks leave m_toSync but are still reported as pending
+        consumer->addToSync(entrya);
+        auto it = consumer->parkTask(consumer->m_toSync.begin(), cst);
+        ASSERT_EQ(it, consumer->m_toSync.end());
+        ASSERT_TRUE(consumer->m_toSync.empty());
+        ASSERT_TRUE(consumer->hasParkedTasks());
+        ASSERT_EQ(consumer->getRetryCounters().parked, 1);
+
+        vector<string> ts;
+        consumer->dumpPendingTasks(ts);
+        ASSERT_EQ(ts.size(), 1);
+
+        // Other constraints don't wake the task
+        ASSERT_EQ(consumer->wakeTasks(make_pair(RETRY_CST_NEIGH, "10.0.0.2@Ethernet0")), 0);
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        ASSERT_EQ(consumer->wakeTasks(cst), 1);
+        ASSERT_FALSE(consumer->hasParkedTasks());
+        ASSERT_EQ(consumer->getRetryCounters().woken, 1);
+        exp_kofv = entrya;
+        validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
+
+        // A newer task for a parked key brings the parked task back first
+        consumer->addToSync(entrya);
+        consumer->parkTask(consumer->m_toSync.begin(), cst);
+        consumer->addToSync(entryb);
+        ASSERT_FALSE(consumer->hasParkedTasks());
+        exp_kofv = KeyOpFieldsValuesTuple(
+            { key,
+                SET_COMMAND,
+                { { f1, v1a },
+                    { f2, v2a } } });
+        validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
+    }
+
+    TEST_F(ConsumerTest, ConsumerStats)
+    {
+        class StatsTestOrch : public Orch
+        {
+        public:
+            StatsTestOrch(swss::DBConnector *db, const string &tableName)
+                : Orch(db, tableName)
+            {
+            }
+
+            Consumer *getConsumer(const string &tableName)
+            {
+                return dynamic_cast<Consumer *>(getExecutor(tableName));
+            }
+
+            // Complete one task per drain
+            void doTask(Consumer &consumer) override
+            {
+                consumer.m_toSync.erase(consumer.m_toSync.begin());
+            }
+        };
+
+        StatsTestOrch orch(m_app_db.get(), "APP_TEST_TABLE");
+        auto *statsConsumer = orch.getConsumer("APP_TEST_TABLE");
+        ASSERT_NE(statsConsumer, nullptr);
+
+        for (int i = 0; i < 3; i++)
+        {
+            statsConsumer->addToSync(KeyOpFieldsValuesTuple({ key + to_string(i), SET_COMMAND, { { f1, v1a } } }));
+        }
+
+        // Nothing is collected while disabled
+        statsConsumer->drain();
+        ASSERT_EQ(statsConsumer->getStats().completed, 0);
+        ASSERT_EQ(statsConsumer->getStats().drainTime.count(), 0);
+
+        gConsumerStatsEnabled = true;
+        statsConsumer->drain();
+        statsConsumer->drain();
+        gConsumerStatsEnabled = false;
+
+        const auto &stats = statsConsumer->getStats();
+        ASSERT_EQ(stats.completed, 2);
+        ASSERT_EQ(stats.maxDepth, 2);
+        ASSERT_EQ(stats.drainTime.count(), 2);
+        ASSERT_LE(stats.drainTime.percentile(50), stats.drainTime.max());
+
+        vector<string> ts;
+        orch.dumpConsumerStats(ts);
+        ASSERT_EQ(ts.size(), 1);
+        ASSERT_EQ(ts[0].find("APP_TEST_TABLE|popped:0|completed:2|retried:3|"), 0);
+
+        swss::Table table(m_state_db.get(), "CONSUMER_STATS_TABLE");
+        orch.publishConsumerStats(table);
+        string value;
+        ASSERT_TRUE(table.hget("APP_TEST_TABLE", "max_depth", value));
+        ASSERT_EQ(value, "2");
+    }
+
+    TEST_F(ConsumerTest, ConsumerTaskBudget)
+    {
+        class BudgetTestOrch : public Orch
+        {
+        public:
+            BudgetTestOrch(swss::DBConnector *db, const string &tableName)
+                : Orch(db, tableName)
+            {
+            }
+
+            Consumer *getConsumer(const string &tableName)
+            {
+                return dynamic_cast<Consumer *>(getExecutor(tableName));
+            }
+
+            vector<size_t> drained;
+
+            // Complete all the tasks but the first one, which is retried
+            void doTask(Consumer &consumer) override
+            {
+                drained.push_back(consumer.m_toSync.size());
+                consumer.m_toSync.erase(std::next(consumer.m_toSync.begin()), consumer.m_toSync.end());
+            }
+        };
+
+        BudgetTestOrch orch(m_app_db.get(), "APP_TEST_TABLE");
+        auto *budgetConsumer = orch.getConsumer("APP_TEST_TABLE");
+        ASSERT_NE(budgetConsumer, nullptr);
+
+        for (int i = 0; i < 250; i++)
+        {
+            budgetConsumer->addToSync(KeyOpFieldsValuesTuple({ key + to_string(i), SET_COMMAND, { { f1, v1a } } }));
+        }
+        // The tasks of a key are not split by the budget
+        budgetConsumer->addToSync(KeyOpFieldsValuesTuple({ key + "99", DEL_COMMAND, { } }));
+        budgetConsumer->addToSync(KeyOpFieldsValuesTuple({ key + "99", SET_COMMAND, { { f1, v1b } } }));
+
+        gConsumerTaskBudget = 100;
+        budgetConsumer->drain();
+
+        ASSERT_EQ(orch.drained, vector<size_t>({ 101 }));
+        ASSERT_TRUE(budgetConsumer->hasBacklog());
+        ASSERT_TRUE(orch.hasBacklog());
+
+        // The deferred tasks come first, then the retried one
+        ASSERT_EQ(budgetConsumer->m_toSync.size(), 151);
+        ASSERT_EQ(budgetConsumer->m_toSync.begin()->first, key + "100");
+        ASSERT_EQ(budgetConsumer->m_toSync.rbegin()->first, key + "0");
+
+        budgetConsumer->drain();
+        ASSERT_EQ(orch.drained, vector<size_t>({ 101, 100 }));
+        ASSERT_TRUE(budgetConsumer->hasBacklog());
+
+        budgetConsumer->drain();
+        ASSERT_EQ(orch.drained, vector<size_t>({ 101, 100, 52 }));
+        ASSERT_FALSE(budgetConsumer->hasBacklog());
+        ASSERT_EQ(budgetConsumer->m_toSync.size(), 1);
+
+        gConsumerTaskBudget = 0;
+    }
+
+    TEST_F(ConsumerTest, LatencyHistogram)
+    {
+        LatencyHistogram hist;
+        ASSERT_EQ(hist.percentile(50), 0);
+
+        for (uint64_t usec = 1; usec <= 100; usec++)
+        {
+            hist.add(usec);
+        }
+
+        ASSERT_EQ(hist.count(), 100);
+        ASSERT_EQ(hist.max(), 100);
+        // 50 falls in [32, 64), 99 in [64, 128) capped by the max
+        ASSERT_EQ(hist.percentile(50), 63);
+        ASSERT_EQ(hist.percentile(99), 100);
+        ASSERT_EQ(hist.percentile(100), 100);
+    }
+
+    TEST_F(ConsumerTest, ConsumerRefillToSync)
+    {
+        // More keys than REFILL_BATCH_SIZE, added to m_toSync in batches
+        const size_t keyCount = REFILL_BATCH_SIZE * 2 + 500;
+
+        swss::Table table(m_config_db.get(), "CFG_TEST_TABLE");
+        for (size_t i = 0; i < keyCount; i++)
+        {
+            table.set("key" + to_string(i), { { f1, to_string(i) } });
+        }
+
+        ASSERT_EQ(consumer->refillToSync(&table), keyCount);
+        ASSERT_EQ(consumer->m_toSync.size(), keyCount);
+
+        auto it = consumer->m_toSync.find("key1234");
+        ASSERT_NE(it, consumer->m_toSync.end());
+        ASSERT_EQ(kfvOp(it->second), SET_COMMAND);
+        ASSERT_EQ(kfvFieldsValues(it->second), vector<FieldValueTuple>({ { f1, "1234" } }));
+    }
+
+    redisReply *mockStringReply(const string &str)
+    {
+        auto *reply = (redisReply *)calloc(sizeof(redisReply), 1);
+        reply->type = REDIS_REPLY_STRING;
+        reply->len = str.length();
+        reply->str = (char *)calloc(1, str.length() + 1);
+        memcpy(reply->str, str.c_str(), str.length());
+        return reply;
+    }
+
+    redisReply *mockArrayReply(size_t elements)
+    {
+        auto *reply = (redisReply *)calloc(sizeof(redisReply), 1);
+        reply->type = REDIS_REPLY_ARRAY;
+        reply->elements = elements;
+        reply->element = (redisReply **)calloc(sizeof(redisReply *), elements);
+        return reply;
+    }
+
+    redisReply *mockErrorReply(const string &str)
+    {
+        auto *reply = mockStringReply(str);
+        reply->type = REDIS_REPLY_ERROR;
+        return reply;
+    }
+
+    TEST_F(ConsumerTest, ConsumerRefillToSync_Script)
+    {
+        swss::Table table(m_config_db.get(), "CFG_TEST_TABLE");
+        table.set("key1", { { f1, v1a } });
+        table.set("key2", { { f1, v1a } });
+
+        auto loader = ConsumerBase::refillScriptLoader;
+        ConsumerBase::refillScriptLoader = [](swss::DBConnector *) { return string("refill_sha"); };
+
+        // The hashes come from the script reply, not from the Table: key2 was removed since getKeys
+        mockReply = mockArrayReply(2);
+        mockReply->element[0] = mockArrayReply(2);
+        mockReply->element[0]->element[0] = mockStringReply(f1);
+        mockReply->element[0]->element[1] = mockStringReply(v1b);
+        mockReply->element[1] = mockArrayReply(0);
+
+        size_t refilled = consumer->refillToSync(m_config_db.get(), "CFG_TEST_TABLE");
+        mockReply = nullptr;
+
+        ASSERT_EQ(refilled, 1u);
+        ASSERT_EQ(consumer->m_toSync.size(), 1u);
+        auto it = consumer->m_toSync.find("key1");
+        ASSERT_NE(it, consumer->m_toSync.end());
+        ASSERT_EQ(kfvFieldsValues(it->second), vector<FieldValueTuple>({ { f1, v1b } }));
+
+        // Without the script, the keys are read from the Table
+        consumer->m_toSync.clear();
+        ConsumerBase::refillScriptLoader = [](swss::DBConnector *) -> string { throw runtime_error("no script"); };
+
+        ASSERT_EQ(consumer->refillToSync(m_config_db.get(), "CFG_TEST_TABLE"), 2u);
+        ASSERT_EQ(consumer->m_toSync.size(), 2u);
+        it = consumer->m_toSync.find("key2");
+        ASSERT_NE(it, consumer->m_toSync.end());
+        ASSERT_EQ(kfvFieldsValues(it->second), vector<FieldValueTuple>({ { f1, v1a } }));
+
+        // A script reply which is not an array falls back to the Table as well
+        consumer->m_toSync.clear();
+        ConsumerBase::refillScriptLoader = [](swss::DBConnector *) { return string("refill_sha"); };
+
+        ASSERT_EQ(consumer->refillToSync(m_config_db.get(), "CFG_TEST_TABLE"), 2u);
+        ASSERT_EQ(consumer->m_toSync.size(), 2u);
+
+        // And so does an error reply, e.g. the script flushed from the DB
+        consumer->m_toSync.clear();
+        mockReply = mockErrorReply("NOSCRIPT No matching script");
+        refilled = consumer->refillToSync(m_config_db.get(), "CFG_TEST_TABLE");
+        mockReply = nullptr;
+
+        ASSERT_EQ(refilled, 2u);
+        ASSERT_EQ(consumer->m_toSync.size(), 2u);
+
+        ConsumerBase::refillScriptLoader = loader;
+    }
+
+    TEST_F(ConsumerTest, Orch2DeferredOperations)
+    {
+        static const request_description_t test_request_description = {
+            { REQ_T_STRING },
+            {
+                { "field1", REQ_T_STRING },
+            },
+            { }
+        };
+
+        class TestRequest : public Request
+        {
+        public:
+            TestRequest() : Request(test_request_description, ':') { }
+        };
+
+        class BulkTestOrch : public Orch2
+        {
+        public:
+            BulkTestOrch(swss::DBConnector *db, const string &tableName)
+                : Orch2(db, tableName, request_)
+            {
+            }
+
+            using Orch::doTask;
+
+            Consumer *getConsumer(const string &tableName)
+            {
+                return dynamic_cast<Consumer *>(getExecutor(tableName));
+            }
+
+            bool addOperation(const Request& request) override
+            {
+                const auto key = request.getKeyString(0);
+                if (key == "barrier")
+                {
+                    // The requests queued so far must be applied first
+                    flushes += queued.empty() ? 0 : 1;
+                    flushOperations();
+                    return true;
+                }
+                queued.push_back(key);
+                return deferOperation();
+            }
+
+            bool delOperation(const Request& request) override
+            {
+                return true;
+            }
+
+            vector<bool> doBulkOperations() override
+            {
+                vector<bool> done;
+                for (const auto &key : queued)
+                {
+                    done.push_back(key != "fail");
+                }
+                applied.insert(applied.end(), queued.begin(), queued.end());
+                queued.clear();
+                return done;
+            }
+
+            vector<string> queued;
+            vector<string> applied;
+            int flushes = 0;
+
+        private:
+            TestRequest request_;
+        };
+
+        BulkTestOrch orch(m_app_db.get(), "APP_BULK_TEST_TABLE");
+        auto *bulkConsumer = orch.getConsumer("APP_BULK_TEST_TABLE");
+        ASSERT_NE(bulkConsumer, nullptr);
+
+        for (const auto &k : { "a", "fail", "barrier", "b" })
+        {
+            bulkConsumer->addToSync(KeyOpFieldsValuesTuple({ k, SET_COMMAND, { { f1, v1a } } }));
+        }
+
+        orch.doTask();
+
+        // Applied in order, the barrier flushed the first two
+        ASSERT_EQ(orch.flushes, 1);
+        ASSERT_EQ(orch.applied, vector<string>({ "a", "fail", "b" }));
+        ASSERT_TRUE(orch.queued.empty());
+
+        // Only the failed request is left for retry
+        ASSERT_EQ(bulkConsumer->m_toSync.size(), 1u);
+        ASSERT_EQ(bulkConsumer->m_toSync.begin()->first, "fail");
+    }
+
+    TEST_F(ConsumerTest, ConsumerAddToSync_ManyKeys)
+    {
+        // Insert then merge many keys, in batches as popped from the table
+        const size_t keyCount = 20000;
+        const size_t batchSize = 1000;
+        vector<string> keys;
+
+        for (size_t base = 0; base < keyCount; base += batchSize)
+        {
+            deque<KeyOpFieldsValuesTuple> sets;
+            deque<KeyOpFieldsValuesTuple> merges;
+            for (size_t i = base; i < base + batchSize; i++)
+            {
+                string k = "10." + to_string(i >> 16) + "." + to_string((i >> 8) & 0xff) + "." + to_string(i & 0xff) + "/32";
+                keys.push_back(k);
+                sets.push_back(KeyOpFieldsValuesTuple({ k, SET_COMMAND, { { f1, v1a }, { f2, v2a } } }));
+                merges.push_back(KeyOpFieldsValuesTuple({ k, SET_COMMAND, { { f2, v2b } } }));
+            }
+
+            consumer->addToSync(sets);
+            consumer->addToSync(merges);
+        }
+
+        ASSERT_EQ(consumer->m_toSync.size(), keyCount);
+
+        // Merged in place, in insertion order
+        size_t i = 0;
+        for (const auto &task : consumer->m_toSync)
+        {
+            ASSERT_EQ(task.first, keys[i]);
+            ASSERT_EQ(task.second, KeyOpFieldsValuesTuple({ keys[i], SET_COMMAND, { { f1, v1a }, { f2, v2b } } }));
+            i++;
+        }
+
+        consumer->m_toSync.clear();
+    }
+
+    TEST_F(ConsumerTest, ConsumerAddToSync_Benchmark)
+    {
+        // Insert then merge 1M keys, in batches as popped from the table
+        const size_t keyCount = 1000000;
+        const size_t batchSize = 10000;
+        std::chrono::nanoseconds insertTime(0);
+        std::chrono::nanoseconds mergeTime(0);
+
+        for (size_t base = 0; base < keyCount; base += batchSize)
+        {
+            deque<KeyOpFieldsValuesTuple> sets;
+            deque<KeyOpFieldsValuesTuple> merges;
+            for (size_t i = base; i < base + batchSize; i++)
+            {
+                string k = "10." + to_string(i >> 16) + "." + to_string((i >> 8) & 0xff) + "." + to_string(i & 0xff) + "/32";
+                sets.push_back(KeyOpFieldsValuesTuple({ k, SET_COMMAND, { { f1, v1a }, { f2, v2a } } }));
+                merges.push_back(KeyOpFieldsValuesTuple({ k, SET_COMMAND, { { f2, v2b } } }));
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            consumer->addToSync(sets);
+            auto inserted = std::chrono::steady_clock::now();
+            consumer->addToSync(merges);
+            auto merged = std::chrono::steady_clock::now();
+
+            insertTime += inserted - start;
+            mergeTime += merged - inserted;
+        }
+
+        ASSERT_EQ(consumer->m_toSync.size(), keyCount);
+        auto it = consumer->m_toSync.find("10.15.66.63/32");
+        ASSERT_NE(it, consumer->m_toSync.end());
+        ASSERT_EQ(it->second, KeyOpFieldsValuesTuple({ "10.15.66.63/32", SET_COMMAND, { { f1, v1a }, { f2, v2b } } }));
+
+        auto insertMs = std::chrono::duration_cast<std::chrono::milliseconds>(insertTime).count();
+        auto mergeMs = std::chrono::duration_cast<std::chrono::milliseconds>(mergeTime).count();
+        cout << "addToSync " << keyCount << " keys: insert " << insertMs << " ms ("
+             << keyCount * 1000 / std::max<int64_t>(insertMs, 1) << " tasks/s), merge " << mergeMs << " ms ("
+             << keyCount * 1000 / std::max<int64_t>(mergeMs, 1) << " tasks/s)" << endl;
+
+        consumer->m_toSync.clear();
+    }
 }
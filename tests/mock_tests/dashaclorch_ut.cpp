@@ -0,0 +1,425 @@
+#define private public
+#include "directory.h"
+#include "crmorch.h"
+#include "dashorch.h"
+#include "dashaclorch.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "swssnet.h"
+#include "gtest/gtest.h"
+#include <string>
+
+extern sai_dash_acl_api_t *sai_dash_acl_api;
+
+namespace dashaclorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    static const string GROUP_ID = "group1";
+    static const string TAG_ID = "tag1";
+    static const string ENI_ID = "eni0";
+    static const sai_object_id_t ENI_OID = 0x5000;
+
+    sai_dash_acl_api_t ut_sai_dash_acl_api;
+    sai_dash_acl_api_t *pold_sai_dash_acl_api;
+    sai_dash_eni_api_t ut_sai_dash_eni_api;
+    sai_dash_eni_api_t *pold_sai_dash_eni_api;
+
+    // Rule calls issued, in order: "create", "remove", "bulk_create" or "bulk_remove", with their entry count
+    vector<pair<string, uint32_t>> aclRuleCalls;
+
+    // Objects alive in the stubbed SAI, rules are mapped to their group
+    set<sai_object_id_t> aclGroups;
+    map<sai_object_id_t, sai_object_id_t> aclRules;
+
+    // ACL groups bound to the ENI, by ENI attribute
+    map<sai_attr_id_t, sai_object_id_t> eniAclGroups;
+
+    // Priorities of the rules which fail to be created
+    set<uint32_t> failedPriorities;
+
+    bool bulkRuleApiSupported;
+    sai_object_id_t nextOid;
+
+    sai_status_t createAclRule(sai_object_id_t *dash_acl_rule_id, uint32_t attr_count, const sai_attribute_t *attr_list)
+    {
+        sai_object_id_t group_id = SAI_NULL_OBJECT_ID;
+        for (uint32_t i = 0; i < attr_count; i++)
+        {
+            if (attr_list[i].id == SAI_DASH_ACL_RULE_ATTR_PRIORITY && failedPriorities.count(attr_list[i].value.u32))
+            {
+                return SAI_STATUS_FAILURE;
+            }
+            if (attr_list[i].id == SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID)
+            {
+                group_id = attr_list[i].value.oid;
+            }
+        }
+
+        *dash_acl_rule_id = ++nextOid;
+        aclRules[*dash_acl_rule_id] = group_id;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_create_dash_acl_group(
+        _Out_ sai_object_id_t *dash_acl_group_id,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        *dash_acl_group_id = ++nextOid;
+        aclGroups.insert(*dash_acl_group_id);
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_remove_dash_acl_group(
+        _In_ sai_object_id_t dash_acl_group_id)
+    {
+        aclGroups.erase(dash_acl_group_id);
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_create_dash_acl_rule(
+        _Out_ sai_object_id_t *dash_acl_rule_id,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        aclRuleCalls.emplace_back("create", 1);
+        return createAclRule(dash_acl_rule_id, attr_count, attr_list);
+    }
+
+    sai_status_t _ut_stub_sai_remove_dash_acl_rule(
+        _In_ sai_object_id_t dash_acl_rule_id)
+    {
+        aclRuleCalls.emplace_back("remove", 1);
+        aclRules.erase(dash_acl_rule_id);
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_create_dash_acl_rules(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        if (!bulkRuleApiSupported)
+        {
+            return SAI_STATUS_NOT_IMPLEMENTED;
+        }
+
+        aclRuleCalls.emplace_back("bulk_create", object_count);
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = createAclRule(&object_id[i], attr_count[i], attr_list[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+        return status;
+    }
+
+    sai_status_t _ut_stub_sai_remove_dash_acl_rules(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        if (!bulkRuleApiSupported)
+        {
+            return SAI_STATUS_NOT_IMPLEMENTED;
+        }
+
+        aclRuleCalls.emplace_back("bulk_remove", object_count);
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            aclRules.erase(object_id[i]);
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_set_eni_attribute(
+        _In_ sai_object_id_t eni_id,
+        _In_ const sai_attribute_t *attr)
+    {
+        eniAclGroups[attr->id] = attr->value.oid;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    class DashAclOrchTest : public MockOrchTest
+    {
+    protected:
+        DashAclOrch *m_DashAclOrch;
+
+        void PostSetUp() override
+        {
+            pold_sai_dash_acl_api = sai_dash_acl_api;
+            ut_sai_dash_acl_api = {};
+            ut_sai_dash_acl_api.create_dash_acl_group = _ut_stub_sai_create_dash_acl_group;
+            ut_sai_dash_acl_api.remove_dash_acl_group = _ut_stub_sai_remove_dash_acl_group;
+            ut_sai_dash_acl_api.create_dash_acl_rule = _ut_stub_sai_create_dash_acl_rule;
+            ut_sai_dash_acl_api.remove_dash_acl_rule = _ut_stub_sai_remove_dash_acl_rule;
+            ut_sai_dash_acl_api.create_dash_acl_rules = _ut_stub_sai_create_dash_acl_rules;
+            ut_sai_dash_acl_api.remove_dash_acl_rules = _ut_stub_sai_remove_dash_acl_rules;
+            sai_dash_acl_api = &ut_sai_dash_acl_api;
+
+            pold_sai_dash_eni_api = sai_dash_eni_api;
+            ut_sai_dash_eni_api = {};
+            ut_sai_dash_eni_api.set_eni_attribute = _ut_stub_sai_set_eni_attribute;
+            sai_dash_eni_api = &ut_sai_dash_eni_api;
+
+            vector<string> dash_acl_tables = {
+                APP_DASH_PREFIX_TAG_TABLE_NAME,
+                APP_DASH_ACL_IN_TABLE_NAME,
+                APP_DASH_ACL_OUT_TABLE_NAME,
+                APP_DASH_ACL_GROUP_TABLE_NAME,
+                APP_DASH_ACL_RULE_TABLE_NAME
+            };
+            m_DashAclOrch = new DashAclOrch(m_app_db.get(), dash_acl_tables, m_DashOrch, nullptr);
+            gDirectory.set(m_DashAclOrch);
+            ut_orch_list.push_back((Orch **)&m_DashAclOrch);
+
+            m_DashOrch->eni_entries_[ENI_ID] = { ENI_OID, dash::eni::Eni() };
+
+            aclRuleCalls.clear();
+            aclGroups.clear();
+            aclRules.clear();
+            eniAclGroups.clear();
+            failedPriorities.clear();
+            bulkRuleApiSupported = true;
+            nextOid = 0x1000;
+        }
+
+        void PreTearDown() override
+        {
+            sai_dash_eni_api = pold_sai_dash_eni_api;
+            sai_dash_acl_api = pold_sai_dash_acl_api;
+        }
+
+        DashAclGroupMgr &groupMgr()
+        {
+            return m_DashAclOrch->getDashAclGroupMgr();
+        }
+
+        DashTag makeTag(const string &prefix)
+        {
+            DashTag tag;
+            tag.m_ip_version = SAI_IP_ADDR_FAMILY_IPV4;
+            tag.m_prefixes.emplace_back();
+            swss::copy(tag.m_prefixes.back(), IpPrefix(prefix));
+            return tag;
+        }
+
+        DashAclRule makeRule(uint32_t priority, const string &src_tag = "")
+        {
+            DashAclRule rule = {};
+            rule.m_priority = priority;
+            rule.m_action = DashAclRule::Action::ALLOW;
+            rule.m_terminating = true;
+            if (!src_tag.empty())
+            {
+                rule.m_src_tags.insert(src_tag);
+            }
+            rule.m_src_ports = { { 0, 65535 } };
+            rule.m_dst_ports = { { 0, 65535 } };
+            return rule;
+        }
+
+        // Creates an IPv4 group with three rules, the first two use the tag
+        void createGroup()
+        {
+            ASSERT_EQ(m_DashAclOrch->getDashAclTagMgr().create(TAG_ID, makeTag("10.0.0.0/24")), task_success);
+
+            DashAclGroup group;
+            group.m_ip_version = SAI_IP_ADDR_FAMILY_IPV4;
+            ASSERT_EQ(groupMgr().create(GROUP_ID, group), task_success);
+
+            auto rule1 = makeRule(1, TAG_ID);
+            auto rule2 = makeRule(2, TAG_ID);
+            auto rule3 = makeRule(3);
+            ASSERT_EQ(groupMgr().createRule(GROUP_ID, "rule1", rule1), task_success);
+            ASSERT_EQ(groupMgr().createRule(GROUP_ID, "rule2", rule2), task_success);
+            ASSERT_EQ(groupMgr().createRule(GROUP_ID, "rule3", rule3), task_success);
+        }
+
+        DashAclGroup &getGroup()
+        {
+            return groupMgr().m_groups_table.at(GROUP_ID);
+        }
+
+        sai_object_id_t getRuleOid(const string &rule_id)
+        {
+            return getGroup().m_dash_acl_rule_table.at(rule_id).m_dash_acl_rule_id;
+        }
+
+        bool hasCrmRuleCounter(sai_object_id_t group_oid)
+        {
+            auto &counters = gCrmOrch->m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap;
+            return counters.find(gCrmOrch->getCrmDashAclGroupKey(group_oid)) != counters.end();
+        }
+
+        uint32_t getCrmRuleUsed(sai_object_id_t group_oid)
+        {
+            auto &counters = gCrmOrch->m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap;
+            return counters.at(gCrmOrch->getCrmDashAclGroupKey(group_oid)).usedCounter;
+        }
+    };
+
+    TEST_F(DashAclOrchTest, RuleCreateRemoveCrm)
+    {
+        createGroup();
+
+        // Each rule is a one entry batch
+        ASSERT_EQ(aclRuleCalls.size(), 3u);
+        for (const auto &call : aclRuleCalls)
+        {
+            ASSERT_EQ(call, make_pair(string("bulk_create"), 1u));
+        }
+        auto group_oid = getGroup().m_dash_acl_group_id;
+        ASSERT_EQ(aclRules.size(), 3u);
+        for (const auto &rule : aclRules)
+        {
+            ASSERT_EQ(rule.second, group_oid);
+        }
+        ASSERT_EQ(getCrmRuleUsed(group_oid), 3u);
+
+        aclRuleCalls.clear();
+        ASSERT_EQ(groupMgr().removeRule(GROUP_ID, "rule1"), task_success);
+        ASSERT_EQ(groupMgr().removeRule(GROUP_ID, "rule3"), task_success);
+
+        ASSERT_EQ(aclRuleCalls.size(), 2u);
+        for (const auto &call : aclRuleCalls)
+        {
+            ASSERT_EQ(call, make_pair(string("bulk_remove"), 1u));
+        }
+        ASSERT_EQ(aclRules.size(), 1u);
+        ASSERT_EQ(getCrmRuleUsed(group_oid), 1u);
+    }
+
+    TEST_F(DashAclOrchTest, RuleBulkNotImplementedFallsBackToSingleCalls)
+    {
+        bulkRuleApiSupported = false;
+        createGroup();
+
+        auto group_oid = getGroup().m_dash_acl_group_id;
+        ASSERT_EQ(aclRuleCalls.size(), 3u);
+        for (const auto &call : aclRuleCalls)
+        {
+            ASSERT_EQ(call, make_pair(string("create"), 1u));
+        }
+        ASSERT_EQ(aclRules.size(), 3u);
+        ASSERT_EQ(getCrmRuleUsed(group_oid), 3u);
+
+        // The rules using the tag are rebuilt one by one
+        aclRuleCalls.clear();
+        ASSERT_EQ(m_DashAclOrch->getDashAclTagMgr().update(TAG_ID, makeTag("10.0.1.0/24")), task_success);
+
+        ASSERT_EQ(aclRuleCalls.size(), 4u);
+        ASSERT_EQ(aclRuleCalls[0], make_pair(string("remove"), 1u));
+        ASSERT_EQ(aclRuleCalls[1], make_pair(string("remove"), 1u));
+        ASSERT_EQ(aclRuleCalls[2], make_pair(string("create"), 1u));
+        ASSERT_EQ(aclRuleCalls[3], make_pair(string("create"), 1u));
+        ASSERT_EQ(aclRules.size(), 3u);
+        ASSERT_EQ(getCrmRuleUsed(group_oid), 3u);
+    }
+
+    TEST_F(DashAclOrchTest, FailedRuleCreateAborts)
+    {
+        createGroup();
+
+        // A failed DASH ACL rule creation is not retried, orchagent exits before the rule is counted
+        failedPriorities.insert(2);
+        ASSERT_DEATH({ m_DashAclOrch->getDashAclTagMgr().update(TAG_ID, makeTag("10.0.1.0/24")); }, "");
+    }
+
+    TEST_F(DashAclOrchTest, UnboundGroupTagUpdateRebuildsTaggedRules)
+    {
+        createGroup();
+
+        auto group_oid = getGroup().m_dash_acl_group_id;
+        auto rule1_oid = getRuleOid("rule1");
+        auto rule2_oid = getRuleOid("rule2");
+        auto rule3_oid = getRuleOid("rule3");
+
+        aclRuleCalls.clear();
+        ASSERT_EQ(m_DashAclOrch->getDashAclTagMgr().update(TAG_ID, makeTag("10.0.1.0/24")), task_success);
+
+        // Only the two rules using the tag are rebuilt, in one batch each way
+        ASSERT_EQ(aclRuleCalls.size(), 2u);
+        ASSERT_EQ(aclRuleCalls[0], make_pair(string("bulk_remove"), 2u));
+        ASSERT_EQ(aclRuleCalls[1], make_pair(string("bulk_create"), 2u));
+
+        ASSERT_EQ(getGroup().m_dash_acl_group_id, group_oid);
+        ASSERT_EQ(aclRules.count(rule1_oid), 0u);
+        ASSERT_EQ(aclRules.count(rule2_oid), 0u);
+        ASSERT_EQ(getRuleOid("rule3"), rule3_oid);
+        ASSERT_EQ(aclRules.count(getRuleOid("rule1")), 1u);
+        ASSERT_EQ(aclRules.count(getRuleOid("rule2")), 1u);
+        ASSERT_EQ(aclRules.size(), 3u);
+        ASSERT_EQ(getCrmRuleUsed(group_oid), 3u);
+    }
+
+    TEST_F(DashAclOrchTest, BoundGroupTagUpdateSwapsShadowGroup)
+    {
+        createGroup();
+        ASSERT_EQ(groupMgr().bind(GROUP_ID, ENI_ID, DashAclDirection::IN, DashAclStage::STAGE1), task_success);
+
+        auto old_group_oid = getGroup().m_dash_acl_group_id;
+        ASSERT_EQ(eniAclGroups[SAI_ENI_ATTR_INBOUND_V4_STAGE1_DASH_ACL_GROUP_ID], old_group_oid);
+
+        aclRuleCalls.clear();
+        ASSERT_EQ(m_DashAclOrch->getDashAclTagMgr().update(TAG_ID, makeTag("10.0.1.0/24")), task_success);
+
+        // The shadow group gets every rule in one batch, the old rules go in one batch
+        ASSERT_EQ(aclRuleCalls.size(), 2u);
+        ASSERT_EQ(aclRuleCalls[0], make_pair(string("bulk_create"), 3u));
+        ASSERT_EQ(aclRuleCalls[1], make_pair(string("bulk_remove"), 3u));
+
+        auto new_group_oid = getGroup().m_dash_acl_group_id;
+        ASSERT_NE(new_group_oid, old_group_oid);
+        ASSERT_EQ(aclGroups, set<sai_object_id_t>({ new_group_oid }));
+        ASSERT_EQ(eniAclGroups[SAI_ENI_ATTR_INBOUND_V4_STAGE1_DASH_ACL_GROUP_ID], new_group_oid);
+
+        ASSERT_EQ(aclRules.size(), 3u);
+        for (const auto &rule_id : { "rule1", "rule2", "rule3" })
+        {
+            ASSERT_EQ(aclRules.at(getRuleOid(rule_id)), new_group_oid);
+        }
+
+        ASSERT_FALSE(hasCrmRuleCounter(old_group_oid));
+        ASSERT_EQ(getCrmRuleUsed(new_group_oid), 3u);
+        ASSERT_TRUE(groupMgr().isBound(GROUP_ID));
+    }
+
+    TEST_F(DashAclOrchTest, UnchangedTagUpdateSkipsRefresh)
+    {
+        createGroup();
+        ASSERT_EQ(groupMgr().bind(GROUP_ID, ENI_ID, DashAclDirection::IN, DashAclStage::STAGE1), task_success);
+
+        auto group_oid = getGroup().m_dash_acl_group_id;
+        auto rule1_oid = getRuleOid("rule1");
+
+        aclRuleCalls.clear();
+        eniAclGroups.clear();
+        ASSERT_EQ(m_DashAclOrch->getDashAclTagMgr().update(TAG_ID, makeTag("10.0.0.0/24")), task_success);
+
+        ASSERT_TRUE(aclRuleCalls.empty());
+        ASSERT_TRUE(eniAclGroups.empty());
+        ASSERT_EQ(getGroup().m_dash_acl_group_id, group_oid);
+        ASSERT_EQ(getRuleOid("rule1"), rule1_oid);
+        ASSERT_EQ(aclGroups, set<sai_object_id_t>({ group_oid }));
+        ASSERT_EQ(getCrmRuleUsed(group_oid), 3u);
+    }
+}
@@ -42,6 +42,44 @@ namespace fdb_syncd_flush_test
     {
         sai_fdb_api = pold_sai_fdb_api;
     }
+
+    uint32_t createFdbCalls;
+    uint32_t removeFdbCalls;
+    uint32_t setFdbCalls;
+
+    sai_status_t _ut_stub_sai_count_create_fdb_entry (
+        _In_ const sai_fdb_entry_t *fdb_entry,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        createFdbCalls++;
+        return SAI_STATUS_SUCCESS;
+    }
+    sai_status_t _ut_stub_sai_count_remove_fdb_entry (
+        _In_ const sai_fdb_entry_t *fdb_entry)
+    {
+        removeFdbCalls++;
+        return SAI_STATUS_SUCCESS;
+    }
+    sai_status_t _ut_stub_sai_count_set_fdb_entry_attribute (
+        _In_ const sai_fdb_entry_t *fdb_entry,
+        _In_ const sai_attribute_t *attr)
+    {
+        setFdbCalls++;
+        return SAI_STATUS_SUCCESS;
+    }
+    void _hook_sai_fdb_api_counters()
+    {
+        createFdbCalls = 0;
+        removeFdbCalls = 0;
+        setFdbCalls = 0;
+        ut_sai_fdb_api = *sai_fdb_api;
+        pold_sai_fdb_api = sai_fdb_api;
+        ut_sai_fdb_api.create_fdb_entry = _ut_stub_sai_count_create_fdb_entry;
+        ut_sai_fdb_api.remove_fdb_entry = _ut_stub_sai_count_remove_fdb_entry;
+        ut_sai_fdb_api.set_fdb_entry_attribute = _ut_stub_sai_count_set_fdb_entry_attribute;
+        sai_fdb_api = &ut_sai_fdb_api;
+    }
     struct FdbOrchTest : public ::testing::Test
     {   
         std::shared_ptr<swss::DBConnector> m_config_db;
@@ -548,4 +586,61 @@ namespace fdb_syncd_flush_test
         ASSERT_EQ(m_portsOrch->m_portList[VXLAN_REMOTE].m_fdb_count, 1);
         _unhook_sai_fdb_api();
     }
+
+    /* Test FDB entries programmed in bulk by doTask */
+    TEST_F(FdbOrchTest, BulkAddMoveRemove)
+    {
+        _hook_sai_fdb_api_counters();
+        ASSERT_NE(m_portsOrch, nullptr);
+        setUpVlan(m_portsOrch.get());
+        setUpPort(m_portsOrch.get());
+        setUpVlanMember(m_portsOrch.get());
+        m_portsOrch->m_initDone = true;
+
+        auto consumer = unique_ptr<Consumer>(new Consumer(
+            new swss::ConsumerStateTable(m_app_db.get(), APP_FDB_TABLE_NAME, 1, 1), m_fdborch.get(), APP_FDB_TABLE_NAME));
+
+        /* Batch 1: add three static entries */
+        consumer->addToSync({
+            { "Vlan40:52:54:00:ac:3a:01", SET_COMMAND, { { "port", ETH0 }, { "type", "static" } } },
+            { "Vlan40:52:54:00:ac:3a:02", SET_COMMAND, { { "port", ETH0 }, { "type", "static" } } },
+            { "Vlan40:52:54:00:ac:3a:03", SET_COMMAND, { { "port", ETH0 }, { "type", "static" } } }
+        });
+        static_cast<Orch *>(m_fdborch.get())->doTask(*consumer);
+
+        ASSERT_EQ(createFdbCalls, 3);
+        ASSERT_EQ(m_fdborch->m_entries.size(), 3);
+        ASSERT_EQ(consumer->m_toSync.size(), 0);
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, 3);
+        ASSERT_EQ(m_portsOrch->m_portList[ETH0].m_fdb_count, 3);
+
+        string entry_type;
+        ASSERT_EQ(m_fdborch->m_fdbStateTable.hget("Vlan40:52:54:00:ac:3a:02", "type", entry_type), true);
+        ASSERT_EQ(entry_type, "static");
+
+        /* Batch 2: remove one entry, update another and replace the last one */
+        consumer->addToSync({
+            { "Vlan40:52:54:00:ac:3a:01", DEL_COMMAND, { } },
+            { "Vlan40:52:54:00:ac:3a:02", SET_COMMAND, { { "port", ETH0 }, { "type", "dynamic" } } },
+            { "Vlan40:52:54:00:ac:3a:03", DEL_COMMAND, { } },
+            { "Vlan40:52:54:00:ac:3a:03", SET_COMMAND, { { "port", ETH0 }, { "type", "dynamic" } } }
+        });
+        static_cast<Orch *>(m_fdborch.get())->doTask(*consumer);
+
+        ASSERT_EQ(removeFdbCalls, 2);
+        ASSERT_EQ(createFdbCalls, 4);
+        ASSERT_GT(setFdbCalls, 0);
+        ASSERT_EQ(m_fdborch->m_entries.size(), 2);
+        ASSERT_EQ(consumer->m_toSync.size(), 0);
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, 2);
+        ASSERT_EQ(m_portsOrch->m_portList[ETH0].m_fdb_count, 2);
+
+        ASSERT_EQ(m_fdborch->m_fdbStateTable.hget("Vlan40:52:54:00:ac:3a:01", "type", entry_type), false);
+        ASSERT_EQ(m_fdborch->m_fdbStateTable.hget("Vlan40:52:54:00:ac:3a:02", "type", entry_type), true);
+        ASSERT_EQ(entry_type, "dynamic");
+        ASSERT_EQ(m_fdborch->m_fdbStateTable.hget("Vlan40:52:54:00:ac:3a:03", "type", entry_type), true);
+        ASSERT_EQ(entry_type, "dynamic");
+
+        _unhook_sai_fdb_api();
+    }
 }
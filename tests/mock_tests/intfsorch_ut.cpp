@@ -26,6 +26,7 @@ namespace intfsorch_test
             _In_ const sai_attribute_t *attr_list)
     {
         ++create_rif_count;
+        *router_interface_id = 0x6000000000000 + create_rif_count;
         return SAI_STATUS_SUCCESS;
     }
 
@@ -331,4 +332,54 @@ namespace intfsorch_test
         ASSERT_EQ(current_create_count + 1, create_rif_count);
         ASSERT_EQ(current_remove_count + 1, remove_rif_count);
     }
-}
\ No newline at end of file
+
+    TEST_F(IntfsOrchTest, IntfsOrchBulkCreateRemove)
+    {
+        const vector<string> aliases = { "Ethernet0", "Ethernet4", "Ethernet8", "Ethernet12" };
+        auto consumer = dynamic_cast<Consumer *>(gIntfsOrch->getExecutor(APP_INTF_TABLE_NAME));
+
+        // create the interfaces and their addresses, the address tasks wait for the router interfaces
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        for (size_t i = 0; i < aliases.size(); i++)
+        {
+            entries.push_back({aliases[i], "SET", { {"mtu", "9100"} }});
+            entries.push_back({aliases[i] + ":10.0." + to_string(i) + ".1/24", "SET", { {"scope", "global"}, {"family", "IPv4"} }});
+        }
+        consumer->addToSync(entries);
+        auto current_create_count = create_rif_count;
+        static_cast<Orch *>(gIntfsOrch)->doTask();
+        ASSERT_EQ(current_create_count + (int)aliases.size(), create_rif_count);
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        for (size_t i = 0; i < aliases.size(); i++)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(aliases[i], port));
+            ASSERT_NE(port.m_rif_id, SAI_NULL_OBJECT_ID);
+            ASSERT_EQ(port.m_vr_id, gVirtualRouterId);
+            ASSERT_EQ(gIntfsOrch->getSyncdIntfses().at(aliases[i]).ip_addresses.size(), 1u);
+        }
+        ASSERT_EQ(gIntfsOrch->m_rifsToAdd.size(), aliases.size());
+
+        // remove the addresses, then the interfaces
+        entries.clear();
+        for (size_t i = 0; i < aliases.size(); i++)
+        {
+            entries.push_back({aliases[i] + ":10.0." + to_string(i) + ".1/24", "DEL", { {} }});
+            entries.push_back({aliases[i], "DEL", { {} }});
+        }
+        consumer->addToSync(entries);
+        auto current_remove_count = remove_rif_count;
+        static_cast<Orch *>(gIntfsOrch)->doTask();
+        ASSERT_EQ(current_remove_count + (int)aliases.size(), remove_rif_count);
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        for (const auto &alias : aliases)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(alias, port));
+            ASSERT_EQ(port.m_rif_id, SAI_NULL_OBJECT_ID);
+            ASSERT_EQ(gIntfsOrch->getSyncdIntfses().count(alias), 0u);
+        }
+    }
+}
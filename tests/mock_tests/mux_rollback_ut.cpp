@@ -30,6 +30,7 @@ namespace mux_rollback_test
     using ::testing::Throw;
     using ::testing::DoAll;
     using ::testing::SetArrayArgument;
+    using ::testing::InSequence;
 
     static const string TEST_INTERFACE = "Ethernet4";
 
@@ -37,6 +38,71 @@ namespace mux_rollback_test
     sai_bulk_remove_neighbor_entry_fn old_remove_neighbor_entries;
     sai_bulk_create_route_entry_fn old_create_route_entries;
     sai_bulk_remove_route_entry_fn old_remove_route_entries;
+    BulkerGenericApi old_bulker_generic_api;
+
+    // Generic bulk create of next hops, made of single creates on the mocked api and honoring the error mode
+    sai_status_t mock_bulk_object_create(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        if (object_type != SAI_OBJECT_TYPE_NEXT_HOP)
+        {
+            return old_bulker_generic_api.bulk_object_create(switch_id, object_type, object_count, attr_count, attr_list,
+                                                             mode, object_id, object_statuses);
+        }
+
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+            {
+                object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+                continue;
+            }
+            object_statuses[i] = sai_next_hop_api->create_next_hop(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+        return status;
+    }
+
+    // Generic bulk remove of next hops, made of single removes on the mocked api and honoring the error mode
+    sai_status_t mock_bulk_object_remove(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        if (object_type != SAI_OBJECT_TYPE_NEXT_HOP)
+        {
+            return old_bulker_generic_api.bulk_object_remove(object_type, object_count, object_id, mode, object_statuses);
+        }
+
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+            {
+                object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+                continue;
+            }
+            object_statuses[i] = sai_next_hop_api->remove_next_hop(object_id[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+        return status;
+    }
 
     class MuxRollbackTest : public MockOrchTest
     {
@@ -151,6 +217,9 @@ namespace mux_rollback_test
             gNeighOrch->gNeighBulker.remove_entries = mock_remove_neighbor_entries;
             m_MuxCable->nbr_handler_->gRouteBulker.create_entries = mock_create_route_entries;
             m_MuxCable->nbr_handler_->gRouteBulker.remove_entries = mock_remove_route_entries;
+            old_bulker_generic_api = BulkerGenericApi::instance();
+            BulkerGenericApi::instance().bulk_object_create = mock_bulk_object_create;
+            BulkerGenericApi::instance().bulk_object_remove = mock_bulk_object_remove;
         }
 
         void PreTearDown() override
@@ -160,6 +229,18 @@ namespace mux_rollback_test
             gNeighOrch->gNeighBulker.remove_entries = old_remove_neighbor_entries;
             m_MuxCable->nbr_handler_->gRouteBulker.create_entries = old_create_route_entries;
             m_MuxCable->nbr_handler_->gRouteBulker.remove_entries = old_remove_route_entries;
+            BulkerGenericApi::instance() = old_bulker_generic_api;
+        }
+
+        uint32_t GetCrmIpv4NeighborUsed()
+        {
+            uint32_t used = 0;
+            const auto &resourceMap = Portal::CrmOrchInternal::getResourceMap(gCrmOrch);
+            for (const auto &kv : resourceMap.at(CrmResourceType::CRM_IPV4_NEIGHBOR).countersMap)
+            {
+                used += kv.second.usedCounter;
+            }
+            return used;
         }
     };
 
@@ -227,6 +308,25 @@ namespace mux_rollback_test
         SetAndAssertMuxState(STANDBY_STATE);
     }
 
+    TEST_F(MuxRollbackTest, StandbyToActiveNextHopCreatedAfterNeighbor)
+    {
+        InSequence seq;
+        EXPECT_CALL(*mock_sai_neighbor_api, create_neighbor_entries);
+        EXPECT_CALL(*mock_sai_next_hop_api, create_next_hop);
+        SetAndAssertMuxState(ACTIVE_STATE);
+        EXPECT_TRUE(gNeighOrch->hasNextHop(NextHopKey(SERVER_IP1, VLAN_1000)));
+    }
+
+    TEST_F(MuxRollbackTest, ActiveToStandbyNextHopRemovedBeforeNeighbor)
+    {
+        SetAndAssertMuxState(ACTIVE_STATE);
+        InSequence seq;
+        EXPECT_CALL(*mock_sai_next_hop_api, remove_next_hop);
+        EXPECT_CALL(*mock_sai_neighbor_api, remove_neighbor_entries);
+        SetAndAssertMuxState(STANDBY_STATE);
+        EXPECT_FALSE(gNeighOrch->hasNextHop(NextHopKey(SERVER_IP1, VLAN_1000)));
+    }
+
     TEST_F(MuxRollbackTest, StandbyToActiveRuntimeErrorRollbackToStandby)
     {
         EXPECT_CALL(*mock_sai_route_api, remove_route_entries)
@@ -285,4 +385,39 @@ namespace mux_rollback_test
         SetMuxStateFromAppDb(ACTIVE_STATE);
         EXPECT_EQ(STANDBY_STATE, m_MuxCable->getState());
     }
+
+    TEST_F(MuxRollbackTest, StandbyToActiveNextHopCreateFailedRemovesNeighbor)
+    {
+        auto crmNeighborUsed = GetCrmIpv4NeighborUsed();
+        EXPECT_CALL(*mock_sai_next_hop_api, create_next_hop)
+            .WillOnce(Return(SAI_STATUS_TABLE_FULL));
+        EXPECT_CALL(*mock_sai_neighbor_api, remove_neighbor_entry);
+        SetMuxStateFromAppDb(ACTIVE_STATE);
+        EXPECT_EQ(STANDBY_STATE, m_MuxCable->getState());
+        EXPECT_FALSE(gNeighOrch->hasNextHop(NextHopKey(SERVER_IP1, VLAN_1000)));
+        EXPECT_EQ(crmNeighborUsed, GetCrmIpv4NeighborUsed());
+    }
+
+    TEST_F(MuxRollbackTest, StandbyToActiveNextHopTableFullRollsBackBulk)
+    {
+        // A second neighbor of the cable, on its IPv6 server address
+        Table neigh_table = Table(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+        neigh_table.set(
+            VLAN_1000 + neigh_table.getTableNameSeparator() + "a::a", { { "neigh", "62:f9:65:10:2f:05" },
+                                                                         { "family", "IPv6" } });
+        gNeighOrch->addExistingData(&neigh_table);
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        // The first next hop of the bulk fails, the bulk stops and the second one is not executed
+        auto crmNeighborUsed = GetCrmIpv4NeighborUsed();
+        EXPECT_CALL(*mock_sai_next_hop_api, create_next_hop)
+            .WillOnce(Return(SAI_STATUS_TABLE_FULL));
+        EXPECT_CALL(*mock_sai_neighbor_api, remove_neighbor_entry)
+            .Times(2);
+        SetMuxStateFromAppDb(ACTIVE_STATE);
+        EXPECT_EQ(STANDBY_STATE, m_MuxCable->getState());
+        EXPECT_FALSE(gNeighOrch->hasNextHop(NextHopKey(SERVER_IP1, VLAN_1000)));
+        EXPECT_FALSE(gNeighOrch->hasNextHop(NextHopKey("a::a", VLAN_1000)));
+        EXPECT_EQ(crmNeighborUsed, GetCrmIpv4NeighborUsed());
+    }
 }
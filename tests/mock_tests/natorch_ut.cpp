@@ -0,0 +1,259 @@
+#define private public
+#include "directory.h"
+#include "natorch.h"
+#include "crmorch.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "gtest/gtest.h"
+#include <string>
+
+extern NatOrch *gNatOrch;
+
+namespace natorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    sai_nat_api_t ut_sai_nat_api;
+    sai_nat_api_t *pold_sai_nat_api;
+
+    // Bulk calls issued, in order: "create", "remove" or "get", with their entry count
+    vector<pair<string, uint32_t>> natBulkCalls;
+
+    // L4 source ports of the entries whose counters were read
+    vector<uint16_t> natCounterReads;
+
+    sai_status_t _ut_stub_sai_create_nat_entries(
+        _In_ uint32_t object_count,
+        _In_ const sai_nat_entry_t *nat_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        natBulkCalls.emplace_back("create", object_count);
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_remove_nat_entries(
+        _In_ uint32_t object_count,
+        _In_ const sai_nat_entry_t *nat_entry,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        natBulkCalls.emplace_back("remove", object_count);
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_get_nat_entries_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_nat_entry_t *nat_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        natBulkCalls.emplace_back("get", object_count);
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            natCounterReads.push_back(nat_entry[i].data.key.l4_src_port);
+            for (uint32_t j = 0; j < attr_count[i]; j++)
+            {
+                attr_list[i][j].value.u64 = 0;
+            }
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    class NatOrchTest : public MockOrchTest
+    {
+    protected:
+        void PostSetUp() override
+        {
+            // The NAT bulker takes the bulk functions when NatOrch is created
+            pold_sai_nat_api = sai_nat_api;
+            ut_sai_nat_api = *sai_nat_api;
+            ut_sai_nat_api.create_nat_entries = _ut_stub_sai_create_nat_entries;
+            ut_sai_nat_api.remove_nat_entries = _ut_stub_sai_remove_nat_entries;
+            ut_sai_nat_api.get_nat_entries_attribute = _ut_stub_sai_get_nat_entries_attribute;
+            sai_nat_api = &ut_sai_nat_api;
+
+            vector<table_name_with_pri_t> nat_tables = {
+                { APP_NAT_DNAT_POOL_TABLE_NAME, 5 },
+                { APP_NAT_TABLE_NAME, 4 },
+                { APP_NAPT_TABLE_NAME, 3 },
+                { APP_NAT_TWICE_TABLE_NAME, 2 },
+                { APP_NAPT_TWICE_TABLE_NAME, 1 },
+                { APP_NAT_GLOBAL_TABLE_NAME, 0 }
+            };
+            gNatOrch = new NatOrch(m_app_db.get(), m_state_db.get(), nat_tables, gRouteOrch, gNeighOrch);
+            gDirectory.set(gNatOrch);
+            ut_orch_list.push_back((Orch **)&gNatOrch);
+
+            gNatOrch->admin_mode = "enabled";
+            gNatOrch->maxAllowedSNatEntries = 1024;
+
+            natBulkCalls.clear();
+            natCounterReads.clear();
+        }
+
+        void PreTearDown() override
+        {
+            sai_nat_api = pold_sai_nat_api;
+        }
+
+        void doNatTask(const string &table, const deque<KeyOpFieldsValuesTuple> &entries)
+        {
+            auto consumer = dynamic_cast<Consumer *>(gNatOrch->getExecutor(table));
+            consumer->addToSync(entries);
+            static_cast<Orch *>(gNatOrch)->doTask();
+        }
+
+        KeyOpFieldsValuesTuple snapt(const string &op, int port, const string &translated_ip = "10.0.0.1")
+        {
+            if (op == DEL_COMMAND)
+            {
+                return { "TCP:65.55.42.1:" + to_string(port), op, {} };
+            }
+
+            return { "TCP:65.55.42.1:" + to_string(port), op, { { "translated_ip", translated_ip },
+                                                                { "translated_l4_port", to_string(port + 5000) },
+                                                                { "nat_type", "snat" },
+                                                                { "entry_type", "dynamic" } } };
+        }
+
+        uint32_t getCrmSnatUsed()
+        {
+            uint32_t used = 0;
+            for (const auto &kv : gCrmOrch->m_resourcesMap.at(CrmResourceType::CRM_SNAT_ENTRY).countersMap)
+            {
+                used += kv.second.usedCounter;
+            }
+            return used;
+        }
+    };
+
+    TEST_F(NatOrchTest, NaptBulkAddRemove)
+    {
+        auto crmSnatUsed = getCrmSnatUsed();
+
+        doNatTask(APP_NAPT_TABLE_NAME, { snapt(SET_COMMAND, 1001), snapt(SET_COMMAND, 1002), snapt(SET_COMMAND, 1003) });
+
+        // One bulk create for the three entries
+        ASSERT_EQ(natBulkCalls.size(), 1u);
+        ASSERT_EQ(natBulkCalls[0], make_pair(string("create"), 3u));
+        ASSERT_EQ(gNatOrch->m_naptEntries.size(), 3u);
+        for (const auto &entry : gNatOrch->m_naptEntries)
+        {
+            ASSERT_TRUE(entry.second.addedToHw);
+        }
+        ASSERT_EQ(gNatOrch->totalDynamicNaptEntries, 3);
+        ASSERT_EQ(getCrmSnatUsed(), crmSnatUsed + 3);
+
+        natBulkCalls.clear();
+        doNatTask(APP_NAPT_TABLE_NAME, { snapt(DEL_COMMAND, 1001), snapt(DEL_COMMAND, 1002), snapt(DEL_COMMAND, 1003) });
+
+        // One bulk remove for the three entries
+        ASSERT_EQ(natBulkCalls.size(), 1u);
+        ASSERT_EQ(natBulkCalls[0], make_pair(string("remove"), 3u));
+        ASSERT_TRUE(gNatOrch->m_naptEntries.empty());
+        ASSERT_EQ(gNatOrch->totalDynamicNaptEntries, 0);
+        ASSERT_EQ(getCrmSnatUsed(), crmSnatUsed);
+    }
+
+    TEST_F(NatOrchTest, NaptReAddNewTranslation)
+    {
+        doNatTask(APP_NAPT_TABLE_NAME, { snapt(SET_COMMAND, 1001), snapt(SET_COMMAND, 1002) });
+
+        natBulkCalls.clear();
+        doNatTask(APP_NAPT_TABLE_NAME, { snapt(SET_COMMAND, 1001, "10.0.0.2"), snapt(SET_COMMAND, 1003) });
+
+        // The old translation is removed before the new one is created
+        ASSERT_EQ(natBulkCalls.size(), 2u);
+        ASSERT_EQ(natBulkCalls[0], make_pair(string("remove"), 1u));
+        ASSERT_EQ(natBulkCalls[1], make_pair(string("create"), 2u));
+
+        NaptEntryKey key;
+        key.ip_address = IpAddress("65.55.42.1");
+        key.l4_port = 1001;
+        key.prototype = "TCP";
+
+        ASSERT_EQ(gNatOrch->m_naptEntries.size(), 3u);
+        ASSERT_EQ(gNatOrch->m_naptEntries[key].translated_ip, IpAddress("10.0.0.2"));
+        ASSERT_TRUE(gNatOrch->m_naptEntries[key].addedToHw);
+        ASSERT_EQ(gNatOrch->totalDynamicNaptEntries, 3);
+    }
+
+    TEST_F(NatOrchTest, NaptCountersCursorWrapAround)
+    {
+        doNatTask(APP_NAPT_TABLE_NAME, { snapt(SET_COMMAND, 1001), snapt(SET_COMMAND, 1002), snapt(SET_COMMAND, 1003),
+                                         snapt(SET_COMMAND, 1004), snapt(SET_COMMAND, 1005) });
+
+        gNatOrch->m_cntrsQuerySlice = 3;
+
+        // The first query period reads the first three entries in one bulk get
+        natBulkCalls.clear();
+        gNatOrch->queryCounters();
+        ASSERT_EQ(natBulkCalls.size(), 1u);
+        ASSERT_EQ(natBulkCalls[0], make_pair(string("get"), 3u));
+        ASSERT_EQ(natCounterReads, vector<uint16_t>({ 1001, 1002, 1003 }));
+
+        // The second one resumes after them and wraps around to the first entry
+        natBulkCalls.clear();
+        natCounterReads.clear();
+        gNatOrch->queryCounters();
+        ASSERT_EQ(natBulkCalls.size(), 1u);
+        ASSERT_EQ(natBulkCalls[0], make_pair(string("get"), 3u));
+        ASSERT_EQ(natCounterReads, vector<uint16_t>({ 1004, 1005, 1001 }));
+    }
+
+    TEST_F(NatOrchTest, TwiceNaptBulkAddRemove)
+    {
+        auto twiceNapt = [](const string &op, int port) -> KeyOpFieldsValuesTuple {
+            string key = "TCP:91.91.91.91:" + to_string(port) + ":65.55.42.1:1024";
+            if (op == DEL_COMMAND)
+            {
+                return { key, op, {} };
+            }
+
+            return { key, op, { { "translated_src_ip", "14.14.14.14" },
+                                { "translated_src_l4_port", to_string(port + 5000) },
+                                { "translated_dst_ip", "12.12.12.12" },
+                                { "translated_dst_l4_port", "8000" },
+                                { "entry_type", "dynamic" } } };
+        };
+
+        doNatTask(APP_NAPT_TWICE_TABLE_NAME, { twiceNapt(SET_COMMAND, 6001), twiceNapt(SET_COMMAND, 6002) });
+
+        ASSERT_EQ(natBulkCalls.size(), 1u);
+        ASSERT_EQ(natBulkCalls[0], make_pair(string("create"), 2u));
+        ASSERT_EQ(gNatOrch->m_twiceNaptEntries.size(), 2u);
+        for (const auto &entry : gNatOrch->m_twiceNaptEntries)
+        {
+            ASSERT_TRUE(entry.second.addedToHw);
+        }
+        ASSERT_EQ(gNatOrch->totalDynamicTwiceNaptEntries, 2);
+
+        natBulkCalls.clear();
+        doNatTask(APP_NAPT_TWICE_TABLE_NAME, { twiceNapt(DEL_COMMAND, 6001), twiceNapt(DEL_COMMAND, 6002) });
+
+        ASSERT_EQ(natBulkCalls.size(), 1u);
+        ASSERT_EQ(natBulkCalls[0], make_pair(string("remove"), 2u));
+        ASSERT_TRUE(gNatOrch->m_twiceNaptEntries.empty());
+        ASSERT_EQ(gNatOrch->totalDynamicTwiceNaptEntries, 0);
+    }
+}
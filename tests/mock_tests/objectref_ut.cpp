@@ -0,0 +1,161 @@
+#include "ut_helper.h"
+#include "orch.h"
+
+#include <chrono>
+
+namespace objectref_test
+{
+    using namespace std;
+
+    const string SCHEDULER_TABLE = "SCHEDULER";
+    const string WRED_TABLE = "WRED_PROFILE";
+    const string QUEUE_TABLE = "QUEUE";
+
+    class RefTestOrch : public Orch
+    {
+    public:
+        RefTestOrch() : Orch()
+        {
+        }
+
+        using Orch::resolveFieldRefValue;
+        using Orch::setObjectReference;
+        using Orch::removeMeFromObjsReferencedByMe;
+        using Orch::doesObjectExist;
+        using Orch::removeObject;
+        using Orch::isObjectBeingReferenced;
+    };
+
+    struct ObjectRefTest : public ::testing::Test
+    {
+        type_map m_maps = {
+            { SCHEDULER_TABLE, make_shared<object_reference_map>() },
+            { WRED_TABLE, make_shared<object_reference_map>() },
+            { QUEUE_TABLE, make_shared<object_reference_map>() },
+        };
+
+        RefTestOrch m_orch;
+
+        void addObject(const string &table, const string &name, sai_object_id_t oid)
+        {
+            auto &obj = (*m_maps[table])[name];
+            obj.m_saiObjectId = oid;
+            obj.m_pendingRemove = false;
+        }
+
+        // Resolve the scheduler of a queue and record the reference
+        bool setQueueScheduler(const string &queue, const string &scheduler, sai_object_id_t &oid)
+        {
+            KeyOpFieldsValuesTuple tuple(queue, SET_COMMAND, { { "scheduler", scheduler } });
+            string referenced;
+            if (m_orch.resolveFieldRefValue(m_maps, "scheduler", SCHEDULER_TABLE, tuple, oid, referenced) != ref_resolve_status::success)
+            {
+                return false;
+            }
+
+            m_orch.setObjectReference(m_maps, QUEUE_TABLE, queue, "scheduler", referenced);
+            return true;
+        }
+    };
+
+    TEST_F(ObjectRefTest, ObjectNameSet)
+    {
+        size_t names = ObjectNamePool::instance().size();
+        {
+            ObjectNameSet set;
+            ASSERT_TRUE(set.insert("Ethernet0|3").second);
+            ASSERT_TRUE(set.insert("Ethernet4|3").second);
+            ASSERT_FALSE(set.insert("Ethernet0|3").second);
+            ASSERT_EQ(set.size(), 2);
+            ASSERT_EQ(set.count("Ethernet0|3"), 1);
+            ASSERT_EQ(set.count("Ethernet8|3"), 0);
+            ASSERT_EQ(*set.find("Ethernet4|3"), "Ethernet4|3");
+
+            ObjectNameSet copy(set);
+            ASSERT_EQ(set.erase("Ethernet0|3"), 1);
+            ASSERT_EQ(set.erase("Ethernet0|3"), 0);
+            ASSERT_EQ(copy.count("Ethernet0|3"), 1);
+            ASSERT_EQ(ObjectNamePool::instance().size(), names + 2);
+        }
+
+        // Names are released with the last set using them
+        ASSERT_EQ(ObjectNamePool::instance().size(), names);
+    }
+
+    TEST_F(ObjectRefTest, References)
+    {
+        addObject(SCHEDULER_TABLE, "scheduler.0", 0x100);
+        addObject(SCHEDULER_TABLE, "scheduler.1", 0x101);
+
+        sai_object_id_t oid;
+        ASSERT_TRUE(setQueueScheduler("Ethernet0|3", "scheduler.0", oid));
+        ASSERT_EQ(oid, 0x100);
+        ASSERT_TRUE(m_orch.isObjectBeingReferenced(m_maps, SCHEDULER_TABLE, "scheduler.0"));
+
+        // Moving the reference updates both objects
+        ASSERT_TRUE(setQueueScheduler("Ethernet0|3", "scheduler.1", oid));
+        ASSERT_EQ(oid, 0x101);
+        ASSERT_FALSE(m_orch.isObjectBeingReferenced(m_maps, SCHEDULER_TABLE, "scheduler.0"));
+        ASSERT_EQ((*m_maps[SCHEDULER_TABLE])["scheduler.1"].m_objsDependingOnMe.count("Ethernet0|3"), 1);
+
+        string referenced;
+        ASSERT_TRUE(m_orch.doesObjectExist(m_maps, QUEUE_TABLE, "Ethernet0|3", "scheduler", referenced));
+        ASSERT_EQ(referenced, SCHEDULER_TABLE + ":scheduler.1");
+
+        // Pending removed and unknown objects are not resolved
+        (*m_maps[SCHEDULER_TABLE])["scheduler.0"].m_pendingRemove = true;
+        ASSERT_FALSE(setQueueScheduler("Ethernet4|3", "scheduler.0", oid));
+        ASSERT_FALSE(setQueueScheduler("Ethernet4|3", "scheduler.2", oid));
+
+        m_orch.removeObject(m_maps, QUEUE_TABLE, "Ethernet0|3");
+        ASSERT_FALSE(m_orch.isObjectBeingReferenced(m_maps, SCHEDULER_TABLE, "scheduler.1"));
+    }
+
+    TEST_F(ObjectRefTest, References_Benchmark)
+    {
+        // 512 ports with 8 queues, each queue moving between 8 schedulers
+        const int ports = 512;
+        const int queues = 8;
+        const int schedulers = 8;
+
+        for (int i = 0; i < schedulers; i++)
+        {
+            addObject(SCHEDULER_TABLE, "scheduler." + to_string(i), 0x100 + i);
+        }
+
+        vector<string> queueNames;
+        for (int p = 0; p < ports; p++)
+        {
+            for (int q = 0; q < queues; q++)
+            {
+                queueNames.push_back("Ethernet" + to_string(p * 4) + "|" + to_string(q));
+            }
+        }
+
+        auto start = chrono::steady_clock::now();
+
+        sai_object_id_t oid;
+        for (int round = 0; round < schedulers; round++)
+        {
+            for (const auto &queue : queueNames)
+            {
+                ASSERT_TRUE(setQueueScheduler(queue, "scheduler." + to_string(round), oid));
+            }
+        }
+
+        for (const auto &queue : queueNames)
+        {
+            m_orch.removeObject(m_maps, QUEUE_TABLE, queue);
+        }
+
+        auto msecs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+        size_t refs = queueNames.size() * schedulers;
+        cout << "Resolved and set " << refs << " references in " << msecs << " ms ("
+             << (msecs ? refs * 1000 / msecs : refs) << " refs/s)" << endl;
+
+        for (int i = 0; i < schedulers; i++)
+        {
+            ASSERT_FALSE(m_orch.isObjectBeingReferenced(m_maps, SCHEDULER_TABLE, "scheduler." + to_string(i)));
+        }
+    }
+}
@@ -0,0 +1,73 @@
+#include "ut_helper.h"
+#include "observer.h"
+
+namespace observer_test
+{
+    struct TestUpdate
+    {
+        string name;
+        int value;
+    };
+
+    class TestSubject : public Subject
+    {
+    public:
+        void change(const string &name, int value)
+        {
+            TestUpdate update = { name, value };
+            notify(SUBJECT_TYPE_NEIGH_CHANGE, update, name);
+        }
+    };
+
+    class TestObserver : public Observer
+    {
+    public:
+        vector<pair<string, int>> updates;
+        size_t batches = 0;
+
+        void update(SubjectType, void *cntx) override
+        {
+            auto update = static_cast<TestUpdate *>(cntx);
+            updates.emplace_back(update->name, update->value);
+        }
+
+        void updateBatch(SubjectType type, const vector<void *> &cntxs) override
+        {
+            batches++;
+            Observer::updateBatch(type, cntxs);
+        }
+    };
+
+    TEST(ObserverTest, BatchedUpdates)
+    {
+        TestSubject subject;
+        TestObserver immediate;
+        TestObserver batched;
+
+        subject.attach(&immediate);
+        subject.attachBatched(&batched, SUBJECT_TYPE_NEIGH_CHANGE);
+
+        subject.change("a", 1);
+        subject.change("b", 1);
+        subject.change("a", 2);
+
+        // Immediate observers see every change as it happens
+        ASSERT_EQ(immediate.updates.size(), 3);
+        ASSERT_TRUE(batched.updates.empty());
+
+        // Batched observers get the latest update of each object at once
+        Subject::notifyBatches();
+        ASSERT_EQ(batched.batches, 1);
+        ASSERT_EQ(batched.updates, (vector<pair<string, int>>{ { "a", 2 }, { "b", 1 } }));
+
+        // Nothing left to deliver
+        Subject::notifyBatches();
+        ASSERT_EQ(batched.batches, 1);
+
+        subject.detach(&batched);
+        subject.change("c", 1);
+        Subject::notifyBatches();
+        ASSERT_EQ(immediate.updates.size(), 4);
+        ASSERT_EQ(batched.updates.size(), 2);
+    }
+}
@@ -49,4 +49,44 @@ namespace orchdaemon_test
 
         orchd->logRotate();
     }
+
+    TEST(FlushPolicyTest, FlushReasons)
+    {
+        FlushPolicy policy(3, std::chrono::milliseconds(5));
+        auto now = FlushPolicy::Clock::now();
+        FlushPolicy::Reason reason;
+
+        // Nothing pending, wait for the idle timeout
+        ASSERT_FALSE(policy.check(now, reason));
+        ASSERT_EQ(policy.selectTimeout(now, 1000), 1000);
+
+        // Pending tasks wake the select loop up at their max age
+        policy.update(2, now);
+        ASSERT_EQ(policy.pending(), 2);
+        ASSERT_FALSE(policy.check(now, reason));
+        ASSERT_LE(policy.selectTimeout(now, 1000), 5);
+
+        ASSERT_TRUE(policy.check(now + std::chrono::milliseconds(5), reason));
+        ASSERT_EQ(reason, FlushPolicy::FLUSH_REASON_DEADLINE);
+        ASSERT_EQ(policy.selectTimeout(now + std::chrono::milliseconds(10), 1000), 0);
+
+        // Reaching the threshold flushes right away
+        policy.update(3, now);
+        ASSERT_TRUE(policy.check(now, reason));
+        ASSERT_EQ(reason, FlushPolicy::FLUSH_REASON_THRESHOLD);
+        policy.flushed(reason);
+        ASSERT_EQ(policy.pending(), 0);
+        ASSERT_EQ(policy.getFlushes(FlushPolicy::FLUSH_REASON_THRESHOLD), 1);
+
+        // Flushes with nothing pending are counted but are not batches
+        policy.flushed(FlushPolicy::FLUSH_REASON_IDLE);
+        auto fvs = policy.toFieldValues();
+        ASSERT_EQ(fvs.size(), 8);
+        ASSERT_EQ(fvField(fvs[2]), "idle");
+        ASSERT_EQ(fvValue(fvs[2]), "1");
+        ASSERT_EQ(fvField(fvs[5]), "batches");
+        ASSERT_EQ(fvValue(fvs[5]), "1");
+        ASSERT_EQ(fvField(fvs[7]), "max_batch");
+        ASSERT_EQ(fvValue(fvs[7]), "3");
+    }
 }
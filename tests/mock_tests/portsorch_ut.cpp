@@ -17,9 +17,11 @@
 #include "warm_restart.h"
 #undef private
 
+#include <chrono>
 #include <sstream>
 
 extern redisReply *mockReply;
+extern size_t gMaxBulkSize;
 using ::testing::_;
 using ::testing::StrictMock;
 
@@ -41,6 +43,7 @@ namespace portsorch_test
     uint32_t _sai_set_port_fec_count;
     int32_t _sai_port_fec_mode;
     vector<sai_port_fec_mode_t> mock_port_fec_modes = {SAI_PORT_FEC_MODE_RS, SAI_PORT_FEC_MODE_FC};
+    uint32_t _sai_get_port_qos_number_count;
 
     sai_status_t _ut_stub_sai_get_port_attribute(
         _In_ sai_object_id_t port_id,
@@ -48,6 +51,16 @@ namespace portsorch_test
         _Inout_ sai_attribute_t *attr_list)
     {
         sai_status_t status;
+        for (uint32_t i = 0; i < attr_count; i++)
+        {
+            if (attr_list[i].id == SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES ||
+                attr_list[i].id == SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS ||
+                attr_list[i].id == SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS)
+            {
+                _sai_get_port_qos_number_count++;
+            }
+        }
+
         if (attr_count == 1 && attr_list[0].id == SAI_PORT_ATTR_SUPPORTED_FEC_MODE)
         {
             if (not_support_fetching_fec)
@@ -348,6 +361,216 @@ namespace portsorch_test
         sai_bridge_api = org_sai_bridge_api;
     }
 
+    sai_vlan_api_t ut_sai_vlan_api;
+    sai_vlan_api_t *org_sai_vlan_api;
+    uint32_t createVlanMembersCalls;
+    uint32_t removeVlanMembersCalls;
+    uint32_t createBridgePortCalls;
+    uint32_t removeBridgePortCalls;
+
+    sai_status_t _ut_stub_sai_create_vlan_members(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        createVlanMembersCalls++;
+        return org_sai_vlan_api->create_vlan_members(switch_id, object_count, attr_count, attr_list, mode, object_id, object_statuses);
+    }
+
+    sai_status_t _ut_stub_sai_remove_vlan_members(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        removeVlanMembersCalls++;
+        return org_sai_vlan_api->remove_vlan_members(object_count, object_id, mode, object_statuses);
+    }
+
+    sai_status_t _ut_stub_sai_create_bridge_port(
+        _Out_ sai_object_id_t *bridge_port_id,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        createBridgePortCalls++;
+        return org_sai_bridge_api->create_bridge_port(bridge_port_id, switch_id, attr_count, attr_list);
+    }
+
+    sai_status_t _ut_stub_sai_remove_bridge_port(
+        _In_ sai_object_id_t bridge_port_id)
+    {
+        removeBridgePortCalls++;
+        return org_sai_bridge_api->remove_bridge_port(bridge_port_id);
+    }
+
+    BulkerGenericApi org_bulker_generic_api;
+    uint32_t createBridgePortsCalls;
+    uint32_t removeBridgePortsCalls;
+
+    // Generic bulk create of bridge ports, made of single creates
+    sai_status_t _ut_stub_sai_bulk_object_create(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        if (object_type != SAI_OBJECT_TYPE_BRIDGE_PORT)
+        {
+            return org_bulker_generic_api.bulk_object_create(switch_id, object_type, object_count, attr_count, attr_list,
+                                                             mode, object_id, object_statuses);
+        }
+
+        createBridgePortsCalls++;
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = sai_bridge_api->create_bridge_port(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+        return status;
+    }
+
+    sai_status_t _ut_stub_sai_bulk_object_remove(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        if (object_type != SAI_OBJECT_TYPE_BRIDGE_PORT)
+        {
+            return org_bulker_generic_api.bulk_object_remove(object_type, object_count, object_id, mode, object_statuses);
+        }
+
+        removeBridgePortsCalls++;
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = sai_bridge_api->remove_bridge_port(object_id[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+        return status;
+    }
+
+    uint32_t getPortsAttributeCalls;
+    uint32_t getQueuesAttributeCalls;
+
+    // Generic bulk get of port and queue attributes, made of uncounted single gets
+    sai_status_t _ut_stub_sai_bulk_get_attribute(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _Inout_ uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _Inout_ sai_status_t *object_statuses)
+    {
+        if (object_type != SAI_OBJECT_TYPE_PORT && object_type != SAI_OBJECT_TYPE_QUEUE)
+        {
+            return org_bulker_generic_api.bulk_get_attribute(switch_id, object_type, object_count, object_key,
+                                                             attr_count, attr_list, object_statuses);
+        }
+
+        if (object_type == SAI_OBJECT_TYPE_PORT)
+        {
+            getPortsAttributeCalls++;
+        }
+        else
+        {
+            getQueuesAttributeCalls++;
+        }
+
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            if (object_type == SAI_OBJECT_TYPE_PORT)
+            {
+                object_statuses[i] = pold_sai_port_api->get_port_attribute(object_key[i].key.object_id, attr_count[i], attr_list[i]);
+            }
+            else
+            {
+                for (uint32_t j = 0; j < attr_count[i]; j++)
+                {
+                    if (attr_list[i][j].id == SAI_QUEUE_ATTR_TYPE)
+                    {
+                        attr_list[i][j].value.s32 = static_cast<sai_queue_type_t>(SAI_QUEUE_TYPE_UNICAST);
+                    }
+                    else if (attr_list[i][j].id == SAI_QUEUE_ATTR_INDEX)
+                    {
+                        attr_list[i][j].value.u8 = 0;
+                    }
+                }
+                object_statuses[i] = SAI_STATUS_SUCCESS;
+            }
+
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+        return status;
+    }
+
+    void _hook_sai_bulk_get_attribute()
+    {
+        getPortsAttributeCalls = 0;
+        getQueuesAttributeCalls = 0;
+
+        org_bulker_generic_api = BulkerGenericApi::instance();
+        BulkerGenericApi::instance().bulk_get_attribute = _ut_stub_sai_bulk_get_attribute;
+    }
+
+    void _unhook_sai_bulk_get_attribute()
+    {
+        BulkerGenericApi::instance() = org_bulker_generic_api;
+    }
+
+    void _hook_sai_vlan_member_counters()
+    {
+        createVlanMembersCalls = 0;
+        removeVlanMembersCalls = 0;
+        createBridgePortCalls = 0;
+        removeBridgePortCalls = 0;
+        createBridgePortsCalls = 0;
+        removeBridgePortsCalls = 0;
+
+        org_bulker_generic_api = BulkerGenericApi::instance();
+        BulkerGenericApi::instance().bulk_object_create = _ut_stub_sai_bulk_object_create;
+        BulkerGenericApi::instance().bulk_object_remove = _ut_stub_sai_bulk_object_remove;
+
+        ut_sai_vlan_api = *sai_vlan_api;
+        org_sai_vlan_api = sai_vlan_api;
+        ut_sai_vlan_api.create_vlan_members = _ut_stub_sai_create_vlan_members;
+        ut_sai_vlan_api.remove_vlan_members = _ut_stub_sai_remove_vlan_members;
+        sai_vlan_api = &ut_sai_vlan_api;
+
+        _hook_sai_bridge_api();
+        ut_sai_bridge_api.create_bridge_port = _ut_stub_sai_create_bridge_port;
+        ut_sai_bridge_api.remove_bridge_port = _ut_stub_sai_remove_bridge_port;
+    }
+
+    void _unhook_sai_vlan_member_counters()
+    {
+        BulkerGenericApi::instance() = org_bulker_generic_api;
+        sai_vlan_api = org_sai_vlan_api;
+        _unhook_sai_bridge_api();
+    }
+
     void cleanupPorts(PortsOrch *obj)
     {
         // Get CPU port
@@ -1140,10 +1363,11 @@ namespace portsorch_test
         ASSERT_TRUE(gPortsOrch->getPort("Ethernet0", port));
         ASSERT_NE(port.m_port_id, SAI_NULL_OBJECT_ID);
 
-        // Get queue info
+        // Get queue info, cached when the port was initialized
         string type;
         uint8_t index;
         auto queue_id = port.m_queue_ids[0];
+        ASSERT_NE(gPortsOrch->m_queueInfo.find(queue_id), gPortsOrch->m_queueInfo.end());
         auto ut_sai_get_queue_attr_count = _sai_get_queue_attr_count;
         gPortsOrch->getQueueTypeAndIndex(queue_id, type, index);
         ASSERT_EQ(type, "SAI_QUEUE_TYPE_UNICAST");
@@ -1153,6 +1377,11 @@ namespace portsorch_test
         gPortsOrch->getQueueTypeAndIndex(queue_id, type, index);
         ASSERT_EQ(type, "SAI_QUEUE_TYPE_UNICAST");
         ASSERT_EQ(index, 0);
+        ASSERT_EQ(ut_sai_get_queue_attr_count, _sai_get_queue_attr_count);
+
+        // Queue info is fetched again once it is dropped from the cache
+        gPortsOrch->m_queueInfo.erase(queue_id);
+        gPortsOrch->getQueueTypeAndIndex(queue_id, type, index);
         ASSERT_EQ(++ut_sai_get_queue_attr_count, _sai_get_queue_attr_count);
 
         // Delete port
@@ -1167,6 +1396,71 @@ namespace portsorch_test
         _unhook_sai_queue_api();
     }
 
+    /**
+     * Test that the queues, priority groups and scheduler groups of all ports
+     * are read in bulk ahead of the port initialization
+     */
+    TEST_F(PortsOrchTest, PortQosObjectsBulkInit)
+    {
+        _hook_sai_port_api();
+        _hook_sai_queue_api();
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        // Get SAI default ports to populate DB
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+
+        // Set PortConfigDone
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+
+        // refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        _sai_get_port_qos_number_count = 0;
+        _sai_get_queue_attr_count = 0;
+        _hook_sai_bulk_get_attribute();
+
+        // Apply configuration :
+        //  create ports
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        _unhook_sai_bulk_get_attribute();
+
+        // One bulk get for the QoS object numbers of all the ports and one for their lists,
+        // no per port read of the queues, priority groups and scheduler groups
+        ASSERT_EQ(getPortsAttributeCalls, 2 * ((ports.size() + gMaxBulkSize - 1) / gMaxBulkSize));
+        ASSERT_EQ(_sai_get_port_qos_number_count, 0u);
+        ASSERT_TRUE(gPortsOrch->m_portQosObjects.empty());
+
+        size_t queueCount = 0;
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+            ASSERT_FALSE(port.m_queue_ids.empty());
+            ASSERT_FALSE(port.m_priority_group_ids.empty());
+            ASSERT_EQ(port.m_queue_ids.size(), port.m_queue_lock.size());
+
+            for (auto queue_id : port.m_queue_ids)
+            {
+                ASSERT_NE(gPortsOrch->m_queueInfo.find(queue_id), gPortsOrch->m_queueInfo.end());
+            }
+            queueCount += port.m_queue_ids.size();
+        }
+
+        // The type and index of all the queues are read in bulk, none per queue
+        ASSERT_EQ(getQueuesAttributeCalls, (queueCount + gMaxBulkSize - 1) / gMaxBulkSize);
+        ASSERT_EQ(_sai_get_queue_attr_count, 0u);
+
+        _unhook_sai_queue_api();
+        _unhook_sai_port_api();
+    }
+
     TEST_F(PortsOrchTest, PortPTConfigDefaultTimestampTemplate)
     {
         auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
@@ -3178,4 +3472,91 @@ namespace portsorch_test
         ASSERT_FALSE(bridgePortCalledBeforeLagMember); // bridge port created on lag before lag member was created
     }
 
+    /*
+     * Cold boot of a large VLAN configuration: every port is a tagged member
+     * of every VLAN. The members are created then removed in bulk.
+     */
+    TEST_F(PortsOrchTest, VlanMemberBulkCreateRemove_Benchmark)
+    {
+        const uint32_t vlanCount = 64;
+
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+        Table vlanTable = Table(m_app_db.get(), APP_VLAN_TABLE_NAME);
+
+        auto ports = ut_helper::getInitialSaiPorts();
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        portTable.set("PortInitDone", { { "lanes", "0" } });
+
+        for (uint32_t vid = 100; vid < 100 + vlanCount; vid++)
+        {
+            vlanTable.set("Vlan" + to_string(vid), { { "admin_status", "up" }, { "mtu", "9100" } });
+        }
+
+        gPortsOrch->addExistingData(&portTable);
+        gPortsOrch->addExistingData(&vlanTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        _hook_sai_vlan_member_counters();
+
+        std::deque<KeyOpFieldsValuesTuple> members;
+        for (uint32_t vid = 100; vid < 100 + vlanCount; vid++)
+        {
+            for (const auto &it : ports)
+            {
+                members.push_back({ "Vlan" + to_string(vid) + ":" + it.first, SET_COMMAND, { { "tagging_mode", "tagged" } } });
+            }
+        }
+        size_t memberCount = members.size();
+
+        auto consumer = dynamic_cast<Consumer *>(gPortsOrch->getExecutor(APP_VLAN_MEMBER_TABLE_NAME));
+        consumer->addToSync(members);
+
+        auto start = std::chrono::steady_clock::now();
+        static_cast<Orch *>(gPortsOrch)->doTask(*consumer);
+        auto createUsec = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        ASSERT_TRUE(consumer->m_toSync.empty());
+        ASSERT_EQ(createBridgePortCalls, ports.size());
+        ASSERT_EQ(createBridgePortsCalls, 1u);
+        ASSERT_EQ(createVlanMembersCalls, (memberCount + gMaxBulkSize - 1) / gMaxBulkSize);
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+            ASSERT_NE(port.m_bridge_port_id, SAI_NULL_OBJECT_ID);
+            ASSERT_EQ(gPortsOrch->m_portVlanMember[it.first].size(), vlanCount);
+        }
+
+        for (auto &member : members)
+        {
+            kfvOp(member) = DEL_COMMAND;
+            kfvFieldsValues(member).clear();
+        }
+        consumer->addToSync(members);
+
+        start = std::chrono::steady_clock::now();
+        static_cast<Orch *>(gPortsOrch)->doTask(*consumer);
+        auto removeUsec = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        ASSERT_TRUE(consumer->m_toSync.empty());
+        ASSERT_EQ(removeBridgePortCalls, ports.size());
+        ASSERT_EQ(removeBridgePortsCalls, 1u);
+        ASSERT_EQ(removeVlanMembersCalls, (memberCount + gMaxBulkSize - 1) / gMaxBulkSize);
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+            ASSERT_EQ(port.m_bridge_port_id, SAI_NULL_OBJECT_ID);
+            ASSERT_EQ(gPortsOrch->m_portVlanMember.count(it.first), 0);
+        }
+
+        printf("%zu VLAN members on %zu ports: created in %ld us, removed in %ld us\n",
+                memberCount, ports.size(), (long)createUsec, (long)removeUsec);
+
+        _unhook_sai_vlan_member_counters();
+    }
 }
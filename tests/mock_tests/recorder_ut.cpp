@@ -0,0 +1,118 @@
+#include "recorder.h"
+#include "ut_helper.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace recorder_test
+{
+    using namespace std;
+    using namespace swss;
+
+    struct TestRecWriter : public RecWriter
+    {
+        TestRecWriter(const string &file, bool async, bool binary)
+        {
+            setRecord(true);
+            setRotate(false);
+            setLocation(".");
+            setFileName(file);
+            setName("Test");
+            setAsync(async);
+            setBinary(binary);
+        }
+    };
+
+    /* Drop the timestamps, they differ between the recordings */
+    string stripTimestamps(istream &in)
+    {
+        ostringstream out;
+        string line;
+        while (getline(in, line))
+        {
+            out << line.substr(line.find('|')) << "\n";
+        }
+        return out.str();
+    }
+
+    string record(const string &file, bool async, bool binary)
+    {
+        {
+            TestRecWriter writer(file, async, binary);
+            writer.startRec(false);
+
+            KeyOpFieldsValuesTuple set{ "1.1.1.0/24", SET_COMMAND, { { "nexthop", "10.0.0.1" }, { "ifname", "Ethernet0" } } };
+            KeyOpFieldsValuesTuple del{ "1.1.1.0/24", DEL_COMMAND, {} };
+            for (int i = 0; i < 1000; i++)
+            {
+                writer.record("ROUTE_TABLE", ":", set);
+                writer.record("ROUTE_TABLE", ":", del);
+            }
+            writer.record("PORT_TABLE:Ethernet0|SET|mtu:9100");
+            writer.stopRec();
+        }
+
+        string path = "./" + file + (binary ? ".bin" : "");
+        ifstream in(path, ios::binary);
+        string text;
+        if (binary)
+        {
+            stringstream converted;
+            bool ok = false;
+            EXPECT_EQ(RecWriter::binaryToText(in, converted, ok), 2002);
+            EXPECT_TRUE(ok);
+            text = stripTimestamps(converted);
+        }
+        else
+        {
+            text = stripTimestamps(in);
+        }
+
+        remove(path.c_str());
+        return text;
+    }
+
+    TEST(RecRingTest, PushPop)
+    {
+        RecRing ring(100);
+        ASSERT_EQ(ring.capacity(), 128);
+
+        // Records wrap around the end of the buffer
+        string out;
+        for (int i = 0; i < 1000; i++)
+        {
+            string rec(i % 50, static_cast<char>('a' + i % 26));
+            ASSERT_TRUE(ring.push(rec));
+            ASSERT_TRUE(ring.pop(out));
+            ASSERT_EQ(out, rec);
+        }
+        ASSERT_TRUE(ring.empty());
+        ASSERT_FALSE(ring.pop(out));
+
+        // No room left
+        ASSERT_TRUE(ring.push(string(100, 'x')));
+        ASSERT_FALSE(ring.push(string(100, 'y')));
+    }
+
+    TEST(RecorderTest, AsyncAndBinaryMatchSyncText)
+    {
+        string sync = record("recorder_ut_sync.rec", false, false);
+        ASSERT_NE(sync.find("|ROUTE_TABLE:1.1.1.0/24|SET|nexthop:10.0.0.1|ifname:Ethernet0\n"), string::npos);
+        ASSERT_NE(sync.find("|ROUTE_TABLE:1.1.1.0/24|DEL\n"), string::npos);
+
+        ASSERT_EQ(record("recorder_ut_async.rec", true, false), sync);
+        ASSERT_EQ(record("recorder_ut_bin.rec", false, true), sync);
+        ASSERT_EQ(record("recorder_ut_async_bin.rec", true, true), sync);
+    }
+
+    TEST(RecorderTest, TruncatedBinary)
+    {
+        string bin("\x05\x01\x02", 3);
+        istringstream in(bin);
+        ostringstream out;
+        bool ok = true;
+        ASSERT_EQ(RecWriter::binaryToText(in, out, ok), 0);
+        ASSERT_FALSE(ok);
+    }
+}
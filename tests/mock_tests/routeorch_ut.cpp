@@ -524,6 +524,52 @@ namespace routeorch_test
         gMockResponsePublisher.reset();
     }
 
+    TEST_F(RouteOrchTest, RouteOrchTestParkUntilNeighborResolved)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"2.2.2.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.4"}}});
+        auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        consumer->addToSync(entries);
+
+        auto current_create_count = create_route_count;
+        auto current_parked = consumer->getRetryCounters().parked;
+        auto current_woken = consumer->getRetryCounters().woken;
+
+        // No neighbor 10.0.0.4 yet, the route is parked instead of being retried
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        ASSERT_EQ(current_create_count, create_route_count);
+        ASSERT_TRUE(consumer->m_toSync.empty());
+        ASSERT_TRUE(consumer->hasParkedTasks());
+        ASSERT_EQ(current_parked + 1, consumer->getRetryCounters().parked);
+
+        vector<string> pending;
+        consumer->dumpPendingTasks(pending);
+        ASSERT_EQ(pending.size(), 1u);
+        ASSERT_NE(pending[0].find("<waiting:10.0.0.4@Ethernet0>"), string::npos);
+
+        // Draining again does not touch the parked route
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        ASSERT_EQ(current_create_count, create_route_count);
+        ASSERT_TRUE(consumer->hasParkedTasks());
+
+        // The neighbor notification wakes the route
+        entries.clear();
+        entries.push_back({"Ethernet0:10.0.0.4", "SET", { {"neigh", "00:00:0a:00:00:04"},
+                                                          {"family", "IPv4"}}});
+        auto neigh_consumer = dynamic_cast<Consumer *>(gNeighOrch->getExecutor(APP_NEIGH_TABLE_NAME));
+        neigh_consumer->addToSync(entries);
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        ASSERT_FALSE(consumer->hasParkedTasks());
+        ASSERT_EQ(consumer->m_toSync.count("2.2.2.0/24"), 1u);
+        ASSERT_EQ(current_woken + 1, consumer->getRetryCounters().woken);
+
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        ASSERT_EQ(current_create_count + 1, create_route_count);
+        ASSERT_TRUE(consumer->m_toSync.empty());
+    }
+
     TEST_F(RouteOrchTest, RouteOrchTestInvalidEvpnRoute)
     {
         std::deque<KeyOpFieldsValuesTuple> entries;
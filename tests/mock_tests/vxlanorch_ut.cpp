@@ -0,0 +1,241 @@
+#define private public
+#include "directory.h"
+#include "vxlanorch.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "gtest/gtest.h"
+#include <string>
+
+namespace vxlanorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    static const string TUNNEL_NAME = "vtep1";
+
+    sai_tunnel_api_t ut_sai_tunnel_api;
+    sai_tunnel_api_t *pold_sai_tunnel_api;
+    BulkerGenericApi org_bulker_generic_api;
+
+    // Bulk calls on tunnel map entries, in order: "create" or "remove", with their entry count
+    vector<pair<string, uint32_t>> tunnelMapBulkCalls;
+
+    // VLANs whose map entry fails to be created
+    set<uint16_t> failedVlans;
+
+    sai_status_t _ut_stub_sai_create_tunnel_map_entry(
+        _Out_ sai_object_id_t *tunnel_map_entry_id,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        for (uint32_t i = 0; i < attr_count; i++)
+        {
+            if (attr_list[i].id == SAI_TUNNEL_MAP_ENTRY_ATTR_VLAN_ID_VALUE && failedVlans.count(attr_list[i].value.u16))
+            {
+                return SAI_STATUS_FAILURE;
+            }
+        }
+        return pold_sai_tunnel_api->create_tunnel_map_entry(tunnel_map_entry_id, switch_id, attr_count, attr_list);
+    }
+
+    // Generic bulk create of tunnel map entries, made of single creates
+    sai_status_t _ut_stub_sai_bulk_object_create(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        if (object_type != SAI_OBJECT_TYPE_TUNNEL_MAP_ENTRY)
+        {
+            return org_bulker_generic_api.bulk_object_create(switch_id, object_type, object_count, attr_count, attr_list,
+                                                             mode, object_id, object_statuses);
+        }
+
+        tunnelMapBulkCalls.emplace_back("create", object_count);
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = sai_tunnel_api->create_tunnel_map_entry(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+        return status;
+    }
+
+    // Generic bulk remove of tunnel map entries, made of single removes
+    sai_status_t _ut_stub_sai_bulk_object_remove(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        if (object_type != SAI_OBJECT_TYPE_TUNNEL_MAP_ENTRY)
+        {
+            return org_bulker_generic_api.bulk_object_remove(object_type, object_count, object_id, mode, object_statuses);
+        }
+
+        tunnelMapBulkCalls.emplace_back("remove", object_count);
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = sai_tunnel_api->remove_tunnel_map_entry(object_id[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = object_statuses[i];
+            }
+        }
+        return status;
+    }
+
+    class VxlanTunnelMapOrchTest : public MockOrchTest
+    {
+    protected:
+        VxlanTunnelMapOrch *m_VxlanTunnelMapOrch;
+
+        void ApplyInitialConfigs() override
+        {
+            m_VxlanTunnelMapOrch = new VxlanTunnelMapOrch(m_app_db.get(), APP_VXLAN_TUNNEL_MAP_TABLE_NAME);
+            gDirectory.set(m_VxlanTunnelMapOrch);
+            ut_orch_list.push_back((Orch **)&m_VxlanTunnelMapOrch);
+
+            // The tunnel is used without a tunnel port
+            m_VxlanTunnelOrch->is_dip_tunnel_supported = true;
+
+            Table port_table = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+            Table vlan_table = Table(m_app_db.get(), APP_VLAN_TABLE_NAME);
+            Table vxlan_tunnel_table = Table(m_app_db.get(), APP_VXLAN_TUNNEL_TABLE_NAME);
+
+            auto ports = ut_helper::getInitialSaiPorts();
+            port_table.set(ETHERNET0, ports[ETHERNET0]);
+            port_table.set("PortConfigDone", { { "count", to_string(1) } });
+            port_table.set("PortInitDone", { {} });
+
+            for (const auto &vlan : { VLAN_1000, VLAN_2000, VLAN_3000 })
+            {
+                vlan_table.set(vlan, { { "admin_status", "up" },
+                                       { "mtu", "9100" } });
+            }
+
+            vxlan_tunnel_table.set(TUNNEL_NAME, { { "src_ip", "2.2.2.2" } });
+
+            gPortsOrch->addExistingData(&port_table);
+            gPortsOrch->addExistingData(&vlan_table);
+            static_cast<Orch *>(gPortsOrch)->doTask();
+
+            m_VxlanTunnelOrch->addExistingData(&vxlan_tunnel_table);
+            static_cast<Orch *>(m_VxlanTunnelOrch)->doTask();
+        }
+
+        void PostSetUp() override
+        {
+            pold_sai_tunnel_api = sai_tunnel_api;
+            ut_sai_tunnel_api = *sai_tunnel_api;
+            ut_sai_tunnel_api.create_tunnel_map_entry = _ut_stub_sai_create_tunnel_map_entry;
+            sai_tunnel_api = &ut_sai_tunnel_api;
+
+            org_bulker_generic_api = BulkerGenericApi::instance();
+            BulkerGenericApi::instance().bulk_object_create = _ut_stub_sai_bulk_object_create;
+            BulkerGenericApi::instance().bulk_object_remove = _ut_stub_sai_bulk_object_remove;
+
+            tunnelMapBulkCalls.clear();
+            failedVlans.clear();
+        }
+
+        void PreTearDown() override
+        {
+            BulkerGenericApi::instance() = org_bulker_generic_api;
+            sai_tunnel_api = pold_sai_tunnel_api;
+        }
+
+        KeyOpFieldsValuesTuple tunnelMap(const string &op, uint16_t vlan_id)
+        {
+            string vni = to_string(vlan_id);
+            string vlan = "Vlan" + vni;
+            string key = TUNNEL_NAME + ":map_" + vni + "_" + vlan;
+            if (op == DEL_COMMAND)
+            {
+                return { key, op, {} };
+            }
+
+            return { key, op, { { "vni", vni }, { "vlan", vlan } } };
+        }
+
+        void doTunnelMapTask(const deque<KeyOpFieldsValuesTuple> &entries)
+        {
+            auto consumer = dynamic_cast<Consumer *>(m_VxlanTunnelMapOrch->getExecutor(APP_VXLAN_TUNNEL_MAP_TABLE_NAME));
+            consumer->addToSync(entries);
+            static_cast<Orch *>(m_VxlanTunnelMapOrch)->doTask();
+        }
+
+        size_t pendingTunnelMapTasks()
+        {
+            auto consumer = dynamic_cast<Consumer *>(m_VxlanTunnelMapOrch->getExecutor(APP_VXLAN_TUNNEL_MAP_TABLE_NAME));
+            return consumer->m_toSync.size();
+        }
+
+        bool hasTunnelMap(uint16_t vlan_id)
+        {
+            return m_VxlanTunnelMapOrch->isTunnelMapExists(kfvKey(tunnelMap(SET_COMMAND, vlan_id)));
+        }
+    };
+
+    TEST_F(VxlanTunnelMapOrchTest, MixedBatchFlushedOnOperationChange)
+    {
+        doTunnelMapTask({ tunnelMap(SET_COMMAND, 1000), tunnelMap(SET_COMMAND, 3000) });
+        ASSERT_TRUE(hasTunnelMap(1000));
+        ASSERT_TRUE(hasTunnelMap(3000));
+
+        // The tasks are run in key order: removal, addition, removal
+        tunnelMapBulkCalls.clear();
+        doTunnelMapTask({ tunnelMap(DEL_COMMAND, 1000), tunnelMap(SET_COMMAND, 2000), tunnelMap(DEL_COMMAND, 3000) });
+
+        // Each change of operation flushes the entries queued before
+        ASSERT_EQ(tunnelMapBulkCalls.size(), 3u);
+        ASSERT_EQ(tunnelMapBulkCalls[0], make_pair(string("remove"), 1u));
+        ASSERT_EQ(tunnelMapBulkCalls[1], make_pair(string("create"), 1u));
+        ASSERT_EQ(tunnelMapBulkCalls[2], make_pair(string("remove"), 1u));
+
+        ASSERT_FALSE(hasTunnelMap(1000));
+        ASSERT_TRUE(hasTunnelMap(2000));
+        ASSERT_FALSE(hasTunnelMap(3000));
+        ASSERT_EQ(pendingTunnelMapTasks(), 0u);
+        ASSERT_EQ(m_VxlanTunnelOrch->getVxlanTunnel(TUNNEL_NAME)->vlan_vrf_vni_count, 1u);
+    }
+
+    TEST_F(VxlanTunnelMapOrchTest, FailedMapEntryCreateRetried)
+    {
+        failedVlans.insert(2000);
+        doTunnelMapTask({ tunnelMap(SET_COMMAND, 1000), tunnelMap(SET_COMMAND, 2000) });
+
+        // Both entries are created in one batch, the failed one stays to be retried
+        ASSERT_EQ(tunnelMapBulkCalls.size(), 1u);
+        ASSERT_EQ(tunnelMapBulkCalls[0], make_pair(string("create"), 2u));
+        ASSERT_TRUE(hasTunnelMap(1000));
+        ASSERT_FALSE(hasTunnelMap(2000));
+        ASSERT_EQ(pendingTunnelMapTasks(), 1u);
+        ASSERT_EQ(m_VxlanTunnelOrch->getVxlanTunnel(TUNNEL_NAME)->vlan_vrf_vni_count, 1u);
+
+        failedVlans.clear();
+        tunnelMapBulkCalls.clear();
+        static_cast<Orch *>(m_VxlanTunnelMapOrch)->doTask();
+
+        ASSERT_EQ(tunnelMapBulkCalls.size(), 1u);
+        ASSERT_EQ(tunnelMapBulkCalls[0], make_pair(string("create"), 1u));
+        ASSERT_TRUE(hasTunnelMap(2000));
+        ASSERT_EQ(pendingTunnelMapTasks(), 0u);
+        ASSERT_EQ(m_VxlanTunnelOrch->getVxlanTunnel(TUNNEL_NAME)->vlan_vrf_vni_count, 2u);
+    }
+}